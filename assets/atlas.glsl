@@ -0,0 +1,22 @@
+//
+// FILE     assets/atlas.glsl
+//
+// Block textures are layers of `sampler2DArray`, one per atlas tile (see
+// `AtlasToTextureArray`).
+//
+
+const vec2 CORNER_UV[4] = vec2[4](
+    vec2(1, 1), vec2(1, 0), vec2(0, 0), vec2(0, 1));
+
+// @breaf Texture coordinates of `corner` of atlas `tile`, layer in z.
+vec3 AtlasGetLayerUV(uint tile, uint corner) {
+    return vec3(CORNER_UV[corner], float(tile));
+}
+
+// @breaf Same as `AtlasGetLayerUV`, but tile repeats over merged face.
+// `CORNER_UV` x runs along left edge and y along top edge, layers wrap with
+// GL_REPEAT. See `ChunkVertex::extent`.
+vec3 AtlasGetLayerUVRepeated(uint tile, uint corner, uint extent) {
+    vec2 repeat = vec2(float((extent >> 4u) + 1u), float((extent & 15u) + 1u));
+    return vec3(CORNER_UV[corner] * repeat, float(tile));
+}
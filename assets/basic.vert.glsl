@@ -1,26 +1,40 @@
 #version 330 core
 
+// NOTE(gr3yknigh1): Permutation keywords: INSTANCED, VERTEX_OFFSET.
+// [2025/11/23]
+
 layout (location = 0) in vec3 l_Position;
 layout (location = 1) in vec3 l_Color;
 layout (location = 2) in vec2 l_TexCoord;
 
+#if defined(INSTANCED)
+// @breaf Per-instance world offset of the model.
+layout (location = 3) in vec3 l_InstanceOffset;
+#endif
+
 out vec4 f_Color;
 out vec2 f_TexCoord;
 
-uniform mat4 u_Model = mat4(0);
-uniform mat4 u_View = mat4(0);
-uniform mat4 u_Projection = mat4(0);
+#include "uniform_blocks.glsl"
 
-uniform float u_VertexModifier = 1;
+#if defined(VERTEX_OFFSET)
 uniform vec3 u_VertexOffset = vec3(0, 0, 0);
+#endif
 
 void main()
 {
-    mat4 transformation = u_Projection * u_View * u_Model;
-    gl_Position = transformation * vec4(
-        l_Position * u_VertexModifier + u_VertexOffset, 1.0);
+    vec3 position = l_Position;
+
+#if defined(VERTEX_OFFSET)
+    position += u_VertexOffset;
+#endif
+#if defined(INSTANCED)
+    position += l_InstanceOffset;
+#endif
+
+    mat4 transformation = u_ViewProjection * u_Model;
+    gl_Position = transformation * vec4(position, 1.0);
 
     f_Color = vec4(l_Color, 1.0);
     f_TexCoord = l_TexCoord;
 }
-
@@ -0,0 +1,26 @@
+#version 330 core
+
+// @breaf Unit quad corner. [0..1]
+layout (location = 0) in vec2 l_Position;
+
+// @breaf Per-instance rectangle data.
+layout (location = 1) in vec2 l_InstancePosition;
+layout (location = 2) in vec2 l_InstanceSize;
+layout (location = 3) in vec3 l_InstanceColor;
+
+out vec4 f_Color;
+
+layout (std140) uniform Camera {
+    mat4 u_View;
+    mat4 u_Projection;
+    mat4 u_ViewProjection;
+};
+
+void main()
+{
+    vec2 worldPosition = l_InstancePosition + l_Position * l_InstanceSize;
+    vec4 position = u_ViewProjection * vec4(worldPosition, 0.0, 1.0);
+    gl_Position = vec4(position.xy, 0.0, 1.0);
+
+    f_Color = vec4(l_InstanceColor, 1.0);
+}
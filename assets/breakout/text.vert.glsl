@@ -2,14 +2,21 @@
 
 layout (location = 0) in vec2 l_Position;
 layout (location = 1) in vec2 l_TexCoords;
+layout (location = 2) in vec3 l_Color;
 
 out vec2 o_TexCoords;
+out vec3 o_Color;
 
-uniform mat4 u_Projection = mat4(0);
+layout (std140) uniform Camera {
+    mat4 u_View;
+    mat4 u_Projection;
+    mat4 u_ViewProjection;
+};
 
 void main() {
-    vec4 position = u_Projection * mat4(1) * vec4(l_Position, 0.0, 1.0);
+    vec4 position = u_ViewProjection * vec4(l_Position, 0.0, 1.0);
     gl_Position = vec4(position.xy, 0.0, 1.0);
 
     o_TexCoords = l_TexCoords;
+    o_Color = l_Color;
 }
@@ -0,0 +1,18 @@
+#version 330 core
+
+in vec2 o_TexCoords;
+in vec3 o_Color;
+
+out vec4 FragColor;
+
+uniform sampler2D u_Texture;
+
+void main() {
+    // NOTE: FreeType stores distance as 0..1, where 0.5 is the outline and
+    // bigger values are inside of the glyph.
+    float distance = texture(u_Texture, o_TexCoords).r;
+    float smoothing = fwidth(distance);
+    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
+
+    FragColor = vec4(o_Color, alpha);
+}
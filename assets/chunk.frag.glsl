@@ -0,0 +1,17 @@
+//
+// FILE     assets/chunk.frag.glsl
+//
+
+#version 330 core
+
+out vec4 FragColor;
+
+in vec4 f_Color;
+in vec3 f_TexCoord; // Layer in z.
+
+uniform sampler2DArray u_Texture;
+
+void main()
+{
+    FragColor = texture(u_Texture, f_TexCoord) * f_Color;
+}
@@ -4,24 +4,27 @@
 
 #version 330 core
 
-// @breaf Location of geometry in world space.
-layout (location = 0) in vec3 l_Position;
+// @breaf Chunk-local position of vertex (xyz) and face normal id (w).
+layout (location = 0) in uvec4 l_PositionNormal;
 
-// @breaf Texture coordinates.
-layout (location = 1) in vec2 l_UV;
+// @breaf Row-major index of atlas tile, which is layer of block textures.
+layout (location = 1) in uint l_Tile;
 
-// @breaf Model matrix.
-uniform mat4 u_Model = mat4(0);
+// @breaf Corner of tile (x), which vertex takes, and times tile repeats along
+// top (bits 0..3) and left (bits 4..7) edges of face minus one (y).
+layout (location = 2) in uvec2 l_CornerExtent;
 
-// @breaf View matrix.
-uniform mat4 u_View = mat4(0);
+out vec4 f_Color;
+out vec3 f_TexCoord; // Layer in z.
 
-// @breaf Projection matrix.
-uniform mat4 u_Projection = mat4(0);
-
-out vec2 f_UV;
+#include "uniform_blocks.glsl"
+#include "atlas.glsl"
 
 void main() {
-    gl_Position = u_Projection * u_View * u_Model * vec4(l_Position, 1.0);
-    f_UV = l_UV;
-}
\ No newline at end of file
+    gl_Position =
+        u_ViewProjection * u_Model * vec4(vec3(l_PositionNormal.xyz), 1.0);
+
+    f_TexCoord =
+        AtlasGetLayerUVRepeated(l_Tile, l_CornerExtent.x, l_CornerExtent.y);
+    f_Color = vec4(1.0);
+}
@@ -0,0 +1,54 @@
+//
+// FILE     assets/chunk_pulling.vert.glsl
+//
+
+#version 330 core
+
+// NOTE(gr3yknigh1): No vertex attributes. Every face is one 32 bit record
+// (see `FaceRecord` in demos/badcraft/main.cpp), draw is indexed with shared
+// quad index buffer, so `gl_VertexID` is face index * 4 + corner.
+// [2025/11/23]
+
+// @breaf Face records of chunk: x, y, z (5 bits each), normal (3 bits) and
+// atlas tile (14 bits), from lowest bit.
+uniform usamplerBuffer u_FaceRecords;
+
+out vec4 f_Color;
+out vec3 f_TexCoord; // Layer in z.
+
+#include "uniform_blocks.glsl"
+#include "atlas.glsl"
+
+// @breaf Block-local corners of each face, indexed by normal * 4 + corner.
+// Must match face tables in demos/badcraft/main.cpp.
+const vec3 FACE_CORNERS[24] = vec3[24](
+    // Front
+    vec3(0, 1, 1), vec3(1, 1, 1), vec3(1, 0, 1), vec3(0, 0, 1),
+    // Back
+    vec3(1, 1, 0), vec3(0, 1, 0), vec3(0, 0, 0), vec3(1, 0, 0),
+    // Top
+    vec3(0, 1, 0), vec3(1, 1, 0), vec3(1, 1, 1), vec3(0, 1, 1),
+    // Bottom
+    vec3(0, 0, 1), vec3(1, 0, 1), vec3(1, 0, 0), vec3(0, 0, 0),
+    // Left
+    vec3(0, 1, 0), vec3(0, 1, 1), vec3(0, 0, 1), vec3(0, 0, 0),
+    // Right
+    vec3(1, 1, 1), vec3(1, 1, 0), vec3(1, 0, 0), vec3(1, 0, 1));
+
+void main() {
+    int faceIndex = gl_VertexID / 4;
+    int corner = gl_VertexID % 4;
+
+    uint record = texelFetch(u_FaceRecords, faceIndex).r;
+
+    uvec3 block = uvec3(
+        record & 31u, (record >> 5u) & 31u, (record >> 10u) & 31u);
+    uint normal = (record >> 15u) & 7u;
+    uint tileIndex = record >> 18u;
+
+    vec3 position = vec3(block) + FACE_CORNERS[normal * 4u + uint(corner)];
+    gl_Position = u_ViewProjection * u_Model * vec4(position, 1.0);
+
+    f_TexCoord = AtlasGetLayerUV(tileIndex, uint(corner));
+    f_Color = vec4(1.0);
+}
@@ -0,0 +1,17 @@
+//
+// FILE     assets/uniform_blocks.glsl
+//
+// Uniform blocks, which are bound by `GLLinkShaderProgram` to well-known
+// binding points.
+//
+
+layout (std140) uniform Camera {
+    mat4 u_View;
+    mat4 u_Projection;
+    mat4 u_ViewProjection;
+};
+
+// @breaf Model matrix moves vertex from model space to world space.
+layout (std140) uniform Draw {
+    mat4 u_Model;
+};
@@ -30,4 +30,48 @@ GFS_API f32 AtlasGetTileUVHeight(Atlas *atlas);
 
 GFS_API TexCoords AtlasTileCoordsToUV(Atlas *atlas, Vector2U32 tileCoords);
 
+/*
+ * @breaf Makes `GL_TEXTURE_2D_ARRAY` with tile of row-major index N at layer
+ * N. Layers have full mip chains, so unlike `atlas->texture` it can be
+ * sampled with mipmapping.
+ */
+GFS_API GLTexture AtlasToTextureArray(Atlas *atlas, ColorLayout colorLayout);
+
+typedef struct {
+    u32 x;
+    u32 y;
+    u32 width;
+} SkylineNode;
+
+/*
+ * @breaf Rectangle packer for building atlases at runtime (glyphs, sprites).
+ *
+ * Keeps "skyline" - list of horizontal segments, which describes top edge of
+ * already packed rectangles. New rectangle placed at position where it ends up
+ * lowest (bottom-left heuristic).
+ */
+typedef struct {
+    u32 width;
+    u32 height;
+
+    SkylineNode *nodes;
+    u32 nodesCount;
+    u32 nodesCapacity;
+} SkylinePacker;
+
+GFS_API SkylinePacker SkylinePackerMake(Scratch *scratch, u32 width, u32 height);
+
+/*
+ * @breaf Forgets all packed rectangles.
+ */
+GFS_API void SkylinePackerReset(SkylinePacker *packer);
+
+/*
+ * @breaf Finds place for rectangle.
+ *
+ * @return `false` if rectangle doesn't fit in the packer.
+ */
+GFS_API bool SkylinePackerPack(
+    SkylinePacker *packer, u32 width, u32 height, Vector2U32 *position);
+
 #endif // GFS_ATLAS_H_INCLUDED
@@ -76,4 +76,14 @@ typedef enum BMPictureLoadFromFileRC {
 GFS_API BMPictureLoadFromFileRC
 BMPictureLoadFromFile(BMPicture *image, Scratch *scratch, cstring8 filePath);
 
+/*
+ * @breaf Writes 32-bit picture. Pixels are in BGRA order and rows go from
+ * bottom to top, as `glReadPixels` returns them.
+ *
+ * @return `false` if file can't be written.
+ */
+GFS_API bool BMPictureSaveToFile(
+    cstring8 filePath, Scratch *scratch, const void *pixels, u32 width,
+    u32 height);
+
 #endif // GFS_BMP_H_INCLUDED
@@ -0,0 +1,68 @@
+#if !defined(GFS_DYNAMIC_RESOLUTION_H_INCLUDED)
+/*
+ * FILE      gfs\code\gfs\include\gfs\dynamic_resolution.h
+ * AUTHOR    Ilya Akkuzin <gr3yknigh1@gmail.com>
+ * COPYRIGHT (c) 2025 Ilya Akkuzin
+ * */
+#define GFS_DYNAMIC_RESOLUTION_H_INCLUDED
+
+#include "gfs/types.h"
+#include "gfs/macros.h"
+
+typedef struct {
+    f32 budgetMilliseconds;
+
+    f32 minScale;
+    f32 maxScale;
+    f32 scaleStep; // Scale is always multiple of it.
+
+    // NOTE(gr3yknigh1): Gap between thresholds is hysteresis. Scale goes down
+    // when average frame time is above `budget * lowerThreshold` and goes up
+    // when it's below `budget * raiseThreshold`. [2025/11/23]
+    f32 lowerThreshold;
+    f32 raiseThreshold;
+
+    u32 settleFrameCount; // Frames threshold must be crossed before change.
+    f32 smoothing;        // Weight of new frame in moving average.
+} DynamicResolutionSettings;
+
+/*
+ * @breaf Adjusts resolution scale to hold frame time within budget. Doesn't
+ * touch OpenGL, so caller decides what is rendered at scaled resolution.
+ */
+typedef struct {
+    DynamicResolutionSettings settings;
+
+    f32 scale; // Of each side, so pixel count is `scale * scale`.
+    f32 averageMilliseconds;
+    u32 overBudgetFrameCount;
+    u32 underBudgetFrameCount;
+    u32 changeCount;
+} DynamicResolution;
+
+/*
+ * @breaf Settings with scale in [0.5, 1] range, which leave 15% of budget as
+ * hysteresis gap.
+ */
+GFS_API DynamicResolutionSettings
+DynamicResolutionSettingsMake(f32 budgetMilliseconds);
+
+GFS_API DynamicResolution
+DynamicResolutionMake(DynamicResolutionSettings settings);
+
+/*
+ * @breaf Feeds frame time. GPU time is used when it's known (non zero),
+ * since scale only changes GPU work. Otherwise CPU time is used.
+ *
+ * @return `true` if scale was changed.
+ */
+GFS_API bool DynamicResolutionUpdate(
+    DynamicResolution *resolution, f32 gpuMilliseconds, f32 cpuMilliseconds);
+
+/*
+ * @breaf Scales side of full resolution target. Never returns zero.
+ */
+GFS_API u32
+DynamicResolutionScaleSize(const DynamicResolution *resolution, u32 size);
+
+#endif // GFS_DYNAMIC_RESOLUTION_H_INCLUDED
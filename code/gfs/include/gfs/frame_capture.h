@@ -0,0 +1,120 @@
+#if !defined(GFS_FRAME_CAPTURE_H_INCLUDED)
+/*
+ * FILE      gfs\code\gfs\include\gfs\frame_capture.h
+ * AUTHOR    Ilya Akkuzin <gr3yknigh1@gmail.com>
+ * COPYRIGHT (c) 2025 Ilya Akkuzin
+ * */
+#define GFS_FRAME_CAPTURE_H_INCLUDED
+
+#include "gfs/types.h"
+#include "gfs/macros.h"
+#include "gfs/memory.h"
+#include "gfs/platform.h"
+
+/*
+ * @breaf Count of pixel buffer objects, frames are read into. Frame is mapped
+ * once it's fence is signaled, usually couple of frames later.
+ */
+#define GL_FRAME_CAPTURE_SLOT_COUNT EXPAND(3)
+
+#define GL_FRAME_CAPTURE_PATH_CAPACITY EXPAND(256)
+
+typedef enum {
+    GL_FRAME_CAPTURE_FORMAT_BMP, // File per frame: `<prefix>_00000.bmp`.
+
+    // NOTE(gr3yknigh1): Frames are appended to `<prefix>.bgra` one after
+    // another, bottom row first. Play with `ffplay -f rawvideo -pixel_format
+    // bgra -video_size WxH -vf vflip`, so size must not change while
+    // recording. [2025/11/23]
+    GL_FRAME_CAPTURE_FORMAT_RAW,
+} GLFrameCaptureFormat;
+
+// NOTE(gr3yknigh1): Slots are taken in ring order and complete in same order,
+// so frames are written in order they were captured. WRITING is owned by
+// worker thread, others by thread, which owns OpenGL context. [2025/11/23]
+typedef enum {
+    GL_FRAME_CAPTURE_SLOT_FREE,
+    GL_FRAME_CAPTURE_SLOT_READING, // Waits for fence of `glReadPixels`.
+    GL_FRAME_CAPTURE_SLOT_WRITING, // Worker writes mapped pixels to file.
+    GL_FRAME_CAPTURE_SLOT_WRITTEN, // Waits for unmap.
+    GL_FRAME_CAPTURE_SLOT_FAILED,  // Same as WRITTEN, but file wasn't written.
+} GLFrameCaptureSlotState;
+
+typedef struct {
+    volatile u32 state; // GLFrameCaptureSlotState.
+
+    u32 buffer;
+    void *fence; // GLsync.
+    const void *pixels; // Mapped buffer, valid while writing.
+
+    u32 frameIndex;
+    u32 width;
+    u32 height;
+} GLFrameCaptureSlot;
+
+typedef struct {
+    u32 capturedCount; // Frames read into slots.
+    u32 droppedCount;  // Frames skipped, because all slots were busy.
+    u32 writtenCount;
+    u32 failedCount;
+    usize writtenBytes;
+} GLFrameCaptureStats;
+
+/*
+ * @breaf Reads frames back without stalling. Pixels are read into pixel
+ * buffer objects, mapped when GPU is done with them and written to files on
+ * worker thread.
+ */
+typedef struct {
+    GLFrameCaptureSlot slots[GL_FRAME_CAPTURE_SLOT_COUNT];
+    u32 slotsBegun;  // Slots, which got `glReadPixels`.
+    u32 slotsMapped; // Slots, which were handed to worker.
+
+    GLFrameCaptureFormat format;
+    char8 filePathPrefix[GL_FRAME_CAPTURE_PATH_CAPACITY];
+    FileHandle *rawFile; // Only for `GL_FRAME_CAPTURE_FORMAT_RAW`.
+
+    // NOTE(gr3yknigh1): Single producer, single consumer queue of indexes in
+    // `slots`, same as in texture streamer. [2025/11/23]
+    u32 jobs[GL_FRAME_CAPTURE_SLOT_COUNT];
+    volatile u32 jobsPushed; // Written by OpenGL thread only.
+    volatile u32 jobsPopped; // Written by worker thread only.
+    volatile u32 isStopping;
+    Semaphore *jobReady; // Signaled once per job and on destroy.
+    Thread *worker;
+    Scratch workerArena; // Owned by worker thread.
+
+    GLFrameCaptureStats stats;
+} GLFrameCapture;
+
+/*
+ * @breaf Allocates capture, creates it's pixel buffers and starts worker
+ * thread. Must be called on thread with current OpenGL context.
+ *
+ * @return `NULL` if memory, thread or output file can't be acquired.
+ */
+GFS_API GLFrameCapture *GLFrameCaptureMake(
+    Scratch *scratch, GLFrameCaptureFormat format, cstring8 filePathPrefix);
+
+/*
+ * @breaf Reads color of `framebuffer` (0 is default one) into free slot.
+ * Call before swapping buffers. Binding of read framebuffer is restored.
+ *
+ * @return `false` if frame was dropped, because all slots are busy.
+ */
+GFS_API bool GLCaptureFrame(
+    GLFrameCapture *capture, u32 framebuffer, u32 width, u32 height);
+
+/*
+ * @breaf Maps slots, which GPU is done with, hands them to worker and unmaps
+ * written ones. Call once per frame on thread with current OpenGL context.
+ */
+GFS_API void GLFrameCaptureUpdate(GLFrameCapture *capture);
+
+/*
+ * @breaf Waits until every captured frame is written, joins worker thread and
+ * deletes pixel buffers.
+ */
+GFS_API void GLFrameCaptureDestroy(GLFrameCapture *capture);
+
+#endif // GFS_FRAME_CAPTURE_H_INCLUDED
@@ -0,0 +1,157 @@
+#if !defined(GFS_FRAME_PIPELINE_H_INCLUDED)
+/*
+ * FILE      gfs\code\gfs\include\gfs\frame_pipeline.h
+ * AUTHOR    Ilya Akkuzin <gr3yknigh1@gmail.com>
+ * COPYRIGHT (c) 2025 Ilya Akkuzin
+ * */
+#define GFS_FRAME_PIPELINE_H_INCLUDED
+
+#include "gfs/types.h"
+#include "gfs/macros.h"
+#include "gfs/memory.h"
+#include "gfs/platform.h"
+
+/*
+ * @breaf Upper bound of frames in flight between simulation and render
+ * threads.
+ */
+#define FRAME_PIPELINE_MAX_DEPTH EXPAND(3)
+
+/*
+ * @breaf Count of frames, over which `FramePipelineStats` are averaged.
+ */
+#define FRAME_PIPELINE_STATS_FRAME_COUNT EXPAND(60)
+
+/*
+ * @breaf Called on render thread once before first frame and once after last
+ * one. It's the place to make OpenGL context current on render thread and to
+ * release it back.
+ */
+typedef void FramePipelineThreadProc(void *parameter);
+
+/*
+ * @breaf Called on render thread for every frame with snapshot, which
+ * simulation thread filled in between `FramePipelineBeginFrame` and
+ * `FramePipelineEndFrame`.
+ */
+typedef void FramePipelineRenderProc(
+    const void *snapshot, u64 frameIndex, void *parameter);
+
+typedef struct {
+    usize snapshotSize;
+
+    // NOTE(gr3yknigh1): Max count of frames simulated, but not yet rendered.
+    // 1 - simulation and rendering never overlap, lowest latency. 2 - frame
+    // N+1 is simulated while frame N is rendered. Bigger depth smooths
+    // hitches, but every frame adds latency. [2025/11/23]
+    u32 depth;
+
+    FramePipelineThreadProc *renderThreadBegin; // Optional.
+    FramePipelineRenderProc *render;
+    FramePipelineThreadProc *renderThreadEnd; // Optional.
+    void *parameter;
+} FramePipelineSettings;
+
+/*
+ * @breaf Averaged timings of last `FRAME_PIPELINE_STATS_FRAME_COUNT` frames.
+ */
+typedef struct {
+    u32 depth;
+    u64 frameCount;
+
+    f32 simulationMilliseconds;     // Between begin and end of frame.
+    f32 simulationWaitMilliseconds; // Waiting in `FramePipelineBeginFrame`.
+    f32 renderMilliseconds;         // Inside of render proc.
+    f32 frameMilliseconds;          // Between ends of two rendered frames.
+
+    // NOTE(gr3yknigh1): From begin of simulation to end of render of the same
+    // frame, includes time snapshot waited in queue. [2025/11/23]
+    f32 latencyMilliseconds;
+
+    // NOTE(gr3yknigh1): Time simulation of the frame ran in parallel with
+    // rendering of previous frames. Zero means no pipelining. [2025/11/23]
+    f32 overlapMilliseconds;
+} FramePipelineStats;
+
+typedef struct {
+    u64 simulationBegin;
+    u64 simulationEnd;
+    u64 simulationWait;
+    u64 renderBegin;
+    u64 renderEnd;
+} FramePipelineFrameTiming;
+
+typedef struct {
+    u32 frameCount;
+    u64 simulation;
+    u64 simulationWait;
+    u64 render;
+    u64 frame;
+    u64 latency;
+    u64 overlap;
+} FramePipelineStatsAccumulator;
+
+typedef struct {
+    FramePipelineSettings settings;
+
+    byte *snapshots; // FRAME_PIPELINE_MAX_DEPTH slots of `snapshotStride`.
+    usize snapshotStride;
+    FramePipelineFrameTiming timings[FRAME_PIPELINE_MAX_DEPTH];
+
+    volatile u32 depth;
+    volatile u32 producedCount; // Written by simulation thread only.
+    volatile u32 consumedCount; // Written by render thread only.
+    bool isFrameBegun;
+
+    Semaphore *frameReady; // Signaled once per produced frame and on destroy.
+    Semaphore *frameDone;  // Signaled once per consumed frame.
+    Thread *renderThread;
+
+    // NOTE(gr3yknigh1): Owned by render thread. Stats are published through
+    // two buffers, so reader never sees half-written one. [2025/11/23]
+    FramePipelineFrameTiming renderHistory[FRAME_PIPELINE_MAX_DEPTH];
+    FramePipelineStatsAccumulator accumulator;
+    FramePipelineStats stats[2];
+    volatile u32 statsVersion;
+    u64 frequency;
+} FramePipeline;
+
+/*
+ * @breaf Allocates pipeline and starts it's render thread.
+ *
+ * @return `NULL` if memory or thread can't be acquired.
+ */
+GFS_API FramePipeline *
+FramePipelineMake(Scratch *scratch, const FramePipelineSettings *settings);
+
+/*
+ * @breaf Blocks simulation thread while `depth` frames are in flight, then
+ * returns snapshot slot of next frame to fill.
+ */
+GFS_API void *FramePipelineBeginFrame(FramePipeline *pipeline);
+
+/*
+ * @breaf Hands snapshot, returned by `FramePipelineBeginFrame`, to render
+ * thread.
+ */
+GFS_API void FramePipelineEndFrame(FramePipeline *pipeline);
+
+/*
+ * @breaf Changes count of frames in flight. Clamped to
+ * [1, FRAME_PIPELINE_MAX_DEPTH]. Takes effect on next
+ * `FramePipelineBeginFrame`.
+ */
+GFS_API void FramePipelineSetDepth(FramePipeline *pipeline, u32 depth);
+
+/*
+ * @breaf Returns last published stats. Safe to call from any thread.
+ */
+GFS_API FramePipelineStats FramePipelineGetStats(FramePipeline *pipeline);
+
+/*
+ * @breaf Waits until all produced frames are rendered and joins render
+ * thread.
+ */
+GFS_API void FramePipelineDestroy(FramePipeline *pipeline);
+
+#endif // GFS_FRAME_PIPELINE_H_INCLUDED
@@ -0,0 +1,119 @@
+#if !defined(GFS_JOB_H_INCLUDED)
+/*
+ * FILE      gfs\code\gfs\include\gfs\job.h
+ * AUTHOR    Ilya Akkuzin <gr3yknigh1@gmail.com>
+ * COPYRIGHT (c) 2025 Ilya Akkuzin
+ * */
+#define GFS_JOB_H_INCLUDED
+
+#include "gfs/types.h"
+#include "gfs/macros.h"
+#include "gfs/memory.h"
+#include "gfs/platform.h"
+
+/*
+ * @breaf Upper bound of `JobSystem` worker threads.
+ */
+#define JOB_SYSTEM_MAX_WORKERS EXPAND(64)
+
+#define JOB_DEPENDENT_NONE EXPAND(0xFFFFFFFFu)
+
+typedef void JobProc(void *parameter);
+
+typedef u32 JobID; // Index of job in graph, valid until `JobSystemWait`.
+
+typedef struct {
+    JobProc *proc;
+    void *parameter;
+
+    // NOTE(gr3yknigh1): Unfinished dependencies plus one, which is released
+    // by `JobSystemStart`. Whoever drops it to zero pushes the job, so it's
+    // pushed exactly once. [2025/11/23]
+    volatile u32 pendingCount;
+    u32 firstDependent; // Index in `dependents` or `JOB_DEPENDENT_NONE`.
+} Job;
+
+typedef struct {
+    JobID job;
+    u32 next; // Next dependent of same job or `JOB_DEPENDENT_NONE`.
+} JobDependent;
+
+/*
+ * @breaf Runs graph of jobs on pool of worker threads. Graph is built with
+ * `JobSystemAdd` and `JobSystemAddDependency`, started with `JobSystemStart`
+ * and cleared with `JobSystemWait`. Job runs after all of it's dependencies
+ * are finished, order of independent jobs isn't defined.
+ */
+typedef struct {
+    Job *jobs;
+    u32 jobCapacity;
+    u32 jobCount;
+
+    JobDependent *dependents;
+    u32 dependentCapacity;
+    u32 dependentCount;
+
+    // NOTE(gr3yknigh1): Multiple producer, multiple consumer queue of job
+    // index plus one, zero means slot isn't published yet. Every job is
+    // pushed once per run, so it has `jobCapacity` slots and never wraps.
+    // [2025/11/23]
+    volatile u32 *ready;
+    volatile u32 readyPushed;
+    volatile u32 readyPopped;
+    volatile u32 finishedCount;
+    volatile u32 isStopping;
+
+    Semaphore *jobReady;      // Signaled once per pushed job and on destroy.
+    Semaphore *graphFinished; // Signaled once per run by last job.
+
+    Thread *workers[JOB_SYSTEM_MAX_WORKERS];
+    u32 workerCount;
+    bool isStarted;
+} JobSystem;
+
+/*
+ * @breaf Allocates system and starts `workerCount` worker threads. With zero
+ * workers jobs are run by thread, which calls `JobSystemWait`.
+ *
+ * @return `NULL` if memory or semaphores can't be acquired. If some of
+ * threads can't be started, system keeps fewer workers.
+ */
+GFS_API JobSystem *JobSystemMake(
+    Scratch *scratch, u32 workerCount, u32 jobCapacity,
+    u32 dependentCapacity);
+
+/*
+ * @breaf Adds job to graph. Must not be called while graph is running.
+ */
+GFS_API JobID JobSystemAdd(JobSystem *system, JobProc *proc, void *parameter);
+
+/*
+ * @breaf Makes `job` wait until `dependency` is finished. Must not be called
+ * while graph is running.
+ */
+GFS_API void
+JobSystemAddDependency(JobSystem *system, JobID job, JobID dependency);
+
+/*
+ * @breaf Hands jobs without dependencies to workers and returns right away.
+ */
+GFS_API void JobSystemStart(JobSystem *system);
+
+/*
+ * @breaf Checks whether every job of started graph is finished. Graph still
+ * must be cleared with `JobSystemWait`.
+ */
+GFS_API bool JobSystemIsDone(JobSystem *system);
+
+/*
+ * @breaf Blocks until every job of started graph is finished and clears
+ * graph. Results of jobs are visible to calling thread after it returns.
+ */
+GFS_API void JobSystemWait(JobSystem *system);
+
+/*
+ * @breaf Joins worker threads. Graph must not be running.
+ */
+GFS_API void JobSystemDestroy(JobSystem *system);
+
+#endif // GFS_JOB_H_INCLUDED
@@ -105,6 +105,10 @@ typedef struct {
 
 // FileOpenResult FileOpen(cstring8 filePath);
 
+/*
+ * @breaf Opens file. With only `PERMISSION_WRITE` file is created, or
+ * truncated if it already exists.
+ */
 GFS_API FileOpenResult
 FileOpenEx(cstring8 filePath, Scratch *allocator, Permissions permissions);
 
@@ -131,6 +135,17 @@ GFS_API FileLoadResultCode FileLoadToBufferEx(
 
 GFS_API usize FileGetSize(FileHandle *handle);
 
+typedef enum {
+    FILE_WRITE_OK,
+    FILE_WRITE_ERR,
+} FileWriteResultCode;
+
+/*
+ * @breaf Writes whole buffer at current cursor of file.
+ */
+GFS_API FileWriteResultCode
+FileWrite(FileHandle *handle, const void *buffer, usize numberOfBytesToWrite);
+
 typedef enum {
     FILE_SET_CURSOR_OK,
     FILE_SET_CURSOR_FAILED,
@@ -181,6 +196,13 @@ GFS_API RectangleI32 WindowGetRectangle(Window *window);
  * */
 GFS_API void PoolEvents(Window *window);
 
+/*
+ * @breaf Binds window's OpenGL context to calling thread, or unbinds it if
+ * `isCurrent` is false. Context can be current only on one thread at a time,
+ * so it should be unbound before handing it to another thread.
+ */
+GFS_API void WindowSetContextCurrent(Window *window, bool isCurrent);
+
 /*
  * @breaf Returns platform's pagesize.
  * */
@@ -206,6 +228,13 @@ GFS_API MemoryFreeResultCode MemoryFree(void *data, usize size);
  */
 GFS_API bool IsPathExists(cstring8 path);
 
+/*
+ * @breaf Creates directory. Parent directory should exist.
+ *
+ * @return `true` if directory was created or already exists.
+ */
+GFS_API bool MakeDirectory(cstring8 path);
+
 /*
  * @breaf Initializes `SoundOutput` struct with default values.
  *
@@ -237,6 +266,82 @@ GFS_API void SoundDevicePlay(SoundDevice *device);
 
 GFS_API void SoundDeviceClose(SoundDevice *device);
 
+/*
+ * @breaf Actual platform-dependend thread represantation.
+ */
+typedef struct Thread Thread;
+
+typedef void ThreadProc(void *parameter);
+
+/*
+ * @breaf Starts new thread, which calls `proc` with `parameter`.
+ */
+GFS_API Thread *
+ThreadCreate(Scratch *scratch, ThreadProc *proc, void *parameter);
+
+/*
+ * @breaf Waits until thread is finished and releases it's handle.
+ */
+GFS_API void ThreadJoin(Thread *thread);
+
+/*
+ * @breaf Returns count of logical processors.
+ */
+GFS_API u32 GetProcessorCount(void);
+
+/*
+ * @breaf Atomically adds `addend` to `value`.
+ *
+ * @return Value before addition.
+ */
+GFS_API u32 AtomicFetchAddU32(volatile u32 *value, u32 addend);
+
+/*
+ * @breaf Atomically loads `value`.
+ */
+GFS_API u32 AtomicLoadU32(volatile u32 *value);
+
+/*
+ * @breaf Atomically stores `newValue` to `value`.
+ */
+GFS_API void AtomicStoreU32(volatile u32 *value, u32 newValue);
+
+/*
+ * @breaf Actual platform-dependend counting semaphore.
+ */
+typedef struct Semaphore Semaphore;
+
+/*
+ * @breaf Creates semaphore with `initialCount` free units.
+ */
+GFS_API Semaphore *SemaphoreCreate(Scratch *scratch, u32 initialCount);
+
+/*
+ * @breaf Blocks calling thread until semaphore has free unit and takes it.
+ */
+GFS_API void SemaphoreWait(Semaphore *semaphore);
+
+/*
+ * @breaf Releases one unit, waking up one of waiting threads.
+ */
+GFS_API void SemaphoreSignal(Semaphore *semaphore);
+
+/*
+ * @breaf Releases OS resources of semaphore. Memory stays in scratch.
+ */
+GFS_API void SemaphoreDestroy(Semaphore *semaphore);
+
+/*
+ * @breaf Monotonic high resolution clock, which is safe to compare between
+ * threads. See `GetPerformanceFrequency` for ticks per second.
+ */
+GFS_API u64 GetPerformanceCounter(void);
+
+/*
+ * @breaf Ticks per second of `GetPerformanceCounter`.
+ */
+GFS_API u64 GetPerformanceFrequency(void);
+
 /*
  * @breaf Puts whole null terminated string to stdout.
  *
@@ -0,0 +1,87 @@
+#if !defined(GFS_PROFILER_H_INCLUDED)
+/*
+ * FILE      gfs\code\gfs\include\gfs\profiler.h
+ * AUTHOR    Ilya Akkuzin <gr3yknigh1@gmail.com>
+ * COPYRIGHT (c) 2025 Ilya Akkuzin
+ * */
+#define GFS_PROFILER_H_INCLUDED
+
+#include "gfs/types.h"
+#include "gfs/macros.h"
+#include "gfs/memory.h"
+
+/*
+ * @breaf Returned by `ProfilerBeginScope`, when nothing is captured.
+ */
+#define PROFILER_INVALID_SCOPE EXPAND(0xFFFFFFFF)
+
+/*
+ * @breaf Timeline, event belongs to. Each one is separate row in capture.
+ */
+typedef enum {
+    PROFILER_TRACK_CPU,
+    PROFILER_TRACK_GPU,
+    PROFILER_TRACK_COUNT,
+} ProfilerTrack;
+
+typedef struct {
+    cstring8 name; // Must outlive capture.
+    u32 track;     // ProfilerTrack.
+    u64 beginNanoseconds;
+    u64 durationNanoseconds;
+} ProfilerEvent;
+
+/*
+ * @breaf Collects timed scopes of CPU and GPU on one timeline, which starts at
+ * `ProfilerMake`. Events are kept only while capture is running. Not thread
+ * safe, scopes are expected on thread with OpenGL context.
+ */
+typedef struct {
+    ProfilerEvent *events;
+    u32 eventCount;
+    u32 eventCapacity;
+    u32 droppedCount; // Events, which didn't fit in capacity.
+
+    bool isCapturing;
+    u64 originCounter;
+    u64 frequency;
+} Profiler;
+
+GFS_API Profiler ProfilerMake(Scratch *scratch, u32 eventCapacity);
+
+/*
+ * @breaf Nanoseconds since `ProfilerMake`.
+ */
+GFS_API u64 ProfilerGetNanoseconds(const Profiler *profiler);
+
+/*
+ * @breaf Drops events of previous capture and starts collecting new ones.
+ */
+GFS_API void ProfilerBeginCapture(Profiler *profiler);
+
+/*
+ * @breaf Stops collecting and writes events to `filePath` in Chrome trace
+ * event format (open in `chrome://tracing` or Perfetto).
+ *
+ * @return `false` if file can't be written.
+ */
+GFS_API bool
+ProfilerEndCapture(Profiler *profiler, Scratch *scratch, cstring8 filePath);
+
+/*
+ * @breaf Records already measured event.
+ */
+GFS_API void ProfilerPushEvent(
+    Profiler *profiler, ProfilerTrack track, cstring8 name,
+    u64 beginNanoseconds, u64 durationNanoseconds);
+
+/*
+ * @breaf Opens CPU scope. Scopes may nest.
+ *
+ * @return Handle for `ProfilerEndScope`.
+ */
+GFS_API u32 ProfilerBeginScope(Profiler *profiler, cstring8 name);
+
+GFS_API void ProfilerEndScope(Profiler *profiler, u32 scope);
+
+#endif // GFS_PROFILER_H_INCLUDED
@@ -7,8 +7,12 @@
 #define GFS_RENDER_H_INCLUDED
 
 #include "gfs/types.h"
+#include "gfs/macros.h"
+#include "gfs/memory.h"
 #include "gfs/physics.h"
 #include "gfs/platform.h"
+#include "gfs/job.h"
+#include "gfs/render_opengl.h"
 
 // NOTE(ilya.a): Ordered according to GDI requirements.
 // TODO(ilya.a): Replace ordering with RGA order.
@@ -38,43 +42,211 @@ const extern Color4RGBA COLOR4RGBA_RED;
 const extern Color4RGBA COLOR4RGBA_GREEN;
 const extern Color4RGBA COLOR4RGBA_BLUE;
 
-#if 0
+/*
+ * @breaf 64 bit key by which render commands are ordered before execution.
+ *
+ * From most significant to least significant bits:
+ *
+ *   [63..56] pass    - Passes are executed in order (opaque, text, ...).
+ *   [55..44] shader  - Low 12 bits of program id.
+ *   [43..32] texture - Low 12 bits of texture id.
+ *   [31..00] depth   - Quantized distance, see `RenderSortKeyDepth`.
+ *
+ * Ids are truncated, so different programs might get the same bits. This only
+ * makes sorting less effective, commands always carry their full state.
+ */
+typedef u64 RenderSortKey;
+
+#define RENDER_SORT_KEY_PASS_SHIFT 56
+#define RENDER_SORT_KEY_SHADER_SHIFT 44
+#define RENDER_SORT_KEY_TEXTURE_SHIFT 32
+
+#define RENDER_SORT_KEY_PASS_MASK 0xFF
+#define RENDER_SORT_KEY_SHADER_MASK 0xFFF
+#define RENDER_SORT_KEY_TEXTURE_MASK 0xFFF
+
+GFS_API RenderSortKey RenderSortKeyMake(
+    u32 pass, GLShaderProgramID shader, GLTexture texture, u32 depth);
+
+/*
+ * @breaf Quantizes `distance` in range [0, `maxDistance`] into depth bits of
+ * sort key. Invert result (`~depth`) to get back-to-front order.
+ */
+GFS_API u32 RenderSortKeyDepth(f32 distance, f32 maxDistance);
+
+#define RENDER_DATA_TEXTURE_UNIT EXPAND(1)
+
+/*
+ * @breaf Indexed draw with all state it needs. Draws `elementCount` elements
+ * of `elementBuffer`, starting from `firstElement`.
+ */
+typedef struct {
+    GLShaderProgramID shader;
+    u32 textureTarget; // Zero if command doesn't sample texture.
+    GLTexture texture; // Bound to unit 0.
+
+    // NOTE(gr3yknigh1): Per-draw data, which shader fetches by itself, like
+    // buffer texture of vertex pulling. Doesn't take part in sort key.
+    // [2025/11/23]
+    u32 dataTextureTarget; // Zero if command has no data texture.
+    GLTexture dataTexture; // Bound to unit `RENDER_DATA_TEXTURE_UNIT`.
+    GLVertexArray vertexArray;
+    u32 elementBuffer;
+    u32 elementType; // Zero means GL_UNSIGNED_INT.
+    u32 firstElement;
+    u32 elementCount;
+    u32 instanceCount; // Zero for non-instanced draw.
+
+    // NOTE(gr3yknigh1): Uploaded to `Draw` uniform block right before the
+    // draw call. [2025/11/16]
+    bool hasDrawBlock;
+    GLDrawBlock drawBlock;
+} RenderCommand;
 
 /*
- * @breaf Actual BitMap Renderer Renderer.
+ * @breaf Upload of CPU data into GL buffer. All uploads of submit are executed
+ * before its draws.
  */
 typedef struct {
-    Color4BGRA clearColor;
+    u32 target;
+    u32 buffer;
+    const void *data; // Must stay valid until submit.
+    usize size;
+} RenderUpload;
 
-    struct {
-        u8 *begin;
-        u8 *end;
-    } commandQueue;
+typedef struct {
+    RenderSortKey key;
+    const RenderCommand *command;
+} RenderQueueEntry;
+
+typedef struct {
     u64 commandCount;
+    u64 uploadCount;
+    u64 drawCallCount;
+    // NOTE(gr3yknigh1): Changes of program, texture and vertex array, which
+    // would be made if commands were executed in order of recording and in
+    // sorted order. [2025/11/16]
+    u64 stateChangesUnsorted;
+    u64 stateChangesSorted;
+} RenderQueueStats;
 
-    Window *window;
-} Renderer;
+/*
+ * @breaf Queue of draw commands. Commands are recorded during the frame,
+ * sorted by key with radix sort and executed on `RenderQueueSubmit`.
+ *
+ * Commands with equal keys are executed in order of recording.
+ */
+typedef struct {
+    RenderCommand *commands; // Storage of `RenderQueuePush`.
+    u32 commandCount;
 
-typedef enum {
-    BMR_RENDER_COMMAND_TYPE_NOP = 00,
-    BMR_RENDER_COMMAND_TYPE_CLEAR = 01,
-    BMR_RENDER_COMMAND_TYPE_RECT = 11,
-    BMR_RENDER_COMMAND_TYPE_GRADIENT = 20,
-} RenderCommandType;
+    RenderQueueEntry *entries;
+    RenderQueueEntry *entriesTemp; // Radix sort ping-pong buffer.
+    u32 count;
+    u32 capacity;
 
-Renderer RendererMake(Window *window, Color4BGRA clearColor);
-void RendererDestroy(Renderer *renderer);
+    RenderUpload *uploads;
+    u32 uploadCount;
+    u32 uploadCapacity;
 
-void BeginDrawing(Renderer *renderer);
-void EndDrawing(Renderer *renderer);
+    RenderQueueStats stats; // Accumulated until `RenderQueueResetStats`.
+} RenderQueue;
 
-void ClearBackground(Renderer *renderer);
+GFS_API RenderQueue RenderQueueMake(Scratch *scratch, u32 capacity);
+GFS_API RenderQueue
+RenderQueueMakeEx(Scratch *scratch, u32 capacity, u32 uploadCapacity);
 
-void DrawRectangle(Renderer *renderer, u32 x, u32 y, u32 w, u32 h, Color4BGRA c);
-void DrawRectangleRec(Renderer *renderer, RectangleU16 r, Color4BGRA c);
+GFS_API bool RenderQueueIsFull(const RenderQueue *queue);
 
-void DrawGradient(Renderer *renderer, u32 xOffset, u32 yOffset);
+/*
+ * @breaf Records new command with `key`.
+ *
+ * @return Zeroed command, which caller fills. Pointer is valid until
+ * `RenderQueueSubmit`. Queue must not be full.
+ */
+GFS_API RenderCommand *RenderQueuePush(RenderQueue *queue, RenderSortKey key);
+
+GFS_API void RenderQueuePushUpload(
+    RenderQueue *queue, u32 target, u32 buffer, const void *data, usize size);
+
+/*
+ * @breaf Sorts recorded commands by key. Called by `RenderQueueSubmit`.
+ */
+GFS_API void RenderQueueSort(RenderQueue *queue);
 
-#endif // 0
+/*
+ * @breaf Executes uploads, then sorts and executes all recorded commands and
+ * empties the queue. Draw blocks are pushed through `drawRing`, which may be
+ * NULL if no command has one.
+ */
+GFS_API void RenderQueueSubmit(RenderQueue *queue, GLUniformRing *drawRing);
+
+GFS_API void RenderQueueResetStats(RenderQueue *queue);
+
+/*
+ * @breaf Commands and uploads recorded by one thread. Storage is allocated
+ * from arena of that thread, so recording threads don't share any memory.
+ * Doesn't touch GL, so it can be filled from any thread.
+ */
+typedef struct {
+    RenderSortKey *keys;
+    RenderCommand *commands;
+    u32 count;
+    u32 capacity;
+
+    RenderUpload *uploads;
+    u32 uploadCount;
+    u32 uploadCapacity;
+} RenderCommandBuffer;
+
+GFS_API RenderCommandBuffer RenderCommandBufferMake(
+    Scratch *arena, u32 capacity, u32 uploadCapacity);
+
+GFS_API void RenderCommandBufferReset(RenderCommandBuffer *buffer);
+
+/*
+ * @breaf Same as `RenderQueuePush`, but for command buffer.
+ */
+GFS_API RenderCommand *
+RenderCommandBufferPush(RenderCommandBuffer *buffer, RenderSortKey key);
+
+GFS_API void RenderCommandBufferPushUpload(
+    RenderCommandBuffer *buffer, u32 target, u32 glBuffer, const void *data,
+    usize size);
+
+/*
+ * @breaf Appends commands and uploads of `buffers` to the queue, in order of
+ * buffers. Commands are not copied, so buffers must not be reset until queue
+ * is submitted.
+ *
+ * With stable sort it makes order of execution deterministic: it depends
+ * only on what each buffer recorded, not on timing of recording threads.
+ */
+GFS_API void RenderQueueMerge(
+    RenderQueue *queue, const RenderCommandBuffer *buffers, u32 buffersCount);
+
+/*
+ * @breaf Upper bound of `RenderRecordParallel` workers.
+ */
+#define RENDER_RECORD_MAX_WORKERS EXPAND(16)
+
+/*
+ * @breaf Fills `buffer` with share `workerIndex` of `workerCount`.
+ */
+typedef void RenderRecordProc(
+    RenderCommandBuffer *buffer, u32 workerIndex, u32 workerCount,
+    void *parameter);
+
+/*
+ * @breaf Resets `buffers` and calls `proc` for each of them in parallel.
+ * Calling thread records buffer 0, others are recorded as jobs of `jobs`.
+ * Returns after all buffers are recorded.
+ *
+ * `jobs` must not be running other graph and must fit `workerCount - 1`
+ * jobs. `proc` must not call GL, uploads should be recorded instead.
+ */
+GFS_API void RenderRecordParallel(
+    JobSystem *jobs, RenderCommandBuffer *buffers, u32 workerCount,
+    RenderRecordProc *proc, void *parameter);
 
 #endif // GFS_RENDER_H_INCLUDED
@@ -10,6 +10,7 @@
 #include "gfs/macros.h"
 #include "gfs/memory.h"
 #include "gfs/bmp.h"
+#include "gfs/profiler.h"
 
 typedef union {
     struct {
@@ -35,17 +36,27 @@ typedef struct {
 
 typedef u32 GLIndexBuffer;
 
+/*
+ * @breaf How attribute components are read by vertex shader.
+ */
+typedef enum {
+    GL_ATTRIBUTE_MODE_FLOAT,      // Converted to float as is: 255 -> 255.0.
+    GL_ATTRIBUTE_MODE_NORMALIZED, // Mapped to [0, 1] ([-1, 1] if signed).
+    GL_ATTRIBUTE_MODE_INTEGER,    // Stays integer: `uint`, `ivec3` and etc.
+} GLAttributeMode;
+
 typedef struct {
-    bool isNormalized; // I don't like this bool
+    GLAttributeMode mode;
     u32 type;
     u32 count;
-    usize size;
+    usize size; // Size of whole attribute in bytes.
 } GLAttribute;
 
 typedef struct {
     u32 id;
-    const u32 *elements;
+    const void *elements;
     u32 count;
+    u32 indexType; // GL_UNSIGNED_INT or GL_UNSIGNED_SHORT.
 } GLElementBuffer;
 
 typedef struct {
@@ -55,8 +66,22 @@ typedef struct {
     u32 attributesCount;
 
     u32 stride;
+
+    // NOTE(gr3yknigh1): Zero for per-vertex data. Otherwise attributes of
+    // this layout advance once per `divisor` instances. [2025/11/12]
+    u32 divisor;
 } GLVertexBufferLayout;
 
+/*
+ * @breaf Buffer with per-instance attributes.
+ */
+typedef struct {
+    u32 id;
+    const void *data;
+    usize size;
+    u32 count;
+} GLInstanceBuffer;
+
 typedef enum {
     COLOR_LAYOUT_RGB,
     COLOR_LAYOUT_RGBA,
@@ -98,15 +123,35 @@ GFS_API Mesh *GLGetCubeMesh(
     Scratch *scratch, GLVertexesOrientation orientation);
 
 GFS_API GLVertexArray GLVertexArrayMake(void);
+GFS_API void GLVertexArrayDestroy(GLVertexArray va);
 GFS_API void GLVertexArrayAddBuffer(
     GLVertexArray va, const GLVertexBuffer *vb,
     const GLVertexBufferLayout *layout);
 
+/*
+ * @breaf Attaches per-instance buffer to vertex array.
+ *
+ * @param firstAttributeIndex Attribute location of first attribute in
+ * `layout`. Should go after all per-vertex attributes of `va`.
+ */
+GFS_API void GLVertexArrayAddInstanceBuffer(
+    GLVertexArray va, const GLInstanceBuffer *ib,
+    const GLVertexBufferLayout *layout, u32 firstAttributeIndex);
+
 GFS_API GLVertexBuffer
 GLVertexBufferMake(const void *dataBuffer, usize dataBufferSize);
 
 GFS_API void GLVertexBufferSendData(
     GLVertexBuffer *buffer, const void *dataBuffer, usize dataBufferSize);
+GFS_API void GLVertexBufferDestroy(GLVertexBuffer *buffer);
+
+GFS_API GLInstanceBuffer GLInstanceBufferMake(
+    const void *dataBuffer, usize dataBufferSize, u32 instanceCount);
+
+GFS_API void GLInstanceBufferSendData(
+    GLInstanceBuffer *buffer, const void *dataBuffer, usize dataBufferSize,
+    u32 instanceCount);
+GFS_API void GLInstanceBufferDestroy(GLInstanceBuffer *buffer);
 
 /*
  * @breaf Naive wrapper around element buffer.
@@ -127,22 +172,113 @@ GFS_API GLElementBuffer GLElementBufferMake(const u32 *indicies, u64 count);
 
 GFS_API void GLElementBufferSendData(
     GLElementBuffer *buffer, const u32 *indicies, u64 count);
+GFS_API void GLElementBufferDestroy(GLElementBuffer *buffer);
+
+/*
+ * @breaf Makes static element buffer for `quadCount` quads. Each quad is
+ * expected to be 4 vertexes (top-right, bottom-right, bottom-left, top-left),
+ * which produces indicies {0, 1, 2, 0, 2, 3} shifted by 4 for every next quad.
+ *
+ * Indicies are allocated on `scratch`, so buffer can be shared by any batch,
+ * which emits quads in that order.
+ */
+GFS_API GLElementBuffer
+GLElementBufferMakeQuads(Scratch *scratch, u32 quadCount);
+
+/*
+ * @breaf Same as `GLElementBufferMake`, but with 16-bit indicies. Halves
+ * index memory, but vertex count of a draw is limited by
+ * `GL_ELEMENT_U16_MAX_VERTEX_COUNT`.
+ */
+GFS_API GLElementBuffer GLElementBufferMakeU16(const u16 *elements, u64 count);
+
+#define GL_ELEMENT_U16_MAX_VERTEX_COUNT EXPAND(65536)
+
+/*
+ * @breaf Same as `GLElementBufferMakeQuads`, but with 16-bit indicies. At most
+ * `GL_ELEMENT_U16_MAX_VERTEX_COUNT / 4` quads.
+ */
+GFS_API GLElementBuffer
+GLElementBufferMakeQuadsU16(Scratch *scratch, u32 quadCount);
+
+/*
+ * @breaf Size of one index of `indexType` in bytes.
+ */
+GFS_API usize GLIndexTypeGetSize(u32 indexType);
 
 GFS_API GLVertexBufferLayout GLVertexBufferLayoutMake(Scratch *scratch);
 
+/*
+ * @breaf Same as `GLVertexBufferLayoutMake`, but attributes will be advanced
+ * per instance instead of per vertex.
+ *
+ * @param divisor Count of instances which share same attribute values. Zero
+ * means per-vertex layout.
+ */
+GFS_API GLVertexBufferLayout
+GLVertexBufferLayoutMakeEx(Scratch *scratch, u32 divisor);
+
 GFS_API void GLVertexBufferLayoutPushAttributeF32(
     GLVertexBufferLayout *layout, u32 count);
 
+/*
+ * @breaf Pushes attribute of `count` unsigned bytes.
+ *
+ * NOTE(gr3yknigh1): `GL_ATTRIBUTE_MODE_INTEGER` attributes are set with
+ * `glVertexAttribIPointer` and must be declared as `uint`/`uvec*` in shader.
+ * [2025/11/23]
+ */
+GFS_API void GLVertexBufferLayoutPushAttributeU8(
+    GLVertexBufferLayout *layout, u32 count, GLAttributeMode mode);
+GFS_API void GLVertexBufferLayoutPushAttributeU16(
+    GLVertexBufferLayout *layout, u32 count, GLAttributeMode mode);
+GFS_API void GLVertexBufferLayoutPushAttributeI32(
+    GLVertexBufferLayout *layout, u32 count, GLAttributeMode mode);
+
+/*
+ * @breaf Pushes four components packed into 32 bits: x, y and z take 10 bits,
+ * w takes 2 bits. Suits normals and tangents.
+ *
+ * @param mode Either `GL_ATTRIBUTE_MODE_FLOAT` or
+ * `GL_ATTRIBUTE_MODE_NORMALIZED`, OpenGL has no integer packed attributes.
+ */
+GFS_API void GLVertexBufferLayoutPushAttributePacked1010102(
+    GLVertexBufferLayout *layout, bool isSigned, GLAttributeMode mode);
+
 GFS_API void GLClear(f32 r, f32 g, f32 b, f32 a);
 GFS_API void GLClearEx(f32 r, f32 g, f32 b, f32 a, i32 clearMask);
 
 GFS_API void GLDrawElements(
     const GLElementBuffer *eb, const GLVertexBuffer *vb, GLVertexArray va);
+
+/*
+ * @breaf Draws `elementCount` elements of `eb`, starting from `firstElement`.
+ */
+GFS_API void GLDrawElementsEx(
+    const GLElementBuffer *eb, GLVertexArray va, u32 firstElement,
+    u32 elementCount);
 GFS_API void GLDrawTriangles(
     const GLVertexBuffer *vb, const GLVertexBufferLayout *layout,
     GLVertexArray va);
 GFS_API void GLDrawMesh(const Mesh *mesh);
 
+GFS_API void GLDrawElementsInstanced(
+    const GLElementBuffer *eb, const GLVertexBuffer *vb, GLVertexArray va,
+    u32 instanceCount);
+
+/*
+ * @breaf Attaches instance buffer to mesh's vertex array. Instance attributes
+ * will be placed right after mesh's vertex attributes.
+ */
+GFS_API void GLMeshAttachInstanceBuffer(
+    Mesh *mesh, const GLInstanceBuffer *ib, const GLVertexBufferLayout *layout);
+
+/*
+ * @breaf Draws `ib->count` instances of mesh with single draw call. Instance
+ * buffer should be attached with `GLMeshAttachInstanceBuffer` first.
+ */
+GFS_API void GLDrawMeshInstanced(const Mesh *mesh, const GLInstanceBuffer *ib);
+
 typedef enum {
     GL_SHADER_TYPE_NONE,
     GL_SHADER_TYPE_FRAG,
@@ -166,29 +302,212 @@ GFS_API GLShaderID GLCompileShaderFromFile(
 GFS_API GLShaderID GLCompileShader(
     Scratch *scratch, cstring8 shaderSourceString, GLShaderType shaderType);
 
+/*
+ * @breaf Deletes shader. Programs, which it's linked into, keep working.
+ */
+GFS_API void GLShaderDestroy(GLShaderID shader);
+
 typedef struct {
     GLShaderID vertexShader;
     GLShaderID fragmentShader;
 } GLShaderProgramLinkData;
 
+/*
+ * @breaf Links program and reflects it: locations of all active uniforms are
+ * stored in hash table (see `GLShaderGetUniformLocation`) and well-known
+ * uniform blocks are bound to their binding points.
+ */
 GFS_API GLShaderProgramID
 GLLinkShaderProgram(Scratch *scratch, const GLShaderProgramLinkData *data);
 
+GFS_API void GLShaderProgramDestroy(GLShaderProgramID program);
+
+typedef struct {
+    cstring8 name;
+    cstring8 value; // Optional.
+} GLShaderDefine;
+
+/*
+ * @breaf Upper bound of preprocessed source of one shader stage.
+ */
+#define GL_SHADER_SOURCE_CAPACITY KILOBYTES(256)
+
+#define GL_SHADER_MAX_INCLUDE_DEPTH EXPAND(8)
+
+/*
+ * @breaf Reads shader source and expands `#include "path"` directives. Path is
+ * relative to directory of including file. `defines` are injected right after
+ * `#version` line, and `#line` directives keep compiler messages pointing to
+ * original lines (source string 0 is `filePath`, includes are numbered in
+ * order they were met).
+ *
+ * @return Source allocated in `scratch` or `NULL` if any file can't be read.
+ */
+GFS_API char8 *GLPreprocessShaderFile(
+    Scratch *scratch, cstring8 filePath, const GLShaderDefine *defines,
+    u32 defineCount);
+
+/*
+ * @breaf Capacity of work arena of `GLProgramCache`. Sources and binary of one
+ * program must fit in it, otherwise binary is not cached.
+ */
+#define GL_PROGRAM_CACHE_ARENA_SIZE MEGABYTES(4)
+
+/*
+ * @breaf On-disk cache of linked program binaries. Binary is keyed by hash of
+ * shader sources and of driver's vendor, renderer and version, so edited
+ * shader or updated driver just falls back to compilation.
+ */
+typedef struct {
+    cstring8 directory;
+    u64 driverHash;
+    bool isSupported; // Driver has at least one program binary format.
+
+    Scratch arena; // Reset after every loaded program.
+
+    u32 hitCount;
+    u32 missCount;
+    f32 loadMilliseconds;    // Spent in `glProgramBinary` on hits.
+    f32 compileMilliseconds; // Spent compiling and linking on misses.
+
+    // NOTE(gr3yknigh1): Compile time is stored along with binary, so hit
+    // knows how much it saved. [2025/11/23]
+    f32 savedMilliseconds;
+} GLProgramCache;
+
+/*
+ * @breaf Creates `directory` if needed and queries driver. Should be called
+ * after OpenGL context is made current.
+ */
+GFS_API GLProgramCache GLProgramCacheMake(cstring8 directory);
+
+GFS_API void GLProgramCacheDestroy(GLProgramCache *cache);
+
+/*
+ * @breaf Loads program from `cache` or, on miss, compiles and links it from
+ * sources and stores it's binary. Program is reflected in both cases, same as
+ * with `GLLinkShaderProgram`.
+ */
+GFS_API GLShaderProgramID GLLoadShaderProgramFromFiles(
+    Scratch *scratch, GLProgramCache *cache, cstring8 vertexShaderFilePath,
+    cstring8 fragmentShaderFilePath);
+
+#define GL_SHADER_MAX_KEYWORDS EXPAND(8)
+
+/*
+ * @breaf Variants of one program, which differ only by set of keywords,
+ * defined before shader is compiled. Each variant is compiled on first
+ * request and kept for next ones, so hot shaders can `#ifdef` out paths
+ * instead of branching on uniforms.
+ */
+typedef struct {
+    GLProgramCache *cache;
+    cstring8 vertexShaderFilePath;
+    cstring8 fragmentShaderFilePath;
+
+    cstring8 keywords[GL_SHADER_MAX_KEYWORDS];
+    u32 keywordCount;
+
+    GLShaderProgramID programs[1 << GL_SHADER_MAX_KEYWORDS]; // By mask.
+    u32 compiledCount;
+} GLShaderPermutations;
+
+GFS_API GLShaderPermutations GLShaderPermutationsMake(
+    GLProgramCache *cache, cstring8 vertexShaderFilePath,
+    cstring8 fragmentShaderFilePath, const cstring8 *keywords,
+    u32 keywordCount);
+
+/*
+ * @breaf Returns bit of `keyword` in keyword mask or zero if set has no such
+ * keyword.
+ */
+GFS_API u32 GLShaderPermutationsGetKeywordMask(
+    const GLShaderPermutations *permutations, cstring8 keyword);
+
+/*
+ * @breaf Returns variant with keywords of `keywordMask` defined. Compiles it
+ * (through program cache) if it was not requested before.
+ */
+GFS_API GLShaderProgramID GLShaderPermutationsGet(
+    Scratch *scratch, GLShaderPermutations *permutations, u32 keywordMask);
+
 GFS_API GLTexture
 GLTextureMakeFromBMPicture(const BMPicture *picture, ColorLayout colorLayout);
 
+/*
+ * @breaf Makes texture with immutable storage (`glTexStorage2D`) for full mip
+ * chain. Before 4.2 falls back to mutable storage of same levels. Contents
+ * are undefined until `GLTextureSendData2D`.
+ */
+GFS_API GLTexture GLTextureMakeImmutable2D(u32 width, u32 height);
+
+/*
+ * @breaf Uploads base level and regenerates mips. If buffer is bound to
+ * `GL_PIXEL_UNPACK_BUFFER`, `pixels` is offset in that buffer.
+ */
+GFS_API void GLTextureSendData2D(
+    GLTexture texture, u32 width, u32 height, ColorLayout colorLayout,
+    const void *pixels);
+
+/*
+ * @breaf Slices picture into `GL_TEXTURE_2D_ARRAY` with one layer per tile
+ * (row-major, from first row of picture's data) and full mip chain. Since
+ * every tile has it's own mip levels, they never bleed into each other.
+ */
+GFS_API GLTexture GLTextureArrayMakeFromBMPictureTiles(
+    const BMPicture *picture, ColorLayout colorLayout, u32 tileWidth,
+    u32 tileHeight);
+
+/*
+ * @breaf Offscreen framebuffer with color texture and depth-stencil
+ * renderbuffer. Only part of it may be rendered to, see
+ * `GLRenderTargetBlit`.
+ */
+typedef struct {
+    u32 framebuffer;
+    GLTexture color;
+    u32 depthStencil; // Renderbuffer.
+    u32 width;
+    u32 height;
+} GLRenderTarget;
+
+GFS_API GLRenderTarget GLRenderTargetMake(u32 width, u32 height);
+GFS_API void GLRenderTargetDestroy(GLRenderTarget *target);
+
+/*
+ * @breaf Binds target for drawing and sets viewport to it's lower left
+ * `width` by `height` part.
+ */
+GFS_API void
+GLRenderTargetBind(const GLRenderTarget *target, u32 width, u32 height);
+
+/*
+ * @breaf Stretches lower left `width` by `height` part of target over
+ * `destinationWidth` by `destinationHeight` of `destinationFramebuffer` with
+ * linear filtering. Leaves destination bound for drawing. Scissor test must
+ * be disabled, since blit is clipped by it.
+ */
+GFS_API void GLRenderTargetBlit(
+    const GLRenderTarget *target, u32 width, u32 height,
+    u32 destinationFramebuffer, u32 destinationWidth, u32 destinationHeight);
+
 /*
  * @breaf Returns location of uniform.
  *
- * @param shader Shader program id which should be enabled with glUseProgram
- * call.
+ * @param shader Shader program id.
  * @param name Name of uniform.
+ *
+ * NOTE(gr3yknigh1): `GLShaderSetUniform*` functions bind `shader` through the
+ * state cache, so there is no need to call `GLUseProgram` before them.
+ * [2025/11/16]
  * */
 GFS_API GLUniformLocation
 GLShaderFindUniformLocation(GLShaderProgramID shader, cstring8 name);
 
 GFS_API void GLShaderSetUniformF32(
     GLShaderProgramID shader, GLUniformLocation location, f32 value);
+GFS_API void GLShaderSetUniformV2F32(
+    GLShaderProgramID shader, GLUniformLocation location, f32 x, f32 y);
 GFS_API void GLShaderSetUniformV3F32(
     GLShaderProgramID shader, GLUniformLocation location, f32 x, f32 y, f32 z);
 GFS_API void GLShaderSetUniformI32(
@@ -196,12 +515,461 @@ GFS_API void GLShaderSetUniformI32(
 GFS_API void GLShaderSetUniformM4F32(
     GLShaderProgramID shader, GLUniformLocation location, f32 *value);
 
+/*
+ * @breaf Interned name of uniform. Zero is invalid name.
+ */
+typedef u32 GLUniformName;
+
+#define GL_UNIFORM_LOCATION_NONE ((GLUniformLocation)-1)
+
+/*
+ * @breaf Returns unique id of the name. Same strings always give same id.
+ */
+GFS_API GLUniformName GLUniformNameIntern(cstring8 name);
+
+/*
+ * @breaf Returns location of uniform from table, which was filled on link
+ * time. No calls to OpenGL are made.
+ *
+ * @return `GL_UNIFORM_LOCATION_NONE` if uniform is not active.
+ */
+GFS_API GLUniformLocation
+GLShaderGetUniformLocation(GLShaderProgramID shader, GLUniformName name);
+
+/*
+ * @breaf Binding points of well-known uniform blocks. Blocks with these names
+ * are bound automatically by `GLLinkShaderProgram`.
+ *
+ * ```glsl
+ * layout (std140) uniform Camera {
+ *     mat4 u_View;
+ *     mat4 u_Projection;
+ *     mat4 u_ViewProjection;
+ * };
+ *
+ * layout (std140) uniform Draw {
+ *     mat4 u_Model;
+ * };
+ * ```
+ */
+#define GL_UNIFORM_BLOCK_BINDING_CAMERA EXPAND(0)
+#define GL_UNIFORM_BLOCK_BINDING_DRAW EXPAND(1)
+
+/*
+ * @breaf Layout of `Camera` uniform block (std140).
+ */
+typedef struct {
+    f32 view[16];
+    f32 projection[16];
+    f32 viewProjection[16];
+} GLCameraBlock;
+
+/*
+ * @breaf Layout of `Draw` uniform block (std140).
+ */
+typedef struct {
+    f32 model[16];
+} GLDrawBlock;
+
+typedef struct {
+    u32 id;
+    usize size;
+} GLUniformBuffer;
+
+GFS_API GLUniformBuffer GLUniformBufferMake(const void *data, usize size);
+GFS_API void GLUniformBufferSendData(
+    GLUniformBuffer *buffer, const void *data, usize size);
+GFS_API void GLUniformBufferDestroy(GLUniformBuffer *buffer);
+
+/*
+ * @breaf Binds whole buffer to uniform block binding point.
+ */
+GFS_API void GLUniformBufferBind(const GLUniformBuffer *buffer, u32 binding);
+
+/*
+ * @breaf Ring of per-draw uniform data. Each push is written after the
+ * previous one (with respect to `GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT`) and
+ * bound with `glBindBufferRange`, so draws don't wait on each other.
+ *
+ * NOTE(gr3yknigh1): When ring is wrapped, buffer storage is orphaned, so GPU
+ * can still read data of previous draws. [2025/11/16]
+ */
+typedef struct {
+    GLUniformBuffer buffer;
+    usize offset;
+    usize alignment;
+
+    u32 wrapCount;
+} GLUniformRing;
+
+GFS_API GLUniformRing GLUniformRingMake(usize capacity);
+GFS_API void GLUniformRingDestroy(GLUniformRing *ring);
+
+/*
+ * @breaf Writes data to the ring and binds written range to `binding`.
+ */
+GFS_API void GLUniformRingPush(
+    GLUniformRing *ring, u32 binding, const void *data, usize size);
+
+/*
+ * @breaf Buffer, which shaders read through `samplerBuffer` with `texelFetch`.
+ * Suits vertex pulling: data is indexed by `gl_VertexID` and needs no vertex
+ * attributes.
+ */
+typedef struct {
+    u32 buffer;        // Upload with GL_TEXTURE_BUFFER target.
+    GLTexture texture; // Bind with GL_TEXTURE_BUFFER target.
+    u32 internalFormat;
+} GLBufferTexture;
+
+/*
+ * @breaf Creates empty buffer and texture, which views it.
+ *
+ * @param internalFormat Format of one texel, e.g. GL_R32UI.
+ */
+GFS_API GLBufferTexture GLBufferTextureMake(u32 internalFormat);
+GFS_API void GLBufferTextureDestroy(GLBufferTexture *bufferTexture);
+
+/*
+ * @breaf Max count of GPU scopes in one frame.
+ */
+#define GL_GPU_PROFILER_MAX_SCOPES EXPAND(32)
+
+/*
+ * @breaf Count of frames, which queries are in flight. Results of frame are
+ * read back that many frames later.
+ */
+#define GL_GPU_PROFILER_LATENCY EXPAND(4)
+
+typedef struct {
+    // NOTE(gr3yknigh1): `GL_TIMESTAMP` pair per scope instead of
+    // `GL_TIME_ELAPSED`, because elapsed queries can't nest and don't tell
+    // where scope is on timeline. [2025/11/23]
+    u32 queries[GL_GPU_PROFILER_MAX_SCOPES * 2];
+    cstring8 names[GL_GPU_PROFILER_MAX_SCOPES];
+    u32 scopeCount;
+    bool isPending;
+} GLGpuProfilerFrame;
+
+typedef struct {
+    cstring8 name;
+    f32 milliseconds;
+} GLGpuScopeResult;
+
+/*
+ * @breaf Measures named scopes of GPU work with timer queries. Results are
+ * read back without stalling, `GL_GPU_PROFILER_LATENCY` frames later.
+ */
+typedef struct {
+    GLGpuProfilerFrame frames[GL_GPU_PROFILER_LATENCY];
+    u32 frameIndex;
+    bool isFrameBegun;
+    bool isSupported;
+
+    Profiler *profiler; // Optional, receives resolved scopes on GPU track.
+    i64 gpuToProfilerNanoseconds;
+
+    GLGpuScopeResult results[GL_GPU_PROFILER_MAX_SCOPES]; // Last resolved.
+    u32 resultCount;
+    u32 droppedFrameCount; // Frames, which results weren't ready in time.
+} GLGpuProfiler;
+
+/*
+ * @breaf Creates query objects and lines up GPU clock with `profiler` one.
+ *
+ * @param profiler Optional.
+ */
+GFS_API GLGpuProfiler GLGpuProfilerMake(Profiler *profiler);
+
+/*
+ * @breaf Reads back results of frame, which slot is about to be reused, if
+ * they are available.
+ */
+GFS_API void GLGpuProfilerBeginFrame(GLGpuProfiler *gpuProfiler);
+GFS_API void GLGpuProfilerEndFrame(GLGpuProfiler *gpuProfiler);
+
+/*
+ * @breaf Opens GPU scope. Scopes may nest.
+ *
+ * @return Handle for `GLGpuProfilerEndScope`, `PROFILER_INVALID_SCOPE` if
+ * there is no room in frame or timer queries aren't supported.
+ */
+GFS_API u32 GLGpuProfilerBeginScope(GLGpuProfiler *gpuProfiler, cstring8 name);
+GFS_API void GLGpuProfilerEndScope(GLGpuProfiler *gpuProfiler, u32 scope);
+
+GFS_API void GLGpuProfilerDestroy(GLGpuProfiler *gpuProfiler);
+
+/*
+ * @breaf Count of texture units, which bindings are tracked by state cache.
+ */
+#define GL_STATE_CACHE_TEXTURE_UNIT_COUNT EXPAND(16)
+
+/*
+ * @breaf Count of uniform block binding points, which are tracked by state
+ * cache.
+ */
+#define GL_STATE_CACHE_UNIFORM_BINDING_COUNT EXPAND(16)
+
+/*
+ * @breaf Counters of state changes, which went through the state cache.
+ */
+typedef struct {
+    u64 issuedCount;  // Calls, which reached the driver.
+    u64 skippedCount; // Calls, which were redundant.
+} GLStateCacheCounters;
+
+/*
+ * @breaf Forgets all cached state. Call it after code, which talks to OpenGL
+ * directly (ImGui backend, for example).
+ */
+GFS_API void GLStateCacheInvalidate(void);
+
+GFS_API GLStateCacheCounters GLStateCacheGetCounters(void);
+GFS_API void GLStateCacheResetCounters(void);
+
+typedef enum {
+    GL_RENDER_OBJECT_BUFFER,
+    GL_RENDER_OBJECT_TEXTURE,
+    GL_RENDER_OBJECT_VERTEX_ARRAY,
+    GL_RENDER_OBJECT_PROGRAM,
+    GL_RENDER_OBJECT_SHADER,
+    GL_RENDER_OBJECT_RENDERBUFFER,
+    GL_RENDER_OBJECT_FRAMEBUFFER,
+    GL_RENDER_OBJECT_COUNT,
+} GLRenderObjectType;
+
+/*
+ * @breaf Work, which went through gfs OpenGL wrappers since last
+ * `GLRenderStatsResetFrame`.
+ */
+typedef struct {
+    u32 drawCallCount;
+    u64 triangleCount;
+
+    u64 bufferUploadBytes;
+    u32 bufferAllocationCount; // `glBufferData` calls, each (re)allocates.
+    u32 textureUploadCount;
+    u64 textureUploadBytes;
+
+    // NOTE(gr3yknigh1): Only binds, which reached driver, see state cache.
+    // [2025/11/23]
+    u32 programBindCount;
+    u32 vertexArrayBindCount;
+    u32 textureBindCount;
+
+    // NOTE(gr3yknigh1): Alive objects in resource registry, not reset per
+    // frame. [2025/11/23]
+    u32 objectCounts[GL_RENDER_OBJECT_COUNT];
+} GLRenderStats;
+
+GFS_API GLRenderStats GLRenderStatsGet(void);
+
+/*
+ * @breaf Zeroes per frame counters.
+ */
+GFS_API void GLRenderStatsResetFrame(void);
+
+/*
+ * @breaf Hooks, which gfs wrappers call. Code, which talks to OpenGL
+ * directly, may call them too, to be counted.
+ */
+GFS_API void
+GLRenderStatsRecordDraw(u32 mode, u32 vertexCount, u32 instanceCount);
+GFS_API void GLRenderStatsRecordBufferUpload(usize size, bool isAllocation);
+GFS_API void GLRenderStatsRecordTextureUpload(usize size);
+
+/*
+ * @breaf Max count of objects, which resource registry tracks. Objects above
+ * that still work, but aren't accounted.
+ */
+#define GL_RESOURCE_REGISTRY_CAPACITY EXPAND(4096)
+
+/*
+ * @breaf Max count of objects, which wait for GPU before deletion. Objects
+ * above that are deleted right away.
+ */
+#define GL_RESOURCE_DELETION_CAPACITY EXPAND(1024)
+
+/*
+ * @breaf Max count of frames, which deletions wait for GPU at once.
+ */
+#define GL_RESOURCE_DELETION_FRAME_COUNT EXPAND(8)
+
+/*
+ * @breaf Called when resource is evicted to fit memory budget. Callback must
+ * drop every reference to resource, registry deletes it afterwards.
+ */
+typedef void GLResourceEvictProc(
+    GLRenderObjectType type, u32 handle, void *parameter);
+
+typedef struct {
+    u32 counts[GL_RENDER_OBJECT_COUNT];
+    usize bytes[GL_RENDER_OBJECT_COUNT]; // Estimated from sizes of storage.
+    usize totalBytes;
+    usize evictableBytes;
+    usize budgetBytes; // Zero if budget isn't enforced.
+
+    u32 pendingDeletionCount;
+    u32 deletedCount;
+    u32 evictedCount;
+    u32 untrackedCount; // Objects, which didn't fit in registry.
+} GLResourceStats;
+
+// NOTE(gr3yknigh1): Registry is used only by thread with OpenGL context, same
+// as state cache. gfs wrappers register objects they make, code, which makes
+// objects directly, may register them too. [2025/11/23]
+
+GFS_API void
+GLResourceRegister(GLRenderObjectType type, u32 handle, usize size);
+
+/*
+ * @breaf Updates estimated size, e.g. after storage is reallocated with
+ * `glBufferData`.
+ */
+GFS_API void GLResourceSetSize(GLRenderObjectType type, u32 handle, usize size);
+
+/*
+ * @breaf Marks resource as streamable, so it can be evicted, when memory
+ * budget is exceeded.
+ */
+GFS_API void GLResourceSetEvictable(
+    GLRenderObjectType type, u32 handle, GLResourceEvictProc *evict,
+    void *parameter);
+
+/*
+ * @breaf Marks resource as used in current frame. Least recently used
+ * evictable resources are evicted first.
+ */
+GFS_API void GLResourceTouch(GLRenderObjectType type, u32 handle);
+
+/*
+ * @breaf Forgets resource and deletes it once GPU is done with frames, which
+ * could use it. Handle must not be used after that.
+ */
+GFS_API void GLResourceDestroy(GLRenderObjectType type, u32 handle);
+
+/*
+ * @breaf Fences deletions of current frame, deletes objects, which GPU is
+ * done with, and evicts resources over budget. Call once per frame.
+ */
+GFS_API void GLResourceRegistryUpdate(void);
+
+/*
+ * @breaf Waits for GPU and deletes every pending object. Call before context
+ * is destroyed.
+ */
+GFS_API void GLResourceRegistryFlush(void);
+
+GFS_API void GLResourceRegistrySetBudget(usize budgetBytes);
+GFS_API GLResourceStats GLResourceRegistryGetStats(void);
+
+/*
+ * @breaf Cached versions of `gl*` state calls. All of gfs goes through these,
+ * so calls, which doesn't change the state, never reach the driver.
+ */
+GFS_API void GLUseProgram(GLShaderProgramID program);
+GFS_API void GLBindVertexArray(GLVertexArray va);
+
+/*
+ * @breaf Binds buffer. Only `GL_ARRAY_BUFFER` and `GL_ELEMENT_ARRAY_BUFFER`
+ * are cached, other targets are passed through.
+ *
+ * NOTE(gr3yknigh1): Element buffer binding is part of VAO, so it's cache is
+ * dropped on every VAO change. [2025/11/16]
+ */
+GFS_API void GLBindBuffer(u32 target, u32 buffer);
+
+/*
+ * @breaf Binds texture to texture unit (0 means `GL_TEXTURE0`). Changes
+ * active texture unit only if needed.
+ */
+GFS_API void GLBindTexture(u32 unit, u32 target, GLTexture texture);
+
+/*
+ * @breaf `glEnable`/`glDisable`. `GL_BLEND`, `GL_DEPTH_TEST`,
+ * `GL_CULL_FACE` and `GL_SCISSOR_TEST` are cached.
+ */
+GFS_API void GLSetCapability(u32 capability, bool isEnabled);
+
+GFS_API void GLBlendFunc(u32 sourceFactor, u32 destinationFactor);
+GFS_API void GLCullFace(u32 mode);
+
+/*
+ * @breaf Sets polygon mode of both front and back faces.
+ */
+GFS_API void GLPolygonMode(u32 mode);
+
+/*
+ * @breaf `glBindBufferRange` for `GL_UNIFORM_BUFFER`. Zero `size` binds whole
+ * buffer (`glBindBufferBase`).
+ */
+GFS_API void
+GLBindUniformBufferRange(u32 binding, u32 buffer, usize offset, usize size);
+
+/*
+ * @breaf Deletes texture through resource registry, see `GLResourceDestroy`.
+ */
+GFS_API void GLTextureDestroy(GLTexture texture);
+
 GFS_API cstring8 GLGetErrorString(i32 errorCode);
 
 GFS_API void GLClearErrors(void);
 GFS_API void GLAssertNoErrors(
     cstring8 expression, cstring8 sourceFile, u64 sourceLine);
 
+/*
+ * @breaf Count of distinct messages, which debug output remembers to report
+ * only once.
+ */
+#define GL_DEBUG_OUTPUT_MESSAGE_CAPACITY EXPAND(256)
+
+typedef enum {
+    // NOTE(gr3yknigh1): Callback runs inside of call, which produced message,
+    // so reported call site is exact. Costs driver some parallelism.
+    // [2025/11/23]
+    GL_DEBUG_OUTPUT_SYNCHRONOUS_FLAG = MKFLAG(0),
+    GL_DEBUG_OUTPUT_BREAK_ON_ERROR_FLAG = MKFLAG(1),
+    GL_DEBUG_OUTPUT_NOTIFICATIONS_FLAG = MKFLAG(2), // Severity notification.
+} GLDebugOutputFlag;
+
+/*
+ * @breaf Counters of messages, which came through debug output callback.
+ */
+typedef struct {
+    u32 errorCount;
+    u32 performanceCount; // Buffer reallocations, shader recompiles, etc.
+    u32 warningCount;     // Deprecated, undefined behavior and portability.
+    u32 otherCount;
+    u32 repeatedCount; // Messages, which were counted, but not printed again.
+} GLDebugOutputCounters;
+
+/*
+ * @breaf Installs `glDebugMessageCallback` (KHR_debug), which prints errors
+ * and warnings with last call site of `GL_CALL`. Create debug context to get
+ * all messages. Turns off `glGetError` checks of glad debug loader.
+ *
+ * @param flags Mask of `GLDebugOutputFlag`.
+ *
+ * @return `false` if context has no debug output (before 4.3).
+ */
+GFS_API bool GLDebugOutputEnable(u32 flags);
+
+/*
+ * @breaf Stops driver from sending message. Pass `GL_DONT_CARE` as `source`
+ * or `type` to match any.
+ */
+GFS_API void GLDebugOutputIgnoreMessage(u32 source, u32 type, u32 id);
+
+GFS_API GLDebugOutputCounters GLDebugOutputGetCounters(void);
+GFS_API void GLDebugOutputResetCounters(void);
+
+/*
+ * @breaf Remembers call, which is about to be issued. Used by `GL_CALL` with
+ * `GFS_OPENGL_DEBUG_OUTPUT`.
+ */
+GFS_API void GLDebugOutputSetCallSite(
+    cstring8 expression, cstring8 sourceFile, u64 sourceLine);
+
 #if defined(GFS_OPENGL_DEBUG)
 
 #define GL_CALL(EXPR) \
@@ -218,6 +986,23 @@ GFS_API void GLAssertNoErrors(
         GLAssertNoErrors(STRINGIFY(EXPR), __FILE__, __LINE__); \
     } while (0)
 
+#elif defined(GFS_OPENGL_DEBUG_OUTPUT)
+
+// NOTE(gr3yknigh1): No `glGetError` round trips, which synchronize with
+// driver. Call only remembers where it is, errors come to callback of
+// `GLDebugOutputEnable`. [2025/11/23]
+#define GL_CALL(EXPR) \
+    do { \
+        GLDebugOutputSetCallSite(STRINGIFY(EXPR), __FILE__, __LINE__); \
+        (EXPR); \
+    } while (0)
+
+#define GL_CALL_O(EXPR, OUT) \
+    do { \
+        GLDebugOutputSetCallSite(STRINGIFY(EXPR), __FILE__, __LINE__); \
+        *(OUT) = (EXPR); \
+    } while (0)
+
 #else
 
 #define GL_CALL(X) (X)
@@ -0,0 +1,135 @@
+#if !defined(GFS_TEXTURE_STREAMER_H_INCLUDED)
+/*
+ * FILE      gfs\code\gfs\include\gfs\texture_streamer.h
+ * AUTHOR    Ilya Akkuzin <gr3yknigh1@gmail.com>
+ * COPYRIGHT (c) 2025 Ilya Akkuzin
+ * */
+#define GFS_TEXTURE_STREAMER_H_INCLUDED
+
+#include "gfs/types.h"
+#include "gfs/macros.h"
+#include "gfs/memory.h"
+#include "gfs/platform.h"
+#include "gfs/bmp.h"
+#include "gfs/render_opengl.h"
+
+/*
+ * @breaf Max count of uploads, which streamer tracks at once.
+ */
+#define GL_TEXTURE_STREAMER_CAPACITY EXPAND(64)
+
+/*
+ * @breaf Count of pixel buffer objects, so count of uploads which can be
+ * copied and transferred at the same time.
+ */
+#define GL_TEXTURE_STREAMER_STAGING_COUNT EXPAND(4)
+
+// NOTE(gr3yknigh1): Upload goes through states in order of declaration. Odd
+// ones (DECODING, COPYING) are owned by worker thread, others by thread,
+// which owns OpenGL context. [2025/11/23]
+typedef enum {
+    GL_TEXTURE_UPLOAD_NONE,
+    GL_TEXTURE_UPLOAD_DECODING,     // Worker loads picture from file.
+    GL_TEXTURE_UPLOAD_DECODED,      // Waits for free staging buffer.
+    GL_TEXTURE_UPLOAD_COPYING,      // Worker copies pixels to staging buffer.
+    GL_TEXTURE_UPLOAD_COPIED,       // Waits for `glTexSubImage2D`.
+    GL_TEXTURE_UPLOAD_TRANSFERRING, // Waits for fence.
+    GL_TEXTURE_UPLOAD_READY,
+    GL_TEXTURE_UPLOAD_FAILED,
+} GLTextureUploadState;
+
+typedef struct {
+    volatile u32 state; // GLTextureUploadState.
+
+    cstring8 filePath;
+    ColorLayout colorLayout;
+    GLTexture texture; // Valid only in `GL_TEXTURE_UPLOAD_READY` state.
+    u32 width;
+    u32 height;
+    usize size; // Bytes of base level.
+
+    Scratch decodeArena; // Holds `picture` until it's copied.
+    BMPicture picture;
+
+    void *staging; // Mapped range of staging buffer.
+    u32 stagingIndex;
+    void *fence; // GLsync.
+} GLTextureUpload;
+
+typedef struct {
+    u32 pendingCount; // Requested, but not yet ready or failed.
+    u32 uploadedCount;
+    usize uploadedBytes;
+    usize frameBytes; // Bytes copied to staging buffers in last update.
+} GLTextureStreamerStats;
+
+/*
+ * @breaf Streams textures from files. Decoding and copying to pixel buffer
+ * objects happen on worker thread, so thread with OpenGL context only issues
+ * transfers, no more than `frameBudgetBytes` per update.
+ */
+typedef struct {
+    GLTextureUpload uploads[GL_TEXTURE_STREAMER_CAPACITY];
+
+    // NOTE(gr3yknigh1): Single producer, single consumer queue of indexes in
+    // `uploads`. Every upload has at most one job in queue, so it never
+    // overflows. [2025/11/23]
+    u32 jobs[GL_TEXTURE_STREAMER_CAPACITY];
+    volatile u32 jobsPushed; // Written by OpenGL thread only.
+    volatile u32 jobsPopped; // Written by worker thread only.
+    volatile u32 isStopping;
+    Semaphore *jobReady; // Signaled once per job and on destroy.
+    Thread *worker;
+    Scratch workerArena; // Owned by worker thread.
+
+    u32 stagingBuffers[GL_TEXTURE_STREAMER_STAGING_COUNT];
+    GLTextureUpload *stagingOwners[GL_TEXTURE_STREAMER_STAGING_COUNT];
+
+    usize frameBudgetBytes;
+    GLTextureStreamerStats stats;
+} GLTextureStreamer;
+
+/*
+ * @breaf Allocates streamer, creates it's staging buffers and starts worker
+ * thread. Must be called on thread with current OpenGL context.
+ *
+ * @return `NULL` if memory or thread can't be acquired.
+ */
+GFS_API GLTextureStreamer *
+GLTextureStreamerMake(Scratch *scratch, usize frameBudgetBytes);
+
+/*
+ * @breaf Queues upload of BMP file into immutable texture. `filePath` must
+ * outlive the upload.
+ *
+ * @return `NULL` if all upload slots are busy.
+ */
+GFS_API GLTextureUpload *GLTextureStreamerRequest(
+    GLTextureStreamer *streamer, cstring8 filePath, ColorLayout colorLayout);
+
+/*
+ * @breaf Moves uploads forward: maps staging buffers for decoded pictures
+ * within frame budget, issues transfers for copied ones and polls fences.
+ * Call once per frame on thread with current OpenGL context.
+ */
+GFS_API void GLTextureStreamerUpdate(GLTextureStreamer *streamer);
+
+/*
+ * @breaf Checks if fence of upload is signaled, so texture can be sampled
+ * without stalling.
+ */
+GFS_API bool GLTextureUploadIsReady(GLTextureUpload *upload);
+
+/*
+ * @breaf Frees upload slot. Texture is owned by caller after that. Upload
+ * must be ready or failed.
+ */
+GFS_API void GLTextureUploadRelease(GLTextureUpload *upload);
+
+/*
+ * @breaf Joins worker thread and deletes staging buffers. Textures of not yet
+ * released uploads are left alive.
+ */
+GFS_API void GLTextureStreamerDestroy(GLTextureStreamer *streamer);
+
+#endif // GFS_TEXTURE_STREAMER_H_INCLUDED
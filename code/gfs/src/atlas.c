@@ -68,3 +68,175 @@ AtlasTileCoordsToUV(Atlas *atlas, Vector2U32 tileCoords)
         tileCoords.y, 0, AtlasGetYTileCount(atlas), 0.0f, 1.0f);
     return uv;
 }
+
+GLTexture
+AtlasToTextureArray(Atlas *atlas, ColorLayout colorLayout)
+{
+    return GLTextureArrayMakeFromBMPictureTiles(
+        atlas->picture, colorLayout, atlas->tileWidth, atlas->tileHeight);
+}
+
+SkylinePacker
+SkylinePackerMake(Scratch *scratch, u32 width, u32 height)
+{
+    SkylinePacker packer = INIT_EMPTY_STRUCT(SkylinePacker);
+
+    packer.width = width;
+    packer.height = height;
+
+    // NOTE(gr3yknigh1): Every node is at least 1 pixel wide, so there can't
+    // be more nodes than pixels in a row. [2025/11/15]
+    packer.nodesCapacity = width;
+    packer.nodes = ScratchAllocZero(scratch, sizeof(SkylineNode) * width);
+    ASSERT_NONNULL(packer.nodes);
+
+    SkylinePackerReset(&packer);
+
+    return packer;
+}
+
+void
+SkylinePackerReset(SkylinePacker *packer)
+{
+    packer->nodes[0].x = 0;
+    packer->nodes[0].y = 0;
+    packer->nodes[0].width = packer->width;
+    packer->nodesCount = 1;
+}
+
+/*
+ * @breaf Returns lowest Y at which rectangle of `width` can be placed, if its
+ * left edge starts at node `nodeIndex`. Returns `false` if it doesn't fit.
+ */
+static bool
+SkylinePackerFit(
+    const SkylinePacker *packer, u32 nodeIndex, u32 width, u32 height, u32 *y)
+{
+    u32 x = packer->nodes[nodeIndex].x;
+
+    if (x + width > packer->width) {
+        return false;
+    }
+
+    u32 widthLeft = width;
+    u32 maxY = 0;
+
+    while (widthLeft > 0) {
+        if (nodeIndex >= packer->nodesCount) {
+            return false;
+        }
+
+        const SkylineNode *node = packer->nodes + nodeIndex;
+
+        if (node->y > maxY) {
+            maxY = node->y;
+        }
+
+        if (maxY + height > packer->height) {
+            return false;
+        }
+
+        widthLeft = widthLeft > node->width ? widthLeft - node->width : 0;
+        ++nodeIndex;
+    }
+
+    *y = maxY;
+    return true;
+}
+
+bool
+SkylinePackerPack(
+    SkylinePacker *packer, u32 width, u32 height, Vector2U32 *position)
+{
+    ASSERT_NONNULL(position);
+
+    if (width == 0 || height == 0) {
+        position->x = 0;
+        position->y = 0;
+        return true;
+    }
+
+    u32 bestIndex = (u32)-1;
+    u32 bestY = (u32)-1;
+    u32 bestWidth = (u32)-1;
+
+    for (u32 nodeIndex = 0; nodeIndex < packer->nodesCount; ++nodeIndex) {
+        u32 y = 0;
+
+        if (!SkylinePackerFit(packer, nodeIndex, width, height, &y)) {
+            continue;
+        }
+
+        if (y + height < bestY ||
+            (y + height == bestY &&
+             packer->nodes[nodeIndex].width < bestWidth)) {
+            bestIndex = nodeIndex;
+            bestY = y + height;
+            bestWidth = packer->nodes[nodeIndex].width;
+        }
+    }
+
+    if (bestIndex == (u32)-1) {
+        return false;
+    }
+
+    if (packer->nodesCount + 1 > packer->nodesCapacity) {
+        return false;
+    }
+
+    position->x = packer->nodes[bestIndex].x;
+    position->y = bestY - height;
+
+    // Insert new node, which covers placed rectangle.
+    for (u32 nodeIndex = packer->nodesCount; nodeIndex > bestIndex;
+         --nodeIndex) {
+        packer->nodes[nodeIndex] = packer->nodes[nodeIndex - 1];
+    }
+
+    packer->nodes[bestIndex].x = position->x;
+    packer->nodes[bestIndex].y = bestY;
+    packer->nodes[bestIndex].width = width;
+    ++packer->nodesCount;
+
+    // Shrink or remove nodes, which are now covered by the new one.
+    u32 nodeIndex = bestIndex + 1;
+    while (nodeIndex < packer->nodesCount) {
+        SkylineNode *previous = packer->nodes + nodeIndex - 1;
+        SkylineNode *node = packer->nodes + nodeIndex;
+
+        u32 previousRight = previous->x + previous->width;
+
+        if (node->x >= previousRight) {
+            break;
+        }
+
+        u32 shrink = previousRight - node->x;
+
+        if (node->width > shrink) {
+            node->x += shrink;
+            node->width -= shrink;
+            break;
+        }
+
+        for (u32 i = nodeIndex; i + 1 < packer->nodesCount; ++i) {
+            packer->nodes[i] = packer->nodes[i + 1];
+        }
+        --packer->nodesCount;
+    }
+
+    // Merge neighbours with same height.
+    for (u32 i = 0; i + 1 < packer->nodesCount;) {
+        if (packer->nodes[i].y == packer->nodes[i + 1].y) {
+            packer->nodes[i].width += packer->nodes[i + 1].width;
+
+            for (u32 j = i + 1; j + 1 < packer->nodesCount; ++j) {
+                packer->nodes[j] = packer->nodes[j + 1];
+            }
+            --packer->nodesCount;
+        } else {
+            ++i;
+        }
+    }
+
+    return true;
+}
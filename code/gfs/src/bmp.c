@@ -7,6 +7,7 @@
 #include "gfs/bmp.h"
 #include "gfs/platform.h"
 #include "gfs/assert.h"
+#include "gfs/macros.h"
 #include "gfs/render.h"
 
 BMPictureLoadFromFileRC
@@ -34,3 +35,38 @@ BMPictureLoadFromFile(BMPicture *picture, Scratch *scratch, cstring8 filePath) {
 
     return BMP_LOAD_FROM_FILE_OK;
 }
+
+bool
+BMPictureSaveToFile(
+    cstring8 filePath, Scratch *scratch, const void *pixels, u32 width,
+    u32 height)
+{
+    BMPictureHeader header = INIT_EMPTY_STRUCT(BMPictureHeader);
+    BMPictureDIBHeader dibHeader = INIT_EMPTY_STRUCT(BMPictureDIBHeader);
+
+    dibHeader.headerSize = BMP_HEADER_TYPE_BITMAPINFOHEADER;
+    dibHeader.width = width;
+    dibHeader.height = height;
+    dibHeader.planesCount = 1;
+    dibHeader.depth = 32;
+    dibHeader.compressionMethod = BMP_COMPRESSION_METHOD_RGB;
+    dibHeader.imageSize = width * height * 4;
+
+    header.type = 0x4D42; // "BM"
+    header.dataOffset = sizeof(header) + sizeof(dibHeader);
+    header.fileSize = header.dataOffset + dibHeader.imageSize;
+
+    FileOpenResult result = FileOpenEx(filePath, scratch, PERMISSION_WRITE);
+    if (result.code != FILE_OPEN_OK) {
+        return false;
+    }
+
+    FileHandle *fileHandle = result.handle;
+    bool isWritten =
+        FileWrite(fileHandle, &header, sizeof(header)) == FILE_WRITE_OK &&
+        FileWrite(fileHandle, &dibHeader, sizeof(dibHeader)) ==
+            FILE_WRITE_OK &&
+        FileWrite(fileHandle, pixels, dibHeader.imageSize) == FILE_WRITE_OK;
+
+    return FileClose(fileHandle) == FILE_CLOSE_OK && isWritten;
+}
@@ -0,0 +1,142 @@
+/*
+ * FILE      gfs\code\gfs\src\dynamic_resolution.c
+ * AUTHOR    Ilya Akkuzin <gr3yknigh1@gmail.com>
+ * COPYRIGHT (c) 2025 Ilya Akkuzin
+ * */
+
+#include "gfs/dynamic_resolution.h"
+
+#include "gfs/types.h"
+#include "gfs/macros.h"
+#include "gfs/assert.h"
+
+DynamicResolutionSettings
+DynamicResolutionSettingsMake(f32 budgetMilliseconds)
+{
+    DynamicResolutionSettings settings =
+        INIT_EMPTY_STRUCT(DynamicResolutionSettings);
+
+    settings.budgetMilliseconds = budgetMilliseconds;
+    settings.minScale = 0.5f;
+    settings.maxScale = 1.0f;
+    settings.scaleStep = 0.05f;
+    settings.lowerThreshold = 1.0f;
+    settings.raiseThreshold = 0.85f;
+    settings.settleFrameCount = 30;
+    settings.smoothing = 0.1f;
+
+    return settings;
+}
+
+DynamicResolution
+DynamicResolutionMake(DynamicResolutionSettings settings)
+{
+    ASSERT_ISTRUE(settings.budgetMilliseconds > 0);
+    ASSERT_ISTRUE(settings.scaleStep > 0);
+    ASSERT_ISTRUE(settings.minScale <= settings.maxScale);
+    ASSERT_ISTRUE(settings.raiseThreshold <= settings.lowerThreshold);
+
+    DynamicResolution resolution = INIT_EMPTY_STRUCT(DynamicResolution);
+    resolution.settings = settings;
+    resolution.scale = settings.maxScale;
+
+    return resolution;
+}
+
+static f32
+DynamicResolutionClampScale(
+    const DynamicResolutionSettings *settings, f32 scale)
+{
+    // NOTE(gr3yknigh1): Rounded to step, so float error doesn't accumulate
+    // over many changes. [2025/11/23]
+    scale = (f32)(u32)(scale / settings->scaleStep + 0.5f) *
+            settings->scaleStep;
+
+    if (scale < settings->minScale) {
+        return settings->minScale;
+    }
+    if (scale > settings->maxScale) {
+        return settings->maxScale;
+    }
+    return scale;
+}
+
+bool
+DynamicResolutionUpdate(
+    DynamicResolution *resolution, f32 gpuMilliseconds, f32 cpuMilliseconds)
+{
+    const DynamicResolutionSettings *settings = &resolution->settings;
+
+    f32 frameMilliseconds =
+        gpuMilliseconds > 0 ? gpuMilliseconds : cpuMilliseconds;
+    if (frameMilliseconds <= 0) {
+        return false;
+    }
+
+    if (resolution->averageMilliseconds <= 0) {
+        resolution->averageMilliseconds = frameMilliseconds;
+    } else {
+        resolution->averageMilliseconds +=
+            (frameMilliseconds - resolution->averageMilliseconds) *
+            settings->smoothing;
+    }
+
+    f32 average = resolution->averageMilliseconds;
+    f32 budget = settings->budgetMilliseconds;
+
+    if (average > budget * settings->lowerThreshold) {
+        resolution->overBudgetFrameCount += 1;
+        resolution->underBudgetFrameCount = 0;
+    } else if (average < budget * settings->raiseThreshold) {
+        resolution->underBudgetFrameCount += 1;
+        resolution->overBudgetFrameCount = 0;
+    } else {
+        resolution->overBudgetFrameCount = 0;
+        resolution->underBudgetFrameCount = 0;
+    }
+
+    f32 scale = resolution->scale;
+
+    if (resolution->overBudgetFrameCount >= settings->settleFrameCount) {
+        // NOTE(gr3yknigh1): Cost is assumed to follow pixel count, so scale
+        // drops at once to one, which lands average between thresholds.
+        // Going up is done step by step, because overshoot there means
+        // dropped frames. [2025/11/23]
+        f32 target =
+            budget * (settings->lowerThreshold + settings->raiseThreshold) *
+            0.5f;
+        f32 current = resolution->scale;
+
+        scale = current - settings->scaleStep;
+        while (scale - settings->scaleStep >= settings->minScale &&
+               average * (scale * scale) / (current * current) > target) {
+            scale -= settings->scaleStep;
+        }
+    } else if (
+        resolution->underBudgetFrameCount >= settings->settleFrameCount) {
+        scale = resolution->scale + settings->scaleStep;
+    }
+
+    scale = DynamicResolutionClampScale(settings, scale);
+    if (scale == resolution->scale) {
+        return false;
+    }
+
+    // NOTE(gr3yknigh1): Average is rescaled too, otherwise frames measured at
+    // old scale would push it further. [2025/11/23]
+    resolution->averageMilliseconds *=
+        (scale * scale) / (resolution->scale * resolution->scale);
+    resolution->scale = scale;
+    resolution->overBudgetFrameCount = 0;
+    resolution->underBudgetFrameCount = 0;
+    resolution->changeCount += 1;
+
+    return true;
+}
+
+u32
+DynamicResolutionScaleSize(const DynamicResolution *resolution, u32 size)
+{
+    u32 scaled = (u32)((f32)size * resolution->scale + 0.5f);
+    return scaled > 0 ? scaled : 1;
+}
@@ -0,0 +1,318 @@
+/*
+ * FILE      gfs\code\gfs\src\frame_capture.c
+ * AUTHOR    Ilya Akkuzin <gr3yknigh1@gmail.com>
+ * COPYRIGHT (c) 2025 Ilya Akkuzin
+ * */
+
+#include "gfs/frame_capture.h"
+
+#include <stdio.h>
+
+#include <glad/glad.h>
+
+#include "gfs/types.h"
+#include "gfs/macros.h"
+#include "gfs/memory.h"
+#include "gfs/assert.h"
+#include "gfs/platform.h"
+#include "gfs/bmp.h"
+#include "gfs/render_opengl.h"
+
+#define GL_FRAME_CAPTURE_WORKER_ARENA_SIZE KILOBYTES(4)
+#define GL_FRAME_CAPTURE_BYTES_PER_PIXEL EXPAND(4)
+
+static void
+GLFrameCapturePushJob(GLFrameCapture *capture, GLFrameCaptureSlot *slot)
+{
+    u32 pushed = capture->jobsPushed;
+    capture->jobs[pushed % GL_FRAME_CAPTURE_SLOT_COUNT] =
+        (u32)(slot - capture->slots);
+    AtomicFetchAddU32(&capture->jobsPushed, 1);
+    SemaphoreSignal(capture->jobReady);
+}
+
+static bool
+GLFrameCaptureWrite(GLFrameCapture *capture, GLFrameCaptureSlot *slot)
+{
+    usize size = (usize)slot->width * slot->height *
+                 GL_FRAME_CAPTURE_BYTES_PER_PIXEL;
+
+    if (capture->format == GL_FRAME_CAPTURE_FORMAT_RAW) {
+        return FileWrite(capture->rawFile, slot->pixels, size) ==
+               FILE_WRITE_OK;
+    }
+
+    char8 filePath[GL_FRAME_CAPTURE_PATH_CAPACITY + 16];
+    i32 length = snprintf(
+        filePath, sizeof(filePath), "%s_%05u.bmp", capture->filePathPrefix,
+        slot->frameIndex);
+    if (length <= 0 || (usize)length >= sizeof(filePath)) {
+        return false;
+    }
+
+    Scratch temp = TempScratchMake(&capture->workerArena, KILOBYTES(1));
+    bool isWritten = BMPictureSaveToFile(
+        filePath, &temp, slot->pixels, slot->width, slot->height);
+    TempScratchClean(&temp, &capture->workerArena);
+
+    return isWritten;
+}
+
+static void
+GLFrameCaptureWorkerProc(void *parameter)
+{
+    GLFrameCapture *capture = parameter;
+
+    for (;;) {
+        SemaphoreWait(capture->jobReady);
+
+        // NOTE(gr3yknigh1): Every job signals once, so extra signal without
+        // a job behind it is stop request. [2025/11/23]
+        u32 popped = capture->jobsPopped;
+        if (popped == AtomicLoadU32(&capture->jobsPushed)) {
+            ASSERT_ISTRUE(AtomicLoadU32(&capture->isStopping));
+            break;
+        }
+
+        GLFrameCaptureSlot *slot =
+            capture->slots +
+            capture->jobs[popped % GL_FRAME_CAPTURE_SLOT_COUNT];
+        ASSERT_EQ(AtomicLoadU32(&slot->state), GL_FRAME_CAPTURE_SLOT_WRITING);
+
+        AtomicStoreU32(
+            &slot->state, GLFrameCaptureWrite(capture, slot)
+                              ? GL_FRAME_CAPTURE_SLOT_WRITTEN
+                              : GL_FRAME_CAPTURE_SLOT_FAILED);
+        AtomicFetchAddU32(&capture->jobsPopped, 1);
+    }
+}
+
+GLFrameCapture *
+GLFrameCaptureMake(
+    Scratch *scratch, GLFrameCaptureFormat format, cstring8 filePathPrefix)
+{
+    GLFrameCapture *capture =
+        ScratchAllocZero(scratch, sizeof(GLFrameCapture));
+    if (capture == NULL) {
+        return NULL;
+    }
+
+    capture->format = format;
+    i32 length = snprintf(
+        capture->filePathPrefix, sizeof(capture->filePathPrefix), "%s",
+        filePathPrefix);
+    if (length <= 0 || (usize)length >= sizeof(capture->filePathPrefix)) {
+        return NULL;
+    }
+
+    if (format == GL_FRAME_CAPTURE_FORMAT_RAW) {
+        char8 filePath[GL_FRAME_CAPTURE_PATH_CAPACITY + 8];
+        snprintf(filePath, sizeof(filePath), "%s.bgra", filePathPrefix);
+
+        FileOpenResult result =
+            FileOpenEx(filePath, scratch, PERMISSION_WRITE);
+        if (result.code != FILE_OPEN_OK) {
+            return NULL;
+        }
+        capture->rawFile = result.handle;
+    }
+
+    capture->workerArena =
+        TempScratchMake(scratch, GL_FRAME_CAPTURE_WORKER_ARENA_SIZE);
+    if (capture->workerArena.data == NULL) {
+        return NULL;
+    }
+
+    for (u32 index = 0; index < GL_FRAME_CAPTURE_SLOT_COUNT; ++index) {
+        GL_CALL(glGenBuffers(1, &capture->slots[index].buffer));
+        GLResourceRegister(
+            GL_RENDER_OBJECT_BUFFER, capture->slots[index].buffer, 0);
+    }
+
+    capture->jobReady = SemaphoreCreate(scratch, 0);
+    if (capture->jobReady == NULL) {
+        return NULL;
+    }
+
+    capture->worker =
+        ThreadCreate(scratch, GLFrameCaptureWorkerProc, capture);
+    if (capture->worker == NULL) {
+        return NULL;
+    }
+
+    return capture;
+}
+
+bool
+GLCaptureFrame(
+    GLFrameCapture *capture, u32 framebuffer, u32 width, u32 height)
+{
+    u32 frameIndex = capture->stats.capturedCount + capture->stats.droppedCount;
+
+    GLFrameCaptureSlot *slot =
+        capture->slots + capture->slotsBegun % GL_FRAME_CAPTURE_SLOT_COUNT;
+    if (AtomicLoadU32(&slot->state) != GL_FRAME_CAPTURE_SLOT_FREE) {
+        capture->stats.droppedCount += 1;
+        return false;
+    }
+
+    usize size = (usize)width * height * GL_FRAME_CAPTURE_BYTES_PER_PIXEL;
+
+    GLint previousFramebuffer;
+    GL_CALL(glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousFramebuffer));
+    GL_CALL(glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer));
+
+    // NOTE(gr3yknigh1): Orphaned each time, so frame size may change between
+    // captures. BGRA rows are always 4-byte aligned, so default pack
+    // alignment is fine. [2025/11/23]
+    GLBindBuffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+    GL_CALL(glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ));
+    GLRenderStatsRecordBufferUpload(0, true);
+    GLResourceSetSize(GL_RENDER_OBJECT_BUFFER, slot->buffer, size);
+    GL_CALL(glReadPixels(
+        0, 0, (GLsizei)width, (GLsizei)height, GL_BGRA, GL_UNSIGNED_BYTE,
+        NULL));
+    GLBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    GL_CALL(
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, (GLuint)previousFramebuffer));
+
+    GLsync fence;
+    GL_CALL_O(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), &fence);
+
+    slot->fence = fence;
+    slot->frameIndex = frameIndex;
+    slot->width = width;
+    slot->height = height;
+    AtomicStoreU32(&slot->state, GL_FRAME_CAPTURE_SLOT_READING);
+
+    capture->slotsBegun += 1;
+    capture->stats.capturedCount += 1;
+    return true;
+}
+
+static bool
+GLFrameCaptureMap(
+    GLFrameCapture *capture, GLFrameCaptureSlot *slot, GLuint64 timeout)
+{
+    GLenum status;
+    GL_CALL_O(
+        glClientWaitSync(
+            slot->fence, timeout > 0 ? GL_SYNC_FLUSH_COMMANDS_BIT : 0,
+            timeout),
+        &status);
+    if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+        return false;
+    }
+
+    GL_CALL(glDeleteSync(slot->fence));
+    slot->fence = NULL;
+
+    usize size = (usize)slot->width * slot->height *
+                 GL_FRAME_CAPTURE_BYTES_PER_PIXEL;
+
+    void *pixels;
+    GLBindBuffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+    GL_CALL_O(
+        glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT),
+        &pixels);
+    GLBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    capture->slotsMapped += 1;
+
+    if (pixels == NULL) {
+        AtomicStoreU32(&slot->state, GL_FRAME_CAPTURE_SLOT_FAILED);
+        return true;
+    }
+
+    slot->pixels = pixels;
+    AtomicStoreU32(&slot->state, GL_FRAME_CAPTURE_SLOT_WRITING);
+    GLFrameCapturePushJob(capture, slot);
+    return true;
+}
+
+static void
+GLFrameCaptureUnmap(GLFrameCapture *capture, GLFrameCaptureSlot *slot)
+{
+    u32 state = AtomicLoadU32(&slot->state);
+
+    if (slot->pixels != NULL) {
+        GLBindBuffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+        GL_CALL(glUnmapBuffer(GL_PIXEL_PACK_BUFFER));
+        GLBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        slot->pixels = NULL;
+    }
+
+    if (state == GL_FRAME_CAPTURE_SLOT_WRITTEN) {
+        capture->stats.writtenCount += 1;
+        capture->stats.writtenBytes += (usize)slot->width * slot->height *
+                                       GL_FRAME_CAPTURE_BYTES_PER_PIXEL;
+    } else {
+        capture->stats.failedCount += 1;
+    }
+
+    AtomicStoreU32(&slot->state, GL_FRAME_CAPTURE_SLOT_FREE);
+}
+
+void
+GLFrameCaptureUpdate(GLFrameCapture *capture)
+{
+    for (u32 index = 0; index < GL_FRAME_CAPTURE_SLOT_COUNT; ++index) {
+        GLFrameCaptureSlot *slot = capture->slots + index;
+
+        u32 state = AtomicLoadU32(&slot->state);
+        if (state == GL_FRAME_CAPTURE_SLOT_WRITTEN ||
+            state == GL_FRAME_CAPTURE_SLOT_FAILED) {
+            GLFrameCaptureUnmap(capture, slot);
+        }
+    }
+
+    // NOTE(gr3yknigh1): Fences signal in order of submission, so first slot,
+    // which isn't done, means later ones aren't done either. [2025/11/23]
+    while (capture->slotsMapped < capture->slotsBegun) {
+        GLFrameCaptureSlot *slot =
+            capture->slots +
+            capture->slotsMapped % GL_FRAME_CAPTURE_SLOT_COUNT;
+        if (!GLFrameCaptureMap(capture, slot, 0)) {
+            break;
+        }
+    }
+}
+
+void
+GLFrameCaptureDestroy(GLFrameCapture *capture)
+{
+    while (capture->slotsMapped < capture->slotsBegun) {
+        GLFrameCaptureSlot *slot =
+            capture->slots +
+            capture->slotsMapped % GL_FRAME_CAPTURE_SLOT_COUNT;
+        if (!GLFrameCaptureMap(capture, slot, GL_TIMEOUT_IGNORED)) {
+            GL_CALL(glDeleteSync(slot->fence));
+            slot->fence = NULL;
+            capture->slotsMapped += 1;
+            AtomicStoreU32(&slot->state, GL_FRAME_CAPTURE_SLOT_FAILED);
+        }
+    }
+
+    // NOTE(gr3yknigh1): Worker drains queued jobs before it sees stop
+    // signal. [2025/11/23]
+    AtomicStoreU32(&capture->isStopping, true);
+    SemaphoreSignal(capture->jobReady);
+    ThreadJoin(capture->worker);
+    SemaphoreDestroy(capture->jobReady);
+
+    for (u32 index = 0; index < GL_FRAME_CAPTURE_SLOT_COUNT; ++index) {
+        GLFrameCaptureSlot *slot = capture->slots + index;
+
+        if (AtomicLoadU32(&slot->state) != GL_FRAME_CAPTURE_SLOT_FREE) {
+            GLFrameCaptureUnmap(capture, slot);
+        }
+
+        GLResourceDestroy(GL_RENDER_OBJECT_BUFFER, slot->buffer);
+    }
+
+    if (capture->rawFile != NULL) {
+        FileClose(capture->rawFile);
+        capture->rawFile = NULL;
+    }
+}
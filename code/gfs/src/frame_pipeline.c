@@ -0,0 +1,271 @@
+/*
+ * FILE      gfs\code\gfs\src\frame_pipeline.c
+ * AUTHOR    Ilya Akkuzin <gr3yknigh1@gmail.com>
+ * COPYRIGHT (c) 2025 Ilya Akkuzin
+ * */
+
+#include "gfs/frame_pipeline.h"
+
+#include "gfs/types.h"
+#include "gfs/macros.h"
+#include "gfs/memory.h"
+#include "gfs/assert.h"
+#include "gfs/platform.h"
+
+#define FRAME_PIPELINE_SNAPSHOT_ALIGNMENT EXPAND(16)
+
+static u32
+FramePipelineClampDepth(u32 depth)
+{
+    if (depth < 1) {
+        return 1;
+    }
+    if (depth > FRAME_PIPELINE_MAX_DEPTH) {
+        return FRAME_PIPELINE_MAX_DEPTH;
+    }
+    return depth;
+}
+
+static u64
+FramePipelineIntervalOverlap(u64 aBegin, u64 aEnd, u64 bBegin, u64 bEnd)
+{
+    u64 begin = aBegin > bBegin ? aBegin : bBegin;
+    u64 end = aEnd < bEnd ? aEnd : bEnd;
+    return end > begin ? end - begin : 0;
+}
+
+static f32
+FramePipelineTicksToMilliseconds(u64 ticks, u64 frequency, u32 frameCount)
+{
+    return (f32)((f64)ticks * 1000.0 / (f64)frequency / (f64)frameCount);
+}
+
+/*
+ * @breaf Accumulates timings of just rendered frame and publishes averages
+ * every `FRAME_PIPELINE_STATS_FRAME_COUNT` frames. Render thread only.
+ */
+static void
+FramePipelineAccumulate(FramePipeline *pipeline, u32 frameIndex)
+{
+    FramePipelineFrameTiming *timing =
+        pipeline->timings + frameIndex % FRAME_PIPELINE_MAX_DEPTH;
+    FramePipelineStatsAccumulator *accumulator = &pipeline->accumulator;
+
+    accumulator->simulation += timing->simulationEnd - timing->simulationBegin;
+    accumulator->simulationWait += timing->simulationWait;
+    accumulator->render += timing->renderEnd - timing->renderBegin;
+    accumulator->latency += timing->renderEnd - timing->simulationBegin;
+
+    if (frameIndex > 0) {
+        FramePipelineFrameTiming *previous =
+            pipeline->renderHistory +
+            (frameIndex - 1) % FRAME_PIPELINE_MAX_DEPTH;
+        accumulator->frame += timing->renderEnd - previous->renderEnd;
+    } else {
+        accumulator->frame += timing->renderEnd - timing->simulationBegin;
+    }
+
+    // NOTE(gr3yknigh1): Renders are sequential, so overlaps of simulation
+    // with each of previous renders never intersect and can be summed.
+    // [2025/11/23]
+    for (u32 distance = 1; distance < FRAME_PIPELINE_MAX_DEPTH; ++distance) {
+        if (distance > frameIndex) {
+            break;
+        }
+
+        FramePipelineFrameTiming *previous =
+            pipeline->renderHistory +
+            (frameIndex - distance) % FRAME_PIPELINE_MAX_DEPTH;
+        accumulator->overlap += FramePipelineIntervalOverlap(
+            timing->simulationBegin, timing->simulationEnd,
+            previous->renderBegin, previous->renderEnd);
+    }
+
+    pipeline->renderHistory[frameIndex % FRAME_PIPELINE_MAX_DEPTH] = *timing;
+    accumulator->frameCount += 1;
+
+    if (accumulator->frameCount < FRAME_PIPELINE_STATS_FRAME_COUNT) {
+        return;
+    }
+
+    u32 version = pipeline->statsVersion + 1;
+    FramePipelineStats *stats = pipeline->stats + version % 2;
+    u64 frequency = pipeline->frequency;
+    u32 count = accumulator->frameCount;
+
+    stats->depth = AtomicLoadU32(&pipeline->depth);
+    stats->frameCount = (u64)frameIndex + 1;
+    stats->simulationMilliseconds = FramePipelineTicksToMilliseconds(
+        accumulator->simulation, frequency, count);
+    stats->simulationWaitMilliseconds = FramePipelineTicksToMilliseconds(
+        accumulator->simulationWait, frequency, count);
+    stats->renderMilliseconds =
+        FramePipelineTicksToMilliseconds(accumulator->render, frequency, count);
+    stats->frameMilliseconds =
+        FramePipelineTicksToMilliseconds(accumulator->frame, frequency, count);
+    stats->latencyMilliseconds = FramePipelineTicksToMilliseconds(
+        accumulator->latency, frequency, count);
+    stats->overlapMilliseconds = FramePipelineTicksToMilliseconds(
+        accumulator->overlap, frequency, count);
+
+    AtomicStoreU32(&pipeline->statsVersion, version);
+    MemoryZero(accumulator, sizeof(*accumulator));
+}
+
+static void
+FramePipelineRenderThreadProc(void *parameter)
+{
+    FramePipeline *pipeline = parameter;
+    FramePipelineSettings *settings = &pipeline->settings;
+
+    if (settings->renderThreadBegin != NULL) {
+        settings->renderThreadBegin(settings->parameter);
+    }
+
+    for (u32 frameIndex = 0;; ++frameIndex) {
+        SemaphoreWait(pipeline->frameReady);
+
+        // NOTE(gr3yknigh1): Every produced frame signals once, so extra
+        // signal without a frame behind it is stop request. [2025/11/23]
+        if (frameIndex == AtomicLoadU32(&pipeline->producedCount)) {
+            break;
+        }
+
+        u32 slot = frameIndex % FRAME_PIPELINE_MAX_DEPTH;
+        FramePipelineFrameTiming *timing = pipeline->timings + slot;
+
+        timing->renderBegin = GetPerformanceCounter();
+        settings->render(
+            pipeline->snapshots + slot * pipeline->snapshotStride, frameIndex,
+            settings->parameter);
+        timing->renderEnd = GetPerformanceCounter();
+
+        FramePipelineAccumulate(pipeline, frameIndex);
+
+        AtomicFetchAddU32(&pipeline->consumedCount, 1);
+        SemaphoreSignal(pipeline->frameDone);
+    }
+
+    if (settings->renderThreadEnd != NULL) {
+        settings->renderThreadEnd(settings->parameter);
+    }
+}
+
+FramePipeline *
+FramePipelineMake(Scratch *scratch, const FramePipelineSettings *settings)
+{
+    ASSERT_NONNULL(settings->render);
+    ASSERT_NONZERO(settings->snapshotSize);
+
+    FramePipeline *pipeline = ScratchAllocZero(scratch, sizeof(FramePipeline));
+    if (pipeline == NULL) {
+        return NULL;
+    }
+
+    pipeline->settings = *settings;
+    pipeline->depth = FramePipelineClampDepth(settings->depth);
+    pipeline->frequency = GetPerformanceFrequency();
+    pipeline->snapshotStride =
+        (settings->snapshotSize + FRAME_PIPELINE_SNAPSHOT_ALIGNMENT - 1) &
+        ~(usize)(FRAME_PIPELINE_SNAPSHOT_ALIGNMENT - 1);
+
+    byte *snapshots = ScratchAllocZero(
+        scratch, pipeline->snapshotStride * FRAME_PIPELINE_MAX_DEPTH +
+                     FRAME_PIPELINE_SNAPSHOT_ALIGNMENT);
+    if (snapshots == NULL) {
+        return NULL;
+    }
+
+    usize misalignment = (usize)snapshots % FRAME_PIPELINE_SNAPSHOT_ALIGNMENT;
+    if (misalignment != 0) {
+        snapshots += FRAME_PIPELINE_SNAPSHOT_ALIGNMENT - misalignment;
+    }
+    pipeline->snapshots = snapshots;
+
+    pipeline->frameReady = SemaphoreCreate(scratch, 0);
+    if (pipeline->frameReady == NULL) {
+        return NULL;
+    }
+
+    pipeline->frameDone = SemaphoreCreate(scratch, 0);
+    if (pipeline->frameDone == NULL) {
+        SemaphoreDestroy(pipeline->frameReady);
+        return NULL;
+    }
+
+    pipeline->renderThread =
+        ThreadCreate(scratch, FramePipelineRenderThreadProc, pipeline);
+    if (pipeline->renderThread == NULL) {
+        SemaphoreDestroy(pipeline->frameReady);
+        SemaphoreDestroy(pipeline->frameDone);
+        return NULL;
+    }
+
+    return pipeline;
+}
+
+void *
+FramePipelineBeginFrame(FramePipeline *pipeline)
+{
+    ASSERT_ISFALSE(pipeline->isFrameBegun);
+
+    u32 produced = pipeline->producedCount;
+    u64 waitBegin = GetPerformanceCounter();
+
+    // NOTE(gr3yknigh1): `frameDone` is signaled on every consumed frame even
+    // if nobody waits, so count is rechecked after each wake up.
+    // [2025/11/23]
+    while (produced - AtomicLoadU32(&pipeline->consumedCount) >=
+           AtomicLoadU32(&pipeline->depth)) {
+        SemaphoreWait(pipeline->frameDone);
+    }
+
+    u32 slot = produced % FRAME_PIPELINE_MAX_DEPTH;
+    FramePipelineFrameTiming *timing = pipeline->timings + slot;
+
+    timing->simulationBegin = GetPerformanceCounter();
+    timing->simulationWait = timing->simulationBegin - waitBegin;
+    pipeline->isFrameBegun = true;
+
+    return pipeline->snapshots + slot * pipeline->snapshotStride;
+}
+
+void
+FramePipelineEndFrame(FramePipeline *pipeline)
+{
+    ASSERT_ISTRUE(pipeline->isFrameBegun);
+
+    u32 slot = pipeline->producedCount % FRAME_PIPELINE_MAX_DEPTH;
+    pipeline->timings[slot].simulationEnd = GetPerformanceCounter();
+    pipeline->isFrameBegun = false;
+
+    AtomicFetchAddU32(&pipeline->producedCount, 1);
+    SemaphoreSignal(pipeline->frameReady);
+}
+
+void
+FramePipelineSetDepth(FramePipeline *pipeline, u32 depth)
+{
+    AtomicStoreU32(&pipeline->depth, FramePipelineClampDepth(depth));
+}
+
+FramePipelineStats
+FramePipelineGetStats(FramePipeline *pipeline)
+{
+    u32 version = AtomicLoadU32(&pipeline->statsVersion);
+    FramePipelineStats stats = pipeline->stats[version % 2];
+    stats.depth = AtomicLoadU32(&pipeline->depth);
+    return stats;
+}
+
+void
+FramePipelineDestroy(FramePipeline *pipeline)
+{
+    ASSERT_ISFALSE(pipeline->isFrameBegun);
+
+    SemaphoreSignal(pipeline->frameReady);
+    ThreadJoin(pipeline->renderThread);
+
+    SemaphoreDestroy(pipeline->frameReady);
+    SemaphoreDestroy(pipeline->frameDone);
+}
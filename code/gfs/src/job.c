@@ -0,0 +1,231 @@
+/*
+ * FILE      gfs\code\gfs\src\job.c
+ * AUTHOR    Ilya Akkuzin <gr3yknigh1@gmail.com>
+ * COPYRIGHT (c) 2025 Ilya Akkuzin
+ * */
+
+#include "gfs/job.h"
+
+#include "gfs/types.h"
+#include "gfs/macros.h"
+#include "gfs/memory.h"
+#include "gfs/assert.h"
+#include "gfs/platform.h"
+
+static void
+JobSystemPush(JobSystem *system, JobID job)
+{
+    u32 slot = AtomicFetchAddU32(&system->readyPushed, 1);
+    ASSERT_ISTRUE(slot < system->jobCount);
+
+    AtomicStoreU32(system->ready + slot, job + 1);
+    SemaphoreSignal(system->jobReady);
+}
+
+/*
+ * @breaf Runs job from next ready slot. Caller must hold unit of `jobReady`.
+ */
+static void
+JobSystemRunNext(JobSystem *system)
+{
+    // NOTE(gr3yknigh1): Read before job is finished, after that graph might
+    // be cleared by `JobSystemWait`. [2025/11/23]
+    u32 jobCount = system->jobCount;
+
+    u32 slot = AtomicFetchAddU32(&system->readyPopped, 1);
+    ASSERT_ISTRUE(slot < jobCount);
+
+    // NOTE(gr3yknigh1): Semaphore unit means that some slot was published,
+    // not necessarily this one. Pusher of this slot has already claimed it
+    // and is about to store, so wait is short. [2025/11/23]
+    u32 value = 0;
+    while ((value = AtomicLoadU32(system->ready + slot)) == 0) {
+    }
+
+    JobID jobIndex = value - 1;
+    Job *job = system->jobs + jobIndex;
+    job->proc(job->parameter);
+
+    for (u32 dependentIndex = job->firstDependent;
+         dependentIndex != JOB_DEPENDENT_NONE;
+         dependentIndex = system->dependents[dependentIndex].next) {
+        JobID dependent = system->dependents[dependentIndex].job;
+
+        if (AtomicFetchAddU32(
+                &system->jobs[dependent].pendingCount, (u32)-1) == 1) {
+            JobSystemPush(system, dependent);
+        }
+    }
+
+    if (AtomicFetchAddU32(&system->finishedCount, 1) + 1 == jobCount) {
+        SemaphoreSignal(system->graphFinished);
+    }
+}
+
+static void
+JobSystemWorkerProc(void *parameter)
+{
+    JobSystem *system = parameter;
+
+    for (;;) {
+        SemaphoreWait(system->jobReady);
+
+        // NOTE(gr3yknigh1): Stop is requested only while graph isn't
+        // running, so unit without a job behind it means stop. [2025/11/23]
+        if (AtomicLoadU32(&system->isStopping)) {
+            break;
+        }
+
+        JobSystemRunNext(system);
+    }
+}
+
+JobSystem *
+JobSystemMake(
+    Scratch *scratch, u32 workerCount, u32 jobCapacity, u32 dependentCapacity)
+{
+    ASSERT_ISTRUE(workerCount <= JOB_SYSTEM_MAX_WORKERS);
+
+    JobSystem *system = ScratchAllocZero(scratch, sizeof(JobSystem));
+    if (system == NULL) {
+        return NULL;
+    }
+
+    system->jobCapacity = jobCapacity;
+    system->jobs = ScratchAllocZero(scratch, sizeof(Job) * jobCapacity);
+    system->ready = ScratchAllocZero(scratch, sizeof(u32) * jobCapacity);
+    system->dependentCapacity = dependentCapacity;
+    system->dependents =
+        ScratchAllocZero(scratch, sizeof(JobDependent) * dependentCapacity);
+    if (system->jobs == NULL || system->ready == NULL ||
+        system->dependents == NULL) {
+        return NULL;
+    }
+
+    system->jobReady = SemaphoreCreate(scratch, 0);
+    if (system->jobReady == NULL) {
+        return NULL;
+    }
+
+    system->graphFinished = SemaphoreCreate(scratch, 0);
+    if (system->graphFinished == NULL) {
+        SemaphoreDestroy(system->jobReady);
+        return NULL;
+    }
+
+    for (u32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+        Thread *worker = ThreadCreate(scratch, JobSystemWorkerProc, system);
+        if (worker == NULL) {
+            break;
+        }
+
+        system->workers[system->workerCount] = worker;
+        system->workerCount += 1;
+    }
+
+    return system;
+}
+
+JobID
+JobSystemAdd(JobSystem *system, JobProc *proc, void *parameter)
+{
+    ASSERT_ISFALSE(system->isStarted);
+    ASSERT_ISTRUE(system->jobCount < system->jobCapacity);
+
+    JobID jobIndex = system->jobCount;
+    Job *job = system->jobs + jobIndex;
+    job->proc = proc;
+    job->parameter = parameter;
+    job->pendingCount = 1;
+    job->firstDependent = JOB_DEPENDENT_NONE;
+
+    system->jobCount += 1;
+
+    return jobIndex;
+}
+
+void
+JobSystemAddDependency(JobSystem *system, JobID job, JobID dependency)
+{
+    ASSERT_ISFALSE(system->isStarted);
+    ASSERT_ISTRUE(job < system->jobCount && dependency < system->jobCount);
+    ASSERT_ISTRUE(job != dependency);
+    ASSERT_ISTRUE(system->dependentCount < system->dependentCapacity);
+
+    JobDependent *dependent = system->dependents + system->dependentCount;
+    dependent->job = job;
+    dependent->next = system->jobs[dependency].firstDependent;
+
+    system->jobs[dependency].firstDependent = system->dependentCount;
+    system->jobs[job].pendingCount += 1;
+    system->dependentCount += 1;
+}
+
+void
+JobSystemStart(JobSystem *system)
+{
+    ASSERT_ISFALSE(system->isStarted);
+    system->isStarted = true;
+
+    u32 jobCount = system->jobCount;
+    for (JobID jobIndex = 0; jobIndex < jobCount; ++jobIndex) {
+        if (AtomicFetchAddU32(
+                &system->jobs[jobIndex].pendingCount, (u32)-1) == 1) {
+            JobSystemPush(system, jobIndex);
+        }
+    }
+}
+
+bool
+JobSystemIsDone(JobSystem *system)
+{
+    ASSERT_ISTRUE(system->isStarted);
+    return AtomicLoadU32(&system->finishedCount) == system->jobCount;
+}
+
+void
+JobSystemWait(JobSystem *system)
+{
+    ASSERT_ISTRUE(system->isStarted);
+
+    if (system->jobCount > 0) {
+        if (system->workerCount == 0) {
+            while (AtomicLoadU32(&system->finishedCount) < system->jobCount) {
+                SemaphoreWait(system->jobReady);
+                JobSystemRunNext(system);
+            }
+        }
+
+        SemaphoreWait(system->graphFinished);
+    }
+
+    // NOTE(gr3yknigh1): Every job was pushed and popped, so workers are
+    // blocked on semaphore and nothing else touches graph. [2025/11/23]
+    MemoryZero((void *)system->ready, sizeof(u32) * system->jobCount);
+    system->jobCount = 0;
+    system->dependentCount = 0;
+    system->readyPushed = 0;
+    system->readyPopped = 0;
+    system->finishedCount = 0;
+    system->isStarted = false;
+}
+
+void
+JobSystemDestroy(JobSystem *system)
+{
+    ASSERT_ISFALSE(system->isStarted);
+
+    AtomicStoreU32(&system->isStopping, true);
+    for (u32 workerIndex = 0; workerIndex < system->workerCount;
+         ++workerIndex) {
+        SemaphoreSignal(system->jobReady);
+    }
+
+    for (u32 workerIndex = 0; workerIndex < system->workerCount;
+         ++workerIndex) {
+        ThreadJoin(system->workers[workerIndex]);
+    }
+
+    SemaphoreDestroy(system->jobReady);
+    SemaphoreDestroy(system->graphFinished);
+}
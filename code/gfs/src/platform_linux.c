@@ -14,6 +14,9 @@
 #include <sys/mman.h>
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <time.h>
 
 #include "gfs/types.h"
 #include "gfs/macros.h"
@@ -126,6 +129,28 @@ FileGetSize(FileHandle *handle)
     return size;
 }
 
+FileWriteResultCode
+FileWrite(FileHandle *handle, const void *buffer, usize numberOfBytesToWrite)
+{
+    size_t bytesWritten = fwrite(buffer, 1, numberOfBytesToWrite, handle->file);
+
+    if (bytesWritten != numberOfBytesToWrite) {
+        return FILE_WRITE_ERR;
+    }
+
+    return FILE_WRITE_OK;
+}
+
+bool
+MakeDirectory(cstring8 path)
+{
+    if (mkdir(path, 0755) == 0) {
+        return true;
+    }
+
+    return errno == EEXIST;
+}
+
 void *
 MemoryAllocate(usize size)
 {
@@ -179,3 +204,121 @@ ThrowDebugBreak(void)
 {
     raise(SIGTRAP);
 }
+
+typedef struct Thread {
+    pthread_t handle;
+    ThreadProc *proc;
+    void *parameter;
+} Thread;
+
+static void *
+Linux_ThreadEntry(void *parameter)
+{
+    Thread *thread = parameter;
+    thread->proc(thread->parameter);
+    return NULL;
+}
+
+Thread *
+ThreadCreate(Scratch *scratch, ThreadProc *proc, void *parameter)
+{
+    Thread *thread = ScratchAllocZero(scratch, sizeof(Thread));
+
+    if (thread == NULL) {
+        return NULL;
+    }
+
+    thread->proc = proc;
+    thread->parameter = parameter;
+
+    if (pthread_create(&thread->handle, NULL, Linux_ThreadEntry, thread) !=
+        0) {
+        return NULL;
+    }
+
+    return thread;
+}
+
+void
+ThreadJoin(Thread *thread)
+{
+    pthread_join(thread->handle, NULL);
+}
+
+u32
+GetProcessorCount(void)
+{
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (u32)count : 1;
+}
+
+u32
+AtomicFetchAddU32(volatile u32 *value, u32 addend)
+{
+    return __atomic_fetch_add(value, addend, __ATOMIC_SEQ_CST);
+}
+
+u32
+AtomicLoadU32(volatile u32 *value)
+{
+    return __atomic_load_n(value, __ATOMIC_SEQ_CST);
+}
+
+void
+AtomicStoreU32(volatile u32 *value, u32 newValue)
+{
+    __atomic_store_n(value, newValue, __ATOMIC_SEQ_CST);
+}
+
+typedef struct Semaphore {
+    sem_t handle;
+} Semaphore;
+
+Semaphore *
+SemaphoreCreate(Scratch *scratch, u32 initialCount)
+{
+    Semaphore *semaphore = ScratchAllocZero(scratch, sizeof(Semaphore));
+
+    if (semaphore == NULL) {
+        return NULL;
+    }
+
+    if (sem_init(&semaphore->handle, 0, initialCount) != 0) {
+        return NULL;
+    }
+
+    return semaphore;
+}
+
+void
+SemaphoreWait(Semaphore *semaphore)
+{
+    while (sem_wait(&semaphore->handle) != 0 && errno == EINTR) {
+    }
+}
+
+void
+SemaphoreSignal(Semaphore *semaphore)
+{
+    sem_post(&semaphore->handle);
+}
+
+void
+SemaphoreDestroy(Semaphore *semaphore)
+{
+    sem_destroy(&semaphore->handle);
+}
+
+u64
+GetPerformanceCounter(void)
+{
+    struct timespec now = {0};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (u64)now.tv_sec * 1000000000ull + (u64)now.tv_nsec;
+}
+
+u64
+GetPerformanceFrequency(void)
+{
+    return 1000000000ull;
+}
@@ -121,7 +121,9 @@ Win32_OnWindowResize(HWND windowHandle, UINT width, UINT height)
 {
     UNUSED(windowHandle);
 
-    if (glad_glViewport != NULL) {
+    // NOTE(gr3yknigh1): Context might be current on render thread instead of
+    // this one. Then viewport is render thread's job. [2025/11/23]
+    if (glad_glViewport != NULL && wglGetCurrentContext() != NULL) {
         GL_CALL(glViewport(0, 0, width, height));
     }
 }
@@ -209,8 +211,12 @@ FileOpenEx(cstring8 filePath, Scratch *allocator, Permissions permissions)
     // https://learn.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-createfilea
     DWORD shareMode = FILE_SHARE_WRITE | FILE_SHARE_READ | FILE_SHARE_DELETE;
 
+    // NOTE(gr3yknigh1): Same as "w" mode of `fopen`. [2025/11/23]
+    DWORD creationDisposition =
+        permissions == PERMISSION_WRITE ? CREATE_ALWAYS : OPEN_EXISTING;
+
     HANDLE win32Handle = CreateFileA(
-        filePath, desiredAccess, shareMode, NULL, OPEN_EXISTING,
+        filePath, desiredAccess, shareMode, NULL, creationDisposition,
         FILE_ATTRIBUTE_NORMAL, NULL);
 
     if (win32Handle == INVALID_HANDLE_VALUE) {
@@ -317,6 +323,26 @@ FileGetSize(FileHandle *handle)
     return result.QuadPart;
 }
 
+FileWriteResultCode
+FileWrite(FileHandle *handle, const void *buffer, usize numberOfBytesToWrite)
+{
+    ASSERT_NONNULL(handle);
+    ASSERT(FileHandleIsValid(handle));
+    ASSERT_NONNULL(buffer);
+
+    DWORD numberOfBytesWritten = 0;
+    BOOL writeFileResult = WriteFile(
+        handle->win32Handle, buffer, (DWORD)numberOfBytesToWrite,
+        &numberOfBytesWritten, NULL);
+
+    if (writeFileResult != TRUE ||
+        numberOfBytesWritten != numberOfBytesToWrite) {
+        return FILE_WRITE_ERR;
+    }
+
+    return FILE_WRITE_OK;
+}
+
 GFS_NORETURN void
 ProcessExit(u32 code)
 {
@@ -354,6 +380,16 @@ IsPathExists(cstring8 path)
     return PathFileExistsA(path);
 }
 
+bool
+MakeDirectory(cstring8 path)
+{
+    if (CreateDirectoryA(path, NULL)) {
+        return true;
+    }
+
+    return GetLastError() == ERROR_ALREADY_EXISTS;
+}
+
 RectangleI32
 WindowGetRectangle(Window *window)
 {
@@ -369,6 +405,17 @@ WindowUpdate(Window *window)
     ASSERT_ISTRUE(SwapBuffers(window->deviceContext));
 }
 
+void
+WindowSetContextCurrent(Window *window, bool isCurrent)
+{
+    if (isCurrent) {
+        ASSERT_ISTRUE(
+            wglMakeCurrent(window->deviceContext, window->renderContext));
+    } else {
+        ASSERT_ISTRUE(wglMakeCurrent(NULL, NULL));
+    }
+}
+
 static void
 Win32_OpenGLContextExts_Init(void)
 {
@@ -1033,3 +1080,129 @@ SoundDeviceClose(SoundDevice *device)
 {
     UNUSED(device);
 }
+
+typedef struct Thread {
+    HANDLE handle;
+    ThreadProc *proc;
+    void *parameter;
+} Thread;
+
+static DWORD WINAPI
+Win32_ThreadEntry(LPVOID parameter)
+{
+    Thread *thread = parameter;
+    thread->proc(thread->parameter);
+    return 0;
+}
+
+Thread *
+ThreadCreate(Scratch *scratch, ThreadProc *proc, void *parameter)
+{
+    Thread *thread = ScratchAllocZero(scratch, sizeof(Thread));
+
+    if (thread == NULL) {
+        return NULL;
+    }
+
+    thread->proc = proc;
+    thread->parameter = parameter;
+    thread->handle = CreateThread(NULL, 0, Win32_ThreadEntry, thread, 0, NULL);
+
+    if (thread->handle == NULL) {
+        return NULL;
+    }
+
+    return thread;
+}
+
+void
+ThreadJoin(Thread *thread)
+{
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+    thread->handle = NULL;
+}
+
+u32
+GetProcessorCount(void)
+{
+    SYSTEM_INFO systemInfo = {0};
+    GetSystemInfo(&systemInfo);
+    return systemInfo.dwNumberOfProcessors;
+}
+
+u32
+AtomicFetchAddU32(volatile u32 *value, u32 addend)
+{
+    return (u32)InterlockedExchangeAdd((volatile LONG *)value, (LONG)addend);
+}
+
+u32
+AtomicLoadU32(volatile u32 *value)
+{
+    return (u32)InterlockedCompareExchange((volatile LONG *)value, 0, 0);
+}
+
+void
+AtomicStoreU32(volatile u32 *value, u32 newValue)
+{
+    InterlockedExchange((volatile LONG *)value, (LONG)newValue);
+}
+
+typedef struct Semaphore {
+    HANDLE handle;
+} Semaphore;
+
+Semaphore *
+SemaphoreCreate(Scratch *scratch, u32 initialCount)
+{
+    Semaphore *semaphore = ScratchAllocZero(scratch, sizeof(Semaphore));
+
+    if (semaphore == NULL) {
+        return NULL;
+    }
+
+    semaphore->handle =
+        CreateSemaphoreA(NULL, (LONG)initialCount, MAXLONG, NULL);
+
+    if (semaphore->handle == NULL) {
+        return NULL;
+    }
+
+    return semaphore;
+}
+
+void
+SemaphoreWait(Semaphore *semaphore)
+{
+    WaitForSingleObject(semaphore->handle, INFINITE);
+}
+
+void
+SemaphoreSignal(Semaphore *semaphore)
+{
+    ReleaseSemaphore(semaphore->handle, 1, NULL);
+}
+
+void
+SemaphoreDestroy(Semaphore *semaphore)
+{
+    CloseHandle(semaphore->handle);
+    semaphore->handle = NULL;
+}
+
+u64
+GetPerformanceCounter(void)
+{
+    LARGE_INTEGER counter = {0};
+    QueryPerformanceCounter(&counter);
+    return (u64)counter.QuadPart;
+}
+
+u64
+GetPerformanceFrequency(void)
+{
+    LARGE_INTEGER frequency = {0};
+    QueryPerformanceFrequency(&frequency);
+    return (u64)frequency.QuadPart;
+}
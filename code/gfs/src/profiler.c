@@ -0,0 +1,167 @@
+/*
+ * FILE      gfs\code\gfs\src\profiler.c
+ * AUTHOR    Ilya Akkuzin <gr3yknigh1@gmail.com>
+ * COPYRIGHT (c) 2025 Ilya Akkuzin
+ * */
+
+#include "gfs/profiler.h"
+
+#include <stdio.h>
+
+#include "gfs/types.h"
+#include "gfs/macros.h"
+#include "gfs/memory.h"
+#include "gfs/assert.h"
+#include "gfs/platform.h"
+
+#define PROFILER_LINE_CAPACITY EXPAND(256)
+
+static cstring8 PROFILER_TRACK_NAMES[PROFILER_TRACK_COUNT] = {"CPU", "GPU"};
+
+Profiler
+ProfilerMake(Scratch *scratch, u32 eventCapacity)
+{
+    Profiler profiler = INIT_EMPTY_STRUCT(Profiler);
+
+    profiler.events =
+        ScratchAlloc(scratch, sizeof(ProfilerEvent) * eventCapacity);
+    ASSERT_NONNULL(profiler.events);
+    profiler.eventCapacity = eventCapacity;
+
+    profiler.frequency = GetPerformanceFrequency();
+    profiler.originCounter = GetPerformanceCounter();
+
+    return profiler;
+}
+
+u64
+ProfilerGetNanoseconds(const Profiler *profiler)
+{
+    u64 ticks = GetPerformanceCounter() - profiler->originCounter;
+    return (u64)((f64)ticks * 1000000000.0 / (f64)profiler->frequency);
+}
+
+void
+ProfilerBeginCapture(Profiler *profiler)
+{
+    profiler->eventCount = 0;
+    profiler->droppedCount = 0;
+    profiler->isCapturing = true;
+}
+
+static bool
+ProfilerWriteString(FileHandle *handle, cstring8 string, i32 length)
+{
+    return length > 0 && length < PROFILER_LINE_CAPACITY &&
+           FileWrite(handle, string, (usize)length) == FILE_WRITE_OK;
+}
+
+bool
+ProfilerEndCapture(Profiler *profiler, Scratch *scratch, cstring8 filePath)
+{
+    profiler->isCapturing = false;
+
+    Scratch temp = TempScratchMake(scratch, KILOBYTES(1));
+    FileOpenResult openResult = FileOpenEx(filePath, &temp, PERMISSION_WRITE);
+    if (openResult.code != FILE_OPEN_OK) {
+        TempScratchClean(&temp, scratch);
+        return false;
+    }
+
+    FileHandle *handle = openResult.handle;
+    char8 line[PROFILER_LINE_CAPACITY];
+    bool isWritten = true;
+
+    // NOTE(gr3yknigh1): Chrome trace event format. Tracks are threads of one
+    // process, timestamps are in microseconds. [2025/11/23]
+    i32 length = snprintf(line, sizeof(line), "{\"traceEvents\":[\n");
+    isWritten = isWritten && ProfilerWriteString(handle, line, length);
+
+    for (u32 track = 0; track < PROFILER_TRACK_COUNT; ++track) {
+        length = snprintf(
+            line, sizeof(line),
+            "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+            "\"args\":{\"name\":\"%s\"}},\n",
+            track, PROFILER_TRACK_NAMES[track]);
+        isWritten = isWritten && ProfilerWriteString(handle, line, length);
+    }
+
+    for (u32 eventIndex = 0; eventIndex < profiler->eventCount; ++eventIndex) {
+        const ProfilerEvent *event = profiler->events + eventIndex;
+
+        length = snprintf(
+            line, sizeof(line),
+            "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+            "\"ts\":%.3f,\"dur\":%.3f},\n",
+            event->name, event->track,
+            (f64)event->beginNanoseconds / 1000.0,
+            (f64)event->durationNanoseconds / 1000.0);
+        isWritten = isWritten && ProfilerWriteString(handle, line, length);
+    }
+
+    // NOTE(gr3yknigh1): Trailing comma of last event is allowed by format,
+    // but strict JSON parsers choke on it, so array ends with metadata
+    // event. [2025/11/23]
+    length = snprintf(
+        line, sizeof(line),
+        "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+        "\"args\":{\"name\":\"gfs\"}}\n]}\n");
+    isWritten = isWritten && ProfilerWriteString(handle, line, length);
+
+    isWritten = FileClose(handle) == FILE_CLOSE_OK && isWritten;
+    TempScratchClean(&temp, scratch);
+
+    return isWritten;
+}
+
+void
+ProfilerPushEvent(
+    Profiler *profiler, ProfilerTrack track, cstring8 name,
+    u64 beginNanoseconds, u64 durationNanoseconds)
+{
+    if (!profiler->isCapturing) {
+        return;
+    }
+
+    if (profiler->eventCount >= profiler->eventCapacity) {
+        profiler->droppedCount += 1;
+        return;
+    }
+
+    ProfilerEvent *event = profiler->events + profiler->eventCount++;
+    event->name = name;
+    event->track = track;
+    event->beginNanoseconds = beginNanoseconds;
+    event->durationNanoseconds = durationNanoseconds;
+}
+
+u32
+ProfilerBeginScope(Profiler *profiler, cstring8 name)
+{
+    if (!profiler->isCapturing) {
+        return PROFILER_INVALID_SCOPE;
+    }
+
+    u32 scope = profiler->eventCount;
+    ProfilerPushEvent(
+        profiler, PROFILER_TRACK_CPU, name, ProfilerGetNanoseconds(profiler),
+        0);
+
+    return scope < profiler->eventCount ? scope : PROFILER_INVALID_SCOPE;
+}
+
+void
+ProfilerEndScope(Profiler *profiler, u32 scope)
+{
+    // NOTE(gr3yknigh1): Capture could restart while scope was open. Handle is
+    // only checked to be in bounds, so such scope gets wrong duration, which
+    // is fine for debug captures. [2025/11/23]
+    if (scope == PROFILER_INVALID_SCOPE || scope >= profiler->eventCount ||
+        !profiler->isCapturing) {
+        return;
+    }
+
+    ProfilerEvent *event = profiler->events + scope;
+    event->durationNanoseconds =
+        ProfilerGetNanoseconds(profiler) - event->beginNanoseconds;
+}
@@ -13,122 +13,412 @@
 #include "gfs/memory.h"
 #include "gfs/macros.h"
 #include "gfs/assert.h"
+#include "gfs/platform.h"
+#include "gfs/job.h"
 #include "gfs/render_opengl.h"
 
-#define RENDER_COMMAND_CAPACITY 1024
-
 const extern Color4RGBA COLOR4RGBA_WHITE = {1, 1, 1, 1};
 const extern Color4RGBA COLOR4RGBA_BLACK = {0, 0, 0, 1};
 const extern Color4RGBA COLOR4RGBA_RED = {1, 0, 0, 1};
 const extern Color4RGBA COLOR4RGBA_GREEN = {0, 1, 0, 1};
 const extern Color4RGBA COLOR4RGBA_BLUE = {0, 0, 1, 1};
 
-#if 0
+RenderSortKey
+RenderSortKeyMake(
+    u32 pass, GLShaderProgramID shader, GLTexture texture, u32 depth)
+{
+    RenderSortKey key = 0;
+
+    key |= (RenderSortKey)(pass & RENDER_SORT_KEY_PASS_MASK)
+           << RENDER_SORT_KEY_PASS_SHIFT;
+    key |= (RenderSortKey)(shader & RENDER_SORT_KEY_SHADER_MASK)
+           << RENDER_SORT_KEY_SHADER_SHIFT;
+    key |= (RenderSortKey)(texture & RENDER_SORT_KEY_TEXTURE_MASK)
+           << RENDER_SORT_KEY_TEXTURE_SHIFT;
+    key |= (RenderSortKey)depth;
+
+    return key;
+}
 
-Renderer
-RendererMake(Window *window, Color4BGRA clearColor) {
-    Renderer r;
+u32
+RenderSortKeyDepth(f32 distance, f32 maxDistance)
+{
+    if (maxDistance <= 0 || distance <= 0) {
+        return 0;
+    }
 
-    r.clearColor = clearColor;
-    r.commandQueue.begin = MemoryAllocate(RENDER_COMMAND_CAPACITY);
-    r.commandQueue.end = r.commandQueue.begin;
-    r.commandCount = 0;
+    if (distance >= maxDistance) {
+        return 0xFFFFFFFF;
+    }
 
-    r.window = window;
-    return r;
+    return (u32)((f64)(distance / maxDistance) * (f64)0xFFFFFFFF);
 }
 
-void
-RendererDestroy(Renderer *renderer) {
-    if (renderer->commandQueue.begin != NULL) {
-        ASSERT_ISZERO(MemoryFree(renderer->commandQueue.begin, RENDER_COMMAND_CAPACITY));
+RenderQueue
+RenderQueueMake(Scratch *scratch, u32 capacity)
+{
+    return RenderQueueMakeEx(scratch, capacity, 0);
+}
+
+RenderQueue
+RenderQueueMakeEx(Scratch *scratch, u32 capacity, u32 uploadCapacity)
+{
+    RenderQueue queue = {0};
+
+    queue.commands = ScratchAlloc(scratch, sizeof(RenderCommand) * capacity);
+    ASSERT_NONNULL(queue.commands);
+    queue.commandCount = 0;
+
+    queue.entries = ScratchAlloc(scratch, sizeof(RenderQueueEntry) * capacity);
+    ASSERT_NONNULL(queue.entries);
+    queue.entriesTemp =
+        ScratchAlloc(scratch, sizeof(RenderQueueEntry) * capacity);
+    ASSERT_NONNULL(queue.entriesTemp);
+    queue.count = 0;
+    queue.capacity = capacity;
+
+    if (uploadCapacity > 0) {
+        queue.uploads =
+            ScratchAlloc(scratch, sizeof(RenderUpload) * uploadCapacity);
+        ASSERT_NONNULL(queue.uploads);
     }
-    renderer->commandQueue.begin = NULL;
-    renderer->commandQueue.end = NULL;
+    queue.uploadCount = 0;
+    queue.uploadCapacity = uploadCapacity;
+
+    return queue;
+}
+
+bool
+RenderQueueIsFull(const RenderQueue *queue)
+{
+    return queue->count >= queue->capacity;
+}
+
+RenderCommand *
+RenderQueuePush(RenderQueue *queue, RenderSortKey key)
+{
+    ASSERT_ISTRUE(queue->count < queue->capacity);
+
+    RenderCommand *command = queue->commands + queue->commandCount++;
+    MemoryZero(command, sizeof(*command));
+
+    RenderQueueEntry *entry = queue->entries + queue->count++;
+    entry->key = key;
+    entry->command = command;
+
+    return command;
 }
 
 void
-BeginDrawing(Renderer *renderer) {
-    UNUSED(renderer);
+RenderQueuePushUpload(
+    RenderQueue *queue, u32 target, u32 buffer, const void *data, usize size)
+{
+    ASSERT_ISTRUE(queue->uploadCount < queue->uploadCapacity);
+
+    RenderUpload *upload = queue->uploads + queue->uploadCount++;
+    upload->target = target;
+    upload->buffer = buffer;
+    upload->data = data;
+    upload->size = size;
 }
 
 void
-EndDrawing(Renderer *renderer) {
+RenderQueueSort(RenderQueue *queue)
+{
+    if (queue->count < 2) {
+        return;
+    }
+
+    RenderQueueEntry *source = queue->entries;
+    RenderQueueEntry *destination = queue->entriesTemp;
+
+    // NOTE(gr3yknigh1): LSD radix sort, one byte of key per pass. It is
+    // stable, so commands with equal keys keep order of recording.
+    // [2025/11/16]
+    for (u32 shift = 0; shift < sizeof(RenderSortKey) * BYTE_BITS;
+         shift += BYTE_BITS) {
+        u32 histogram[256] = {0};
+
+        for (u32 entryIndex = 0; entryIndex < queue->count; ++entryIndex) {
+            ++histogram[(source[entryIndex].key >> shift) & 0xFF];
+        }
+
+        // NOTE(gr3yknigh1): Most of key bytes are the same for all commands
+        // (unused passes, high bytes of depth), such passes would only copy
+        // entries back and forth. [2025/11/16]
+        if (histogram[(source[0].key >> shift) & 0xFF] == queue->count) {
+            continue;
+        }
+
+        u32 offset = 0;
+        for (u32 digit = 0; digit < STATIC_ARRAY_LENGTH(histogram); ++digit) {
+            u32 digitCount = histogram[digit];
+            histogram[digit] = offset;
+            offset += digitCount;
+        }
 
-    renderer->commandQueue.end = renderer->commandQueue.begin;
-    renderer->commandCount = 0;
+        for (u32 entryIndex = 0; entryIndex < queue->count; ++entryIndex) {
+            u32 digit = (source[entryIndex].key >> shift) & 0xFF;
+            destination[histogram[digit]++] = source[entryIndex];
+        }
+
+        RenderQueueEntry *temp = source;
+        source = destination;
+        destination = temp;
+    }
+
+    queue->entries = source;
+    queue->entriesTemp = destination;
 }
 
-#define PUSH_RENDER_COMMAND(RENDERERPTR, PAYLOAD) \
-    do { \
-        MemoryCopy( \
-            (RENDERERPTR)->commandQueue.end, &(PAYLOAD), sizeof((PAYLOAD))); \
-        (RENDERERPTR)->commandQueue.end += sizeof((PAYLOAD)); \
-        (RENDERERPTR)->commandCount++; \
-    } while (0)
+static u64
+RenderQueueCountStateChanges(const RenderQueue *queue)
+{
+    u64 changes = 0;
+
+    const RenderCommand *previous = NULL;
+
+    for (u32 entryIndex = 0; entryIndex < queue->count; ++entryIndex) {
+        const RenderCommand *command = queue->entries[entryIndex].command;
+
+        if (previous == NULL) {
+            changes += 2 + (command->textureTarget != 0) +
+                       (command->dataTextureTarget != 0);
+        } else {
+            changes += previous->shader != command->shader;
+            changes += previous->vertexArray != command->vertexArray;
+            changes += command->textureTarget != 0 &&
+                       (previous->textureTarget != command->textureTarget ||
+                        previous->texture != command->texture);
+            changes +=
+                command->dataTextureTarget != 0 &&
+                (previous->dataTextureTarget != command->dataTextureTarget ||
+                 previous->dataTexture != command->dataTexture);
+        }
+
+        previous = command;
+    }
+
+    return changes;
+}
+
+static void
+RenderQueueExecuteCommand(
+    const RenderCommand *command, GLUniformRing *drawRing)
+{
+    GLUseProgram(command->shader);
+
+    if (command->textureTarget != 0) {
+        GLBindTexture(0, command->textureTarget, command->texture);
+    }
+
+    if (command->dataTextureTarget != 0) {
+        GLBindTexture(
+            RENDER_DATA_TEXTURE_UNIT, command->dataTextureTarget,
+            command->dataTexture);
+    }
+
+    if (command->hasDrawBlock) {
+        ASSERT_NONNULL(drawRing);
+        GLUniformRingPush(
+            drawRing, GL_UNIFORM_BLOCK_BINDING_DRAW, &command->drawBlock,
+            sizeof(command->drawBlock));
+    }
+
+    GLBindVertexArray(command->vertexArray);
+    GLBindBuffer(GL_ELEMENT_ARRAY_BUFFER, command->elementBuffer);
+
+    u32 elementType =
+        command->elementType != 0 ? command->elementType : GL_UNSIGNED_INT;
+    const void *offset = (const void *)(GLIndexTypeGetSize(elementType) *
+                                        (usize)command->firstElement);
+
+    if (command->instanceCount > 0) {
+        GL_CALL(glDrawElementsInstanced(
+            GL_TRIANGLES, command->elementCount, elementType, offset,
+            command->instanceCount));
+    } else {
+        GL_CALL(glDrawElements(
+            GL_TRIANGLES, command->elementCount, elementType, offset));
+    }
+
+    GLRenderStatsRecordDraw(
+        GL_TRIANGLES, command->elementCount, command->instanceCount);
+}
 
 void
-ClearBackground(Renderer *renderer) {
-    struct {
-        RenderCommandType Type;
-        Color4BGRA Color;
-    } payload;
+RenderQueueSubmit(RenderQueue *queue, GLUniformRing *drawRing)
+{
+    for (u32 uploadIndex = 0; uploadIndex < queue->uploadCount;
+         ++uploadIndex) {
+        const RenderUpload *upload = queue->uploads + uploadIndex;
+
+        GLBindBuffer(upload->target, upload->buffer);
+        GL_CALL(glBufferData(
+            upload->target, upload->size, upload->data, GL_DYNAMIC_DRAW));
+        GLRenderStatsRecordBufferUpload(upload->size, true);
+        GLResourceSetSize(
+            GL_RENDER_OBJECT_BUFFER, upload->buffer, upload->size);
+    }
+
+    queue->stats.uploadCount += queue->uploadCount;
+    queue->stats.commandCount += queue->count;
+    queue->stats.stateChangesUnsorted += RenderQueueCountStateChanges(queue);
 
-    payload.Type = BMR_RENDER_COMMAND_TYPE_CLEAR;
-    payload.Color = renderer->clearColor;
+    RenderQueueSort(queue);
 
-    // PUSH_RENDER_COMMAND(renderer, payload);
+    queue->stats.stateChangesSorted += RenderQueueCountStateChanges(queue);
+
+    for (u32 entryIndex = 0; entryIndex < queue->count; ++entryIndex) {
+        const RenderCommand *command = queue->entries[entryIndex].command;
+
+        if (command->elementCount == 0) {
+            continue;
+        }
+
+        RenderQueueExecuteCommand(command, drawRing);
+        ++queue->stats.drawCallCount;
+    }
+
+    queue->count = 0;
+    queue->commandCount = 0;
+    queue->uploadCount = 0;
 }
 
 void
-DrawRectangle(Renderer *renderer, u32 x, u32 y, u32 width, u32 height, Color4BGRA color) {
-    struct {
-        RenderCommandType Type;
-        u32 X;
-        u32 Y;
-        u32 Width;
-        u32 Height;
-        Color4BGRA Color;
-    } payload;
-
-    payload.Type = BMR_RENDER_COMMAND_TYPE_RECT;
-    payload.X = x;
-    payload.Y = y;
-    payload.Width = width;
-    payload.Height = height;
-    payload.Color = color;
-
-    // PUSH_RENDER_COMMAND(renderer, payload);
+RenderQueueResetStats(RenderQueue *queue)
+{
+    MemoryZero(&queue->stats, sizeof(queue->stats));
+}
+
+RenderCommandBuffer
+RenderCommandBufferMake(Scratch *arena, u32 capacity, u32 uploadCapacity)
+{
+    RenderCommandBuffer buffer = {0};
+
+    buffer.keys = ScratchAlloc(arena, sizeof(RenderSortKey) * capacity);
+    ASSERT_NONNULL(buffer.keys);
+    buffer.commands = ScratchAlloc(arena, sizeof(RenderCommand) * capacity);
+    ASSERT_NONNULL(buffer.commands);
+    buffer.count = 0;
+    buffer.capacity = capacity;
+
+    if (uploadCapacity > 0) {
+        buffer.uploads =
+            ScratchAlloc(arena, sizeof(RenderUpload) * uploadCapacity);
+        ASSERT_NONNULL(buffer.uploads);
+    }
+    buffer.uploadCount = 0;
+    buffer.uploadCapacity = uploadCapacity;
+
+    return buffer;
 }
 
 void
-DrawRectangleRec(Renderer *renderer, RectangleU16 rect, Color4BGRA color) {
-    struct {
-        RenderCommandType Type;
-        RectangleU16 Rect;
-        Color4BGRA Color;
-    } payload;
+RenderCommandBufferReset(RenderCommandBuffer *buffer)
+{
+    buffer->count = 0;
+    buffer->uploadCount = 0;
+}
+
+RenderCommand *
+RenderCommandBufferPush(RenderCommandBuffer *buffer, RenderSortKey key)
+{
+    ASSERT_ISTRUE(buffer->count < buffer->capacity);
 
-    payload.Type = BMR_RENDER_COMMAND_TYPE_RECT;
-    payload.Rect = rect;
-    payload.Color = color;
+    u32 commandIndex = buffer->count++;
+    buffer->keys[commandIndex] = key;
 
-    // PUSH_RENDER_COMMAND(renderer, payload);
+    RenderCommand *command = buffer->commands + commandIndex;
+    MemoryZero(command, sizeof(*command));
+
+    return command;
 }
 
 void
-DrawGradient(Renderer *renderer, u32 xOffset, u32 yOffset) {
-    struct {
-        RenderCommandType Type;
-        u32 XOffset;
-        u32 YOffset;
-    } payload;
+RenderCommandBufferPushUpload(
+    RenderCommandBuffer *buffer, u32 target, u32 glBuffer, const void *data,
+    usize size)
+{
+    ASSERT_ISTRUE(buffer->uploadCount < buffer->uploadCapacity);
 
-    payload.Type = BMR_RENDER_COMMAND_TYPE_GRADIENT;
-    payload.XOffset = xOffset;
-    payload.YOffset = yOffset;
+    RenderUpload *upload = buffer->uploads + buffer->uploadCount++;
+    upload->target = target;
+    upload->buffer = glBuffer;
+    upload->data = data;
+    upload->size = size;
+}
 
-    // PUSH_RENDER_COMMAND(renderer, payload);
+void
+RenderQueueMerge(
+    RenderQueue *queue, const RenderCommandBuffer *buffers, u32 buffersCount)
+{
+    for (u32 bufferIndex = 0; bufferIndex < buffersCount; ++bufferIndex) {
+        const RenderCommandBuffer *buffer = buffers + bufferIndex;
+
+        ASSERT_ISTRUE(queue->count + buffer->count <= queue->capacity);
+        ASSERT_ISTRUE(
+            queue->uploadCount + buffer->uploadCount <= queue->uploadCapacity);
+
+        for (u32 commandIndex = 0; commandIndex < buffer->count;
+             ++commandIndex) {
+            RenderQueueEntry *entry = queue->entries + queue->count++;
+            entry->key = buffer->keys[commandIndex];
+            entry->command = buffer->commands + commandIndex;
+        }
+
+        MemoryCopy(
+            queue->uploads + queue->uploadCount, buffer->uploads,
+            sizeof(RenderUpload) * buffer->uploadCount);
+        queue->uploadCount += buffer->uploadCount;
+    }
 }
 
-#endif // 0
\ No newline at end of file
+typedef struct {
+    RenderRecordProc *proc;
+    void *parameter;
+    RenderCommandBuffer *buffer;
+    u32 workerIndex;
+    u32 workerCount;
+} RenderRecordWorker;
+
+static void
+RenderRecordWorkerProc(void *parameter)
+{
+    RenderRecordWorker *worker = parameter;
+    worker->proc(
+        worker->buffer, worker->workerIndex, worker->workerCount,
+        worker->parameter);
+}
+
+void
+RenderRecordParallel(
+    JobSystem *jobs, RenderCommandBuffer *buffers, u32 workerCount,
+    RenderRecordProc *proc, void *parameter)
+{
+    ASSERT_ISTRUE(workerCount > 0 && workerCount <= RENDER_RECORD_MAX_WORKERS);
+    ASSERT_ISTRUE(workerCount - 1 <= jobs->jobCapacity);
+
+    RenderRecordWorker workers[RENDER_RECORD_MAX_WORKERS];
+
+    for (u32 workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+        RenderRecordWorker *worker = workers + workerIndex;
+        worker->proc = proc;
+        worker->parameter = parameter;
+        worker->buffer = buffers + workerIndex;
+        worker->workerIndex = workerIndex;
+        worker->workerCount = workerCount;
+
+        RenderCommandBufferReset(worker->buffer);
+
+        if (workerIndex > 0) {
+            JobSystemAdd(jobs, RenderRecordWorkerProc, worker);
+        }
+    }
+
+    // NOTE(gr3yknigh1): Workers of `jobs` are started once, so frame pays
+    // only for waking them up. [2025/11/23]
+    JobSystemStart(jobs);
+    RenderRecordWorkerProc(workers + 0);
+    JobSystemWait(jobs);
+}
@@ -15,375 +15,2949 @@
 #include "gfs/string.h"
 #include "gfs/types.h"
 
-GLVertexArray
-GLVertexArrayMake(void)
+#define OPENGL_STATE_UNKNOWN ((u32)-1)
+
+typedef enum {
+    OPENGL_CAPABILITY_BLEND,
+    OPENGL_CAPABILITY_DEPTH_TEST,
+    OPENGL_CAPABILITY_CULL_FACE,
+    OPENGL_CAPABILITY_SCISSOR_TEST,
+    OPENGL_CAPABILITY_COUNT,
+} OpenGL_Capability;
+
+typedef enum {
+    OPENGL_TEXTURE_TARGET_2D,
+    OPENGL_TEXTURE_TARGET_2D_ARRAY,
+    OPENGL_TEXTURE_TARGET_BUFFER,
+    OPENGL_TEXTURE_TARGET_COUNT,
+} OpenGL_TextureTarget;
+
+/*
+ * @breaf Shadow copy of OpenGL state. `OPENGL_STATE_UNKNOWN` means that value
+ * is not known and next call will be issued anyway.
+ */
+typedef struct {
+    bool isInitialized;
+
+    u32 program;
+    u32 vertexArray;
+    u32 arrayBuffer;
+    u32 elementArrayBuffer;
+
+    u32 activeTextureUnit;
+    u32 textures[GL_STATE_CACHE_TEXTURE_UNIT_COUNT]
+                [OPENGL_TEXTURE_TARGET_COUNT];
+
+    u32 capabilities[OPENGL_CAPABILITY_COUNT];
+
+    u32 blendSourceFactor;
+    u32 blendDestinationFactor;
+    u32 cullFaceMode;
+    u32 polygonMode;
+
+    struct {
+        u32 buffer;
+        usize offset;
+        usize size;
+    } uniformBindings[GL_STATE_CACHE_UNIFORM_BINDING_COUNT];
+
+    GLStateCacheCounters counters;
+} OpenGL_StateCache;
+
+static OpenGL_StateCache gStateCache;
+
+static GLRenderStats gRenderStats;
+
+typedef struct {
+    u32 handle; // Zero if slot is empty.
+    GLRenderObjectType type;
+    usize size;
+    u32 lastUsedFrame;
+
+    GLResourceEvictProc *evict; // Not `NULL` if resource is evictable.
+    void *evictParameter;
+} OpenGL_Resource;
+
+typedef struct {
+    GLRenderObjectType type;
+    u32 handle;
+} OpenGL_ResourceDeletion;
+
+typedef struct {
+    GLsync fence;
+    u32 deletionsEnd; // Deletions before it wait for this fence.
+} OpenGL_ResourceDeletionFrame;
+
+/*
+ * @breaf Open addressing table of alive objects, keyed by type and handle,
+ * plus ring of deletions, which are fenced once per frame.
+ */
+typedef struct {
+    OpenGL_Resource resources[GL_RESOURCE_REGISTRY_CAPACITY];
+    u32 count;
+    u32 frameIndex;
+
+    OpenGL_ResourceDeletion deletions[GL_RESOURCE_DELETION_CAPACITY];
+    u32 deletionsPushed;
+    u32 deletionsDone;
+
+    OpenGL_ResourceDeletionFrame
+        deletionFrames[GL_RESOURCE_DELETION_FRAME_COUNT];
+    u32 deletionFramesPushed;
+    u32 deletionFramesDone;
+
+    GLResourceStats stats;
+} OpenGL_ResourceRegistry;
+
+static OpenGL_ResourceRegistry gResourceRegistry;
+
+static OpenGL_StateCache *
+OpenGL_GetStateCache(void)
 {
-    GLuint vao = 0;
-    GL_CALL(glGenVertexArrays(1, &vao));
-    GL_CALL(glBindVertexArray(vao));
-    return (GLVertexArray)vao;
+    if (!gStateCache.isInitialized) {
+        GLStateCacheInvalidate();
+    }
+
+    return &gStateCache;
+}
+
+/*
+ * @breaf Stores `value` in the cache.
+ *
+ * @return `true` if value was changed and call should be issued.
+ */
+static bool
+OpenGL_StateCacheUpdate(u32 *cachedValue, u32 value)
+{
+    if (*cachedValue == value) {
+        ++gStateCache.counters.skippedCount;
+        return false;
+    }
+
+    *cachedValue = value;
+    ++gStateCache.counters.issuedCount;
+    return true;
 }
 
 void
-GLVertexArrayAddBuffer(
-    GLVertexArray va, const GLVertexBuffer *vb,
-    const GLVertexBufferLayout *layout)
+GLStateCacheInvalidate(void)
 {
+    gStateCache.isInitialized = true;
 
-    GL_CALL(glBindVertexArray(va));
-    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vb->id));
+    gStateCache.program = OPENGL_STATE_UNKNOWN;
+    gStateCache.vertexArray = OPENGL_STATE_UNKNOWN;
+    gStateCache.arrayBuffer = OPENGL_STATE_UNKNOWN;
+    gStateCache.elementArrayBuffer = OPENGL_STATE_UNKNOWN;
 
-    u64 offset = 0;
+    gStateCache.activeTextureUnit = OPENGL_STATE_UNKNOWN;
+    for (u32 unit = 0; unit < GL_STATE_CACHE_TEXTURE_UNIT_COUNT; ++unit) {
+        for (u32 target = 0; target < OPENGL_TEXTURE_TARGET_COUNT; ++target) {
+            gStateCache.textures[unit][target] = OPENGL_STATE_UNKNOWN;
+        }
+    }
 
-    for (u32 attributeIndex = 0; attributeIndex < layout->attributesCount;
-         ++attributeIndex) {
-        GLAttribute *attribute = layout->attributes + attributeIndex;
+    for (u32 capability = 0; capability < OPENGL_CAPABILITY_COUNT;
+         ++capability) {
+        gStateCache.capabilities[capability] = OPENGL_STATE_UNKNOWN;
+    }
 
-        GL_CALL(glEnableVertexAttribArray(attributeIndex));
-        GL_CALL(glVertexAttribPointer(
-            attributeIndex, attribute->count, attribute->type,
-            attribute->isNormalized, layout->stride, (void *)offset));
+    gStateCache.blendSourceFactor = OPENGL_STATE_UNKNOWN;
+    gStateCache.blendDestinationFactor = OPENGL_STATE_UNKNOWN;
+    gStateCache.cullFaceMode = OPENGL_STATE_UNKNOWN;
+    gStateCache.polygonMode = OPENGL_STATE_UNKNOWN;
 
-        offset += attribute->size * attribute->count;
+    for (u32 binding = 0; binding < GL_STATE_CACHE_UNIFORM_BINDING_COUNT;
+         ++binding) {
+        gStateCache.uniformBindings[binding].buffer = OPENGL_STATE_UNKNOWN;
     }
 }
 
-GLVertexBuffer
-GLVertexBufferMake(const void *dataBuffer, usize dataBufferSize)
+GLStateCacheCounters
+GLStateCacheGetCounters(void)
 {
-    GLVertexBuffer buffer = {0};
+    return gStateCache.counters;
+}
 
-    buffer.id = 0;
-    buffer.data = dataBuffer;
-    buffer.size = dataBufferSize;
+void
+GLStateCacheResetCounters(void)
+{
+    gStateCache.counters.issuedCount = 0;
+    gStateCache.counters.skippedCount = 0;
+}
 
-    GL_CALL(glGenBuffers(1, &buffer.id));
-    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, buffer.id));
-    GL_CALL(glBufferData(
-        GL_ARRAY_BUFFER, dataBufferSize, dataBuffer,
-        GL_DYNAMIC_DRAW /* GL_STATIC_DRAW */));
+GLRenderStats
+GLRenderStatsGet(void)
+{
+    GLRenderStats stats = gRenderStats;
+    MemoryCopy(
+        stats.objectCounts, gResourceRegistry.stats.counts,
+        sizeof(stats.objectCounts));
+    return stats;
+}
 
-    return buffer;
+void
+GLRenderStatsResetFrame(void)
+{
+    gRenderStats = INIT_EMPTY_STRUCT(GLRenderStats);
 }
 
 void
-GLVertexBufferSendData(
-    GLVertexBuffer *buffer, const void *dataBuffer, usize dataBufferSize)
+GLRenderStatsRecordDraw(u32 mode, u32 vertexCount, u32 instanceCount)
 {
-    buffer->data = dataBuffer;
-    buffer->size = dataBufferSize;
+    u64 triangleCount = 0;
+
+    if (mode == GL_TRIANGLES) {
+        triangleCount = vertexCount / 3;
+    } else if (
+        (mode == GL_TRIANGLE_STRIP || mode == GL_TRIANGLE_FAN) &&
+        vertexCount >= 3) {
+        triangleCount = vertexCount - 2;
+    }
 
-    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, buffer->id));
-    GL_CALL(glBufferData(
-        GL_ARRAY_BUFFER, buffer->size, buffer->data,
-        GL_DYNAMIC_DRAW /* GL_STATIC_DRAW */));
+    gRenderStats.drawCallCount += 1;
+    gRenderStats.triangleCount +=
+        triangleCount * (instanceCount > 0 ? instanceCount : 1);
 }
 
-GLIndexBuffer
-GLIndexBufferMake(const void *indexBuffer, usize indexBufferSize)
+void
+GLRenderStatsRecordBufferUpload(usize size, bool isAllocation)
 {
-    GLuint ebo = 0;
+    gRenderStats.bufferUploadBytes += size;
+    if (isAllocation) {
+        gRenderStats.bufferAllocationCount += 1;
+    }
+}
 
-    GL_CALL(glGenBuffers(1, &ebo));
-    GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo));
-    GL_CALL(glBufferData(
-        GL_ELEMENT_ARRAY_BUFFER, indexBufferSize, indexBuffer,
-        GL_DYNAMIC_DRAW /* GL_STATIC_DRAW */));
+void
+GLRenderStatsRecordTextureUpload(usize size)
+{
+    gRenderStats.textureUploadCount += 1;
+    gRenderStats.textureUploadBytes += size;
+}
 
-    return (GLIndexBuffer)ebo;
+static u32
+OpenGL_ResourceHash(GLRenderObjectType type, u32 handle)
+{
+    // NOTE(gr3yknigh1): Fibonacci hashing, handles are small sequential
+    // numbers, so they need to be spread. [2025/11/23]
+    u32 key = handle * GL_RENDER_OBJECT_COUNT + (u32)type;
+    return (key * 2654435769u) & (GL_RESOURCE_REGISTRY_CAPACITY - 1);
 }
 
-GLElementBuffer
-GLElementBufferMake(const u32 *elements, u64 count)
+static OpenGL_Resource *
+OpenGL_ResourceFind(GLRenderObjectType type, u32 handle)
 {
-    GLElementBuffer eb;
+    u32 index = OpenGL_ResourceHash(type, handle);
 
-    usize elementsBufferSize = sizeof(elements[0]) * count;
+    for (u32 probe = 0; probe < GL_RESOURCE_REGISTRY_CAPACITY; ++probe) {
+        OpenGL_Resource *resource = gResourceRegistry.resources + index;
 
-    GL_CALL(glGenBuffers(1, &(eb.id)));
-    GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, eb.id));
-    GL_CALL(glBufferData(
-        GL_ELEMENT_ARRAY_BUFFER, elementsBufferSize, (const void *)elements,
-        GL_DYNAMIC_DRAW /* GL_STATIC_DRAW */));
-    GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, eb.id)); // @cleanup
+        if (resource->handle == 0) {
+            return NULL;
+        }
+        if (resource->handle == handle && resource->type == type) {
+            return resource;
+        }
 
-    eb.elements = elements;
-    eb.count = count;
+        index = (index + 1) & (GL_RESOURCE_REGISTRY_CAPACITY - 1);
+    }
 
-    return eb;
+    return NULL;
+}
+
+static void
+OpenGL_ResourceAccount(const OpenGL_Resource *resource, bool isAdding)
+{
+    GLResourceStats *stats = &gResourceRegistry.stats;
+    GLRenderObjectType type = resource->type;
+
+    if (isAdding) {
+        stats->counts[type] += 1;
+        stats->bytes[type] += resource->size;
+        stats->totalBytes += resource->size;
+        if (resource->evict != NULL) {
+            stats->evictableBytes += resource->size;
+        }
+    } else {
+        stats->counts[type] -= 1;
+        stats->bytes[type] -= resource->size;
+        stats->totalBytes -= resource->size;
+        if (resource->evict != NULL) {
+            stats->evictableBytes -= resource->size;
+        }
+    }
 }
 
 void
-GLElementBufferSendData(GLElementBuffer *buffer, const u32 *indicies, u64 count)
+GLResourceRegister(GLRenderObjectType type, u32 handle, usize size)
 {
-    buffer->elements = indicies;
-    buffer->count = count;
+    ASSERT_ISTRUE(type < GL_RENDER_OBJECT_COUNT);
+    ASSERT_NONZERO(handle);
+
+    // NOTE(gr3yknigh1): Load is kept under 3/4, so probes stay short and
+    // lookup of missing handle always hits empty slot. [2025/11/23]
+    if (gResourceRegistry.count >= GL_RESOURCE_REGISTRY_CAPACITY / 4 * 3) {
+        gResourceRegistry.stats.untrackedCount += 1;
+        return;
+    }
 
-    usize elementsBufferSize = sizeof(buffer->elements[0]) * buffer->count;
+    u32 index = OpenGL_ResourceHash(type, handle);
+    while (gResourceRegistry.resources[index].handle != 0) {
+        ASSERT_ISFALSE(
+            gResourceRegistry.resources[index].handle == handle &&
+            gResourceRegistry.resources[index].type == type);
+        index = (index + 1) & (GL_RESOURCE_REGISTRY_CAPACITY - 1);
+    }
 
-    GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->id));
-    GL_CALL(glBufferData(
-        GL_ELEMENT_ARRAY_BUFFER, elementsBufferSize,
-        (const void *)buffer->elements, GL_DYNAMIC_DRAW /* GL_STATIC_DRAW */));
+    OpenGL_Resource *resource = gResourceRegistry.resources + index;
+    resource->handle = handle;
+    resource->type = type;
+    resource->size = size;
+    resource->lastUsedFrame = gResourceRegistry.frameIndex;
+    resource->evict = NULL;
+    resource->evictParameter = NULL;
+
+    gResourceRegistry.count += 1;
+    OpenGL_ResourceAccount(resource, true);
 }
 
-GLVertexBufferLayout
-GLVertexBufferLayoutMake(Scratch *scratch)
+/*
+ * @breaf Removes resource from table. Following entries of the probe chain are
+ * shifted back, so lookups never need tombstones.
+ */
+static void
+OpenGL_ResourceRemove(OpenGL_Resource *resource)
 {
-    GLVertexBufferLayout layout = {0};
+    OpenGL_ResourceAccount(resource, false);
+    gResourceRegistry.count -= 1;
+
+    u32 mask = GL_RESOURCE_REGISTRY_CAPACITY - 1;
+    u32 hole = (u32)(resource - gResourceRegistry.resources);
+    u32 index = hole;
+
+    for (;;) {
+        index = (index + 1) & mask;
+        OpenGL_Resource *next = gResourceRegistry.resources + index;
+        if (next->handle == 0) {
+            break;
+        }
 
-    layout.scratch = scratch;
-    layout.attributes = ScratchAllocZero(
-        scratch,
-        KILOBYTES(1)); // TODO(gr3yknigh1): replace with generic allocator
-    layout.attributesCount = 0;
-    layout.stride = 0;
+        u32 home = OpenGL_ResourceHash(next->type, next->handle);
+        if (((index - home) & mask) >= ((index - hole) & mask)) {
+            gResourceRegistry.resources[hole] = *next;
+            hole = index;
+        }
+    }
 
-    return layout;
+    gResourceRegistry.resources[hole] = INIT_EMPTY_STRUCT(OpenGL_Resource);
 }
 
 void
-GLVertexBufferLayoutPushAttributeF32(GLVertexBufferLayout *layout, u32 count)
+GLResourceSetSize(GLRenderObjectType type, u32 handle, usize size)
 {
-    usize attributeSize = sizeof(f32);
+    OpenGL_Resource *resource = OpenGL_ResourceFind(type, handle);
+    if (resource == NULL) {
+        return;
+    }
 
-    GLAttribute *attribute = layout->attributes + layout->attributesCount;
-    attribute->isNormalized = false;
-    attribute->type = GL_FLOAT;
-    attribute->count = count;
-    attribute->size = attributeSize;
+    OpenGL_ResourceAccount(resource, false);
+    resource->size = size;
+    OpenGL_ResourceAccount(resource, true);
+}
 
-    layout->attributesCount += 1;
-    layout->stride += attributeSize * count;
+void
+GLResourceSetEvictable(
+    GLRenderObjectType type, u32 handle, GLResourceEvictProc *evict,
+    void *parameter)
+{
+    OpenGL_Resource *resource = OpenGL_ResourceFind(type, handle);
+    if (resource == NULL) {
+        return;
+    }
+
+    OpenGL_ResourceAccount(resource, false);
+    resource->evict = evict;
+    resource->evictParameter = parameter;
+    OpenGL_ResourceAccount(resource, true);
 }
 
 void
-GLClear(f32 r, f32 g, f32 b, f32 a)
+GLResourceTouch(GLRenderObjectType type, u32 handle)
 {
-    GL_CALL(glClearColor(r, g, b, a));
-    GL_CALL(glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT));
+    OpenGL_Resource *resource = OpenGL_ResourceFind(type, handle);
+    if (resource != NULL) {
+        resource->lastUsedFrame = gResourceRegistry.frameIndex;
+    }
+}
+
+/*
+ * @breaf Deletes object right away. OpenGL drops it from bindings of current
+ * context, so state cache has to forget it too.
+ */
+static void
+OpenGL_ResourceDelete(GLRenderObjectType type, u32 handle)
+{
+    OpenGL_StateCache *cache = OpenGL_GetStateCache();
+
+    switch (type) {
+    case GL_RENDER_OBJECT_BUFFER:
+        if (cache->arrayBuffer == handle) {
+            cache->arrayBuffer = 0;
+        }
+        if (cache->elementArrayBuffer == handle) {
+            cache->elementArrayBuffer = 0;
+        }
+        for (u32 binding = 0; binding < GL_STATE_CACHE_UNIFORM_BINDING_COUNT;
+             ++binding) {
+            if (cache->uniformBindings[binding].buffer == handle) {
+                cache->uniformBindings[binding].buffer = OPENGL_STATE_UNKNOWN;
+            }
+        }
+        GL_CALL(glDeleteBuffers(1, &handle));
+        break;
+    case GL_RENDER_OBJECT_TEXTURE:
+        // NOTE(gr3yknigh1): OpenGL unbinds deleted texture and may give it's
+        // name to the next created one. [2025/11/16]
+        for (u32 unit = 0; unit < GL_STATE_CACHE_TEXTURE_UNIT_COUNT; ++unit) {
+            for (u32 target = 0; target < OPENGL_TEXTURE_TARGET_COUNT;
+                 ++target) {
+                if (cache->textures[unit][target] == handle) {
+                    cache->textures[unit][target] = 0;
+                }
+            }
+        }
+        GL_CALL(glDeleteTextures(1, &handle));
+        break;
+    case GL_RENDER_OBJECT_VERTEX_ARRAY:
+        // NOTE(gr3yknigh1): Element buffer binding is part of vertex array,
+        // so it's unknown after fallback to vertex array 0. [2025/11/23]
+        if (cache->vertexArray == handle) {
+            cache->vertexArray = 0;
+            cache->elementArrayBuffer = OPENGL_STATE_UNKNOWN;
+        }
+        GL_CALL(glDeleteVertexArrays(1, &handle));
+        break;
+    case GL_RENDER_OBJECT_PROGRAM:
+        if (cache->program == handle) {
+            cache->program = OPENGL_STATE_UNKNOWN;
+        }
+        GL_CALL(glDeleteProgram(handle));
+        break;
+    case GL_RENDER_OBJECT_SHADER:
+        GL_CALL(glDeleteShader(handle));
+        break;
+    case GL_RENDER_OBJECT_RENDERBUFFER:
+        GL_CALL(glDeleteRenderbuffers(1, &handle));
+        break;
+    case GL_RENDER_OBJECT_FRAMEBUFFER:
+        GL_CALL(glDeleteFramebuffers(1, &handle));
+        break;
+    default:
+        ASSERT_ISTRUE(false);
+        break;
+    }
+
+    gResourceRegistry.stats.deletedCount += 1;
 }
 
 void
-GLClearEx(f32 r, f32 g, f32 b, f32 a, i32 clearMask)
+GLResourceDestroy(GLRenderObjectType type, u32 handle)
 {
-    GL_CALL(glClearColor(r, g, b, a));
-    GL_CALL(glClear(clearMask));
+    if (handle == 0) {
+        return;
+    }
+
+    OpenGL_Resource *resource = OpenGL_ResourceFind(type, handle);
+    if (resource != NULL) {
+        OpenGL_ResourceRemove(resource);
+    }
+
+    u32 pendingCount =
+        gResourceRegistry.deletionsPushed - gResourceRegistry.deletionsDone;
+    if (pendingCount >= GL_RESOURCE_DELETION_CAPACITY) {
+        // NOTE(gr3yknigh1): Driver defers freeing of objects in use anyway,
+        // queue only keeps handle from being reused too early. [2025/11/23]
+        OpenGL_ResourceDelete(type, handle);
+        return;
+    }
+
+    OpenGL_ResourceDeletion *deletion =
+        gResourceRegistry.deletions +
+        gResourceRegistry.deletionsPushed % GL_RESOURCE_DELETION_CAPACITY;
+    deletion->type = type;
+    deletion->handle = handle;
+    gResourceRegistry.deletionsPushed += 1;
+}
+
+/*
+ * @breaf Deletes objects of oldest fenced frame.
+ */
+static void
+OpenGL_ResourceRegistryRetireFrame(void)
+{
+    OpenGL_ResourceDeletionFrame *frame =
+        gResourceRegistry.deletionFrames +
+        gResourceRegistry.deletionFramesDone % GL_RESOURCE_DELETION_FRAME_COUNT;
+
+    while (gResourceRegistry.deletionsDone != frame->deletionsEnd) {
+        OpenGL_ResourceDeletion *deletion =
+            gResourceRegistry.deletions +
+            gResourceRegistry.deletionsDone % GL_RESOURCE_DELETION_CAPACITY;
+        OpenGL_ResourceDelete(deletion->type, deletion->handle);
+        gResourceRegistry.deletionsDone += 1;
+    }
+
+    GL_CALL(glDeleteSync(frame->fence));
+    frame->fence = NULL;
+    gResourceRegistry.deletionFramesDone += 1;
+}
+
+static bool
+OpenGL_ResourceRegistryWaitFrame(GLuint64 timeout)
+{
+    OpenGL_ResourceDeletionFrame *frame =
+        gResourceRegistry.deletionFrames +
+        gResourceRegistry.deletionFramesDone % GL_RESOURCE_DELETION_FRAME_COUNT;
+
+    GLenum status;
+    GL_CALL_O(
+        glClientWaitSync(
+            frame->fence, timeout > 0 ? GL_SYNC_FLUSH_COMMANDS_BIT : 0,
+            timeout),
+        &status);
+    return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+}
+
+static void
+OpenGL_ResourceRegistryEvict(void)
+{
+    GLResourceStats *stats = &gResourceRegistry.stats;
+
+    // NOTE(gr3yknigh1): Linear scan per eviction. It happens only over
+    // budget, and resources used in current frame are never picked, so it
+    // stops quickly. [2025/11/23]
+    while (stats->budgetBytes > 0 && stats->totalBytes > stats->budgetBytes) {
+        OpenGL_Resource *victim = NULL;
+
+        for (u32 index = 0; index < GL_RESOURCE_REGISTRY_CAPACITY; ++index) {
+            OpenGL_Resource *resource = gResourceRegistry.resources + index;
+
+            if (resource->handle == 0 || resource->evict == NULL ||
+                resource->lastUsedFrame >= gResourceRegistry.frameIndex) {
+                continue;
+            }
+
+            if (victim == NULL ||
+                resource->lastUsedFrame < victim->lastUsedFrame) {
+                victim = resource;
+            }
+        }
+
+        if (victim == NULL) {
+            break;
+        }
+
+        GLRenderObjectType type = victim->type;
+        u32 handle = victim->handle;
+        victim->evict(type, handle, victim->evictParameter);
+
+        GLResourceDestroy(type, handle);
+        stats->evictedCount += 1;
+    }
 }
 
 void
-GLDrawElements(
-    const GLElementBuffer *eb, const GLVertexBuffer *vb, GLVertexArray va)
+GLResourceRegistryUpdate(void)
 {
-    UNUSED(vb);
+    OpenGL_ResourceRegistryEvict();
+
+    // NOTE(gr3yknigh1): Deletions, which aren't covered by any fence yet.
+    // Deletions of retired frames are all done. [2025/11/23]
+    u32 fencedEnd = gResourceRegistry.deletionsDone;
+    if (gResourceRegistry.deletionFramesPushed >
+        gResourceRegistry.deletionFramesDone) {
+        u32 lastFrameIndex = (gResourceRegistry.deletionFramesPushed - 1) %
+                             GL_RESOURCE_DELETION_FRAME_COUNT;
+        fencedEnd =
+            gResourceRegistry.deletionFrames[lastFrameIndex].deletionsEnd;
+    }
+
+    if (fencedEnd != gResourceRegistry.deletionsPushed) {
+        if (gResourceRegistry.deletionFramesPushed -
+                gResourceRegistry.deletionFramesDone >=
+            GL_RESOURCE_DELETION_FRAME_COUNT) {
+            OpenGL_ResourceRegistryWaitFrame(GL_TIMEOUT_IGNORED);
+            OpenGL_ResourceRegistryRetireFrame();
+        }
+
+        OpenGL_ResourceDeletionFrame *frame =
+            gResourceRegistry.deletionFrames +
+            gResourceRegistry.deletionFramesPushed %
+                GL_RESOURCE_DELETION_FRAME_COUNT;
+
+        GLsync fence;
+        GL_CALL_O(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), &fence);
+        frame->fence = fence;
+        frame->deletionsEnd = gResourceRegistry.deletionsPushed;
+        gResourceRegistry.deletionFramesPushed += 1;
+    }
+
+    // NOTE(gr3yknigh1): Fences signal in order of submission. [2025/11/23]
+    while (gResourceRegistry.deletionFramesDone <
+               gResourceRegistry.deletionFramesPushed &&
+           OpenGL_ResourceRegistryWaitFrame(0)) {
+        OpenGL_ResourceRegistryRetireFrame();
+    }
+
+    gResourceRegistry.frameIndex += 1;
+}
+
+void
+GLResourceRegistryFlush(void)
+{
+    while (gResourceRegistry.deletionFramesDone <
+           gResourceRegistry.deletionFramesPushed) {
+        OpenGL_ResourceRegistryWaitFrame(GL_TIMEOUT_IGNORED);
+        OpenGL_ResourceRegistryRetireFrame();
+    }
+
+    // NOTE(gr3yknigh1): Deletions of current frame aren't fenced yet. After
+    // `glFinish` nothing can use them. [2025/11/23]
+    if (gResourceRegistry.deletionsDone != gResourceRegistry.deletionsPushed) {
+        GL_CALL(glFinish());
+    }
+
+    while (gResourceRegistry.deletionsDone !=
+           gResourceRegistry.deletionsPushed) {
+        OpenGL_ResourceDeletion *deletion =
+            gResourceRegistry.deletions +
+            gResourceRegistry.deletionsDone % GL_RESOURCE_DELETION_CAPACITY;
+        OpenGL_ResourceDelete(deletion->type, deletion->handle);
+        gResourceRegistry.deletionsDone += 1;
+    }
+}
+
+void
+GLResourceRegistrySetBudget(usize budgetBytes)
+{
+    gResourceRegistry.stats.budgetBytes = budgetBytes;
+}
+
+GLResourceStats
+GLResourceRegistryGetStats(void)
+{
+    GLResourceStats stats = gResourceRegistry.stats;
+    stats.pendingDeletionCount =
+        gResourceRegistry.deletionsPushed - gResourceRegistry.deletionsDone;
+    return stats;
+}
+
+void
+GLUseProgram(GLShaderProgramID program)
+{
+    OpenGL_StateCache *cache = OpenGL_GetStateCache();
+
+    if (OpenGL_StateCacheUpdate(&cache->program, program)) {
+        GL_CALL(glUseProgram(program));
+        gRenderStats.programBindCount += 1;
+    }
+}
+
+void
+GLBindVertexArray(GLVertexArray va)
+{
+    OpenGL_StateCache *cache = OpenGL_GetStateCache();
+
+    if (OpenGL_StateCacheUpdate(&cache->vertexArray, va)) {
+        GL_CALL(glBindVertexArray(va));
+        gRenderStats.vertexArrayBindCount += 1;
+
+        // NOTE(gr3yknigh1): Each VAO has it's own element buffer binding.
+        // [2025/11/16]
+        cache->elementArrayBuffer = OPENGL_STATE_UNKNOWN;
+    }
+}
+
+void
+GLBindBuffer(u32 target, u32 buffer)
+{
+    OpenGL_StateCache *cache = OpenGL_GetStateCache();
+
+    u32 *cachedBuffer = NULL;
+
+    if (target == GL_ARRAY_BUFFER) {
+        cachedBuffer = &cache->arrayBuffer;
+    } else if (target == GL_ELEMENT_ARRAY_BUFFER) {
+        cachedBuffer = &cache->elementArrayBuffer;
+    }
+
+    if (cachedBuffer == NULL) {
+        ++cache->counters.issuedCount;
+        GL_CALL(glBindBuffer(target, buffer));
+        return;
+    }
+
+    if (OpenGL_StateCacheUpdate(cachedBuffer, buffer)) {
+        GL_CALL(glBindBuffer(target, buffer));
+    }
+}
+
+static void
+OpenGL_SetActiveTextureUnit(OpenGL_StateCache *cache, u32 unit)
+{
+    if (OpenGL_StateCacheUpdate(&cache->activeTextureUnit, unit)) {
+        GL_CALL(glActiveTexture(GL_TEXTURE0 + unit));
+    }
+}
+
+void
+GLBindTexture(u32 unit, u32 target, GLTexture texture)
+{
+    OpenGL_StateCache *cache = OpenGL_GetStateCache();
+
+    OpenGL_TextureTarget cachedTarget = OPENGL_TEXTURE_TARGET_COUNT;
+
+    if (target == GL_TEXTURE_2D) {
+        cachedTarget = OPENGL_TEXTURE_TARGET_2D;
+    } else if (target == GL_TEXTURE_2D_ARRAY) {
+        cachedTarget = OPENGL_TEXTURE_TARGET_2D_ARRAY;
+    } else if (target == GL_TEXTURE_BUFFER) {
+        cachedTarget = OPENGL_TEXTURE_TARGET_BUFFER;
+    }
+
+    if (unit >= GL_STATE_CACHE_TEXTURE_UNIT_COUNT ||
+        cachedTarget == OPENGL_TEXTURE_TARGET_COUNT) {
+        OpenGL_SetActiveTextureUnit(cache, unit);
+
+        ++cache->counters.issuedCount;
+        GL_CALL(glBindTexture(target, texture));
+        gRenderStats.textureBindCount += 1;
+        return;
+    }
+
+    u32 *cachedTexture = &cache->textures[unit][cachedTarget];
+
+    if (*cachedTexture == texture) {
+        ++cache->counters.skippedCount;
+        return;
+    }
+
+    OpenGL_SetActiveTextureUnit(cache, unit);
+
+    *cachedTexture = texture;
+    ++cache->counters.issuedCount;
+    GL_CALL(glBindTexture(target, texture));
+    gRenderStats.textureBindCount += 1;
+}
+
+void
+GLSetCapability(u32 capability, bool isEnabled)
+{
+    OpenGL_StateCache *cache = OpenGL_GetStateCache();
+
+    OpenGL_Capability cachedCapability = OPENGL_CAPABILITY_COUNT;
+
+    if (capability == GL_BLEND) {
+        cachedCapability = OPENGL_CAPABILITY_BLEND;
+    } else if (capability == GL_DEPTH_TEST) {
+        cachedCapability = OPENGL_CAPABILITY_DEPTH_TEST;
+    } else if (capability == GL_CULL_FACE) {
+        cachedCapability = OPENGL_CAPABILITY_CULL_FACE;
+    } else if (capability == GL_SCISSOR_TEST) {
+        cachedCapability = OPENGL_CAPABILITY_SCISSOR_TEST;
+    }
+
+    if (cachedCapability == OPENGL_CAPABILITY_COUNT) {
+        ++cache->counters.issuedCount;
+    } else if (!OpenGL_StateCacheUpdate(
+                   &cache->capabilities[cachedCapability], isEnabled)) {
+        return;
+    }
+
+    if (isEnabled) {
+        GL_CALL(glEnable(capability));
+    } else {
+        GL_CALL(glDisable(capability));
+    }
+}
+
+void
+GLBlendFunc(u32 sourceFactor, u32 destinationFactor)
+{
+    OpenGL_StateCache *cache = OpenGL_GetStateCache();
+
+    if (cache->blendSourceFactor == sourceFactor &&
+        cache->blendDestinationFactor == destinationFactor) {
+        ++cache->counters.skippedCount;
+        return;
+    }
+
+    cache->blendSourceFactor = sourceFactor;
+    cache->blendDestinationFactor = destinationFactor;
+    ++cache->counters.issuedCount;
+
+    GL_CALL(glBlendFunc(sourceFactor, destinationFactor));
+}
+
+void
+GLCullFace(u32 mode)
+{
+    OpenGL_StateCache *cache = OpenGL_GetStateCache();
+
+    if (OpenGL_StateCacheUpdate(&cache->cullFaceMode, mode)) {
+        GL_CALL(glCullFace(mode));
+    }
+}
+
+void
+GLPolygonMode(u32 mode)
+{
+    OpenGL_StateCache *cache = OpenGL_GetStateCache();
+
+    if (OpenGL_StateCacheUpdate(&cache->polygonMode, mode)) {
+        GL_CALL(glPolygonMode(GL_FRONT_AND_BACK, mode));
+    }
+}
+
+void
+GLBindUniformBufferRange(u32 binding, u32 buffer, usize offset, usize size)
+{
+    OpenGL_StateCache *cache = OpenGL_GetStateCache();
+
+    if (binding < GL_STATE_CACHE_UNIFORM_BINDING_COUNT) {
+        if (cache->uniformBindings[binding].buffer == buffer &&
+            cache->uniformBindings[binding].offset == offset &&
+            cache->uniformBindings[binding].size == size) {
+            ++cache->counters.skippedCount;
+            return;
+        }
+
+        cache->uniformBindings[binding].buffer = buffer;
+        cache->uniformBindings[binding].offset = offset;
+        cache->uniformBindings[binding].size = size;
+    }
+
+    ++cache->counters.issuedCount;
+
+    if (size == 0) {
+        GL_CALL(glBindBufferBase(GL_UNIFORM_BUFFER, binding, buffer));
+    } else {
+        GL_CALL(glBindBufferRange(
+            GL_UNIFORM_BUFFER, binding, buffer, (GLintptr)offset,
+            (GLsizeiptr)size));
+    }
+}
+
+void
+GLTextureDestroy(GLTexture texture)
+{
+    GLResourceDestroy(GL_RENDER_OBJECT_TEXTURE, texture);
+}
+
+GLVertexArray
+GLVertexArrayMake(void)
+{
+    GLuint vao = 0;
+    GL_CALL(glGenVertexArrays(1, &vao));
+    GLResourceRegister(GL_RENDER_OBJECT_VERTEX_ARRAY, vao, 0);
+    GLBindVertexArray(vao);
+    return (GLVertexArray)vao;
+}
+
+void
+GLVertexArrayDestroy(GLVertexArray va)
+{
+    GLResourceDestroy(GL_RENDER_OBJECT_VERTEX_ARRAY, va);
+}
+
+static void
+OpenGL_VertexArrayAddBufferEx(
+    GLVertexArray va, u32 bufferId, const GLVertexBufferLayout *layout,
+    u32 firstAttributeIndex)
+{
+    GLBindVertexArray(va);
+    GLBindBuffer(GL_ARRAY_BUFFER, bufferId);
+
+    u64 offset = 0;
+
+    for (u32 attributeIndex = 0; attributeIndex < layout->attributesCount;
+         ++attributeIndex) {
+        GLAttribute *attribute = layout->attributes + attributeIndex;
+        u32 location = firstAttributeIndex + attributeIndex;
+
+        GL_CALL(glEnableVertexAttribArray(location));
+
+        if (attribute->mode == GL_ATTRIBUTE_MODE_INTEGER) {
+            GL_CALL(glVertexAttribIPointer(
+                location, attribute->count, attribute->type, layout->stride,
+                (void *)offset));
+        } else {
+            GL_CALL(glVertexAttribPointer(
+                location, attribute->count, attribute->type,
+                attribute->mode == GL_ATTRIBUTE_MODE_NORMALIZED,
+                layout->stride, (void *)offset));
+        }
+
+        if (layout->divisor != 0) {
+            GL_CALL(glVertexAttribDivisor(location, layout->divisor));
+        }
+
+        offset += attribute->size;
+    }
+}
+
+void
+GLVertexArrayAddBuffer(
+    GLVertexArray va, const GLVertexBuffer *vb,
+    const GLVertexBufferLayout *layout)
+{
+    OpenGL_VertexArrayAddBufferEx(va, vb->id, layout, 0);
+}
+
+void
+GLVertexArrayAddInstanceBuffer(
+    GLVertexArray va, const GLInstanceBuffer *ib,
+    const GLVertexBufferLayout *layout, u32 firstAttributeIndex)
+{
+    ASSERT_NONZERO(layout->divisor);
+    OpenGL_VertexArrayAddBufferEx(va, ib->id, layout, firstAttributeIndex);
+}
+
+GLVertexBuffer
+GLVertexBufferMake(const void *dataBuffer, usize dataBufferSize)
+{
+    GLVertexBuffer buffer = {0};
+
+    buffer.id = 0;
+    buffer.data = dataBuffer;
+    buffer.size = dataBufferSize;
+
+    GL_CALL(glGenBuffers(1, &buffer.id));
+    GLResourceRegister(GL_RENDER_OBJECT_BUFFER, buffer.id, dataBufferSize);
+    GLBindBuffer(GL_ARRAY_BUFFER, buffer.id);
+    GL_CALL(glBufferData(
+        GL_ARRAY_BUFFER, dataBufferSize, dataBuffer,
+        GL_DYNAMIC_DRAW /* GL_STATIC_DRAW */));
+    GLRenderStatsRecordBufferUpload(dataBufferSize, true);
+
+    return buffer;
+}
+
+void
+GLVertexBufferSendData(
+    GLVertexBuffer *buffer, const void *dataBuffer, usize dataBufferSize)
+{
+    buffer->data = dataBuffer;
+    buffer->size = dataBufferSize;
+
+    GLBindBuffer(GL_ARRAY_BUFFER, buffer->id);
+    GL_CALL(glBufferData(
+        GL_ARRAY_BUFFER, buffer->size, buffer->data,
+        GL_DYNAMIC_DRAW /* GL_STATIC_DRAW */));
+    GLRenderStatsRecordBufferUpload(buffer->size, true);
+    GLResourceSetSize(GL_RENDER_OBJECT_BUFFER, buffer->id, buffer->size);
+}
+
+void
+GLVertexBufferDestroy(GLVertexBuffer *buffer)
+{
+    GLResourceDestroy(GL_RENDER_OBJECT_BUFFER, buffer->id);
+    *buffer = INIT_EMPTY_STRUCT(GLVertexBuffer);
+}
+
+GLInstanceBuffer
+GLInstanceBufferMake(
+    const void *dataBuffer, usize dataBufferSize, u32 instanceCount)
+{
+    GLInstanceBuffer buffer = {0};
+
+    buffer.data = dataBuffer;
+    buffer.size = dataBufferSize;
+    buffer.count = instanceCount;
+
+    GL_CALL(glGenBuffers(1, &buffer.id));
+    GLResourceRegister(GL_RENDER_OBJECT_BUFFER, buffer.id, dataBufferSize);
+    GLBindBuffer(GL_ARRAY_BUFFER, buffer.id);
+    GL_CALL(glBufferData(
+        GL_ARRAY_BUFFER, dataBufferSize, dataBuffer, GL_DYNAMIC_DRAW));
+    GLRenderStatsRecordBufferUpload(dataBufferSize, true);
+
+    return buffer;
+}
+
+void
+GLInstanceBufferSendData(
+    GLInstanceBuffer *buffer, const void *dataBuffer, usize dataBufferSize,
+    u32 instanceCount)
+{
+    buffer->data = dataBuffer;
+    buffer->size = dataBufferSize;
+    buffer->count = instanceCount;
+
+    GLBindBuffer(GL_ARRAY_BUFFER, buffer->id);
+    GL_CALL(glBufferData(
+        GL_ARRAY_BUFFER, buffer->size, buffer->data, GL_DYNAMIC_DRAW));
+    GLRenderStatsRecordBufferUpload(buffer->size, true);
+    GLResourceSetSize(GL_RENDER_OBJECT_BUFFER, buffer->id, buffer->size);
+}
+
+void
+GLInstanceBufferDestroy(GLInstanceBuffer *buffer)
+{
+    GLResourceDestroy(GL_RENDER_OBJECT_BUFFER, buffer->id);
+    *buffer = INIT_EMPTY_STRUCT(GLInstanceBuffer);
+}
+
+GLIndexBuffer
+GLIndexBufferMake(const void *indexBuffer, usize indexBufferSize)
+{
+    GLuint ebo = 0;
+
+    GL_CALL(glGenBuffers(1, &ebo));
+    GLResourceRegister(GL_RENDER_OBJECT_BUFFER, ebo, indexBufferSize);
+    GLBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+    GL_CALL(glBufferData(
+        GL_ELEMENT_ARRAY_BUFFER, indexBufferSize, indexBuffer,
+        GL_DYNAMIC_DRAW /* GL_STATIC_DRAW */));
+    GLRenderStatsRecordBufferUpload(indexBufferSize, true);
+
+    return (GLIndexBuffer)ebo;
+}
+
+GLElementBuffer
+GLElementBufferMake(const u32 *elements, u64 count)
+{
+    GLElementBuffer eb;
+
+    usize elementsBufferSize = sizeof(elements[0]) * count;
+
+    GL_CALL(glGenBuffers(1, &(eb.id)));
+    GLResourceRegister(GL_RENDER_OBJECT_BUFFER, eb.id, elementsBufferSize);
+    GLBindBuffer(GL_ELEMENT_ARRAY_BUFFER, eb.id);
+    GL_CALL(glBufferData(
+        GL_ELEMENT_ARRAY_BUFFER, elementsBufferSize, (const void *)elements,
+        GL_DYNAMIC_DRAW /* GL_STATIC_DRAW */));
+    GLRenderStatsRecordBufferUpload(elementsBufferSize, true);
+    GLBindBuffer(GL_ELEMENT_ARRAY_BUFFER, eb.id); // @cleanup
+
+    eb.elements = elements;
+    eb.count = count;
+    eb.indexType = GL_UNSIGNED_INT;
+
+    return eb;
+}
+
+GLElementBuffer
+GLElementBufferMakeU16(const u16 *elements, u64 count)
+{
+    GLElementBuffer eb;
+
+    GL_CALL(glGenBuffers(1, &(eb.id)));
+    GLResourceRegister(GL_RENDER_OBJECT_BUFFER, eb.id, sizeof(u16) * count);
+    GLBindBuffer(GL_ELEMENT_ARRAY_BUFFER, eb.id);
+    GL_CALL(glBufferData(
+        GL_ELEMENT_ARRAY_BUFFER, sizeof(u16) * count, (const void *)elements,
+        GL_STATIC_DRAW));
+    GLRenderStatsRecordBufferUpload(sizeof(u16) * count, true);
+
+    eb.elements = elements;
+    eb.count = count;
+    eb.indexType = GL_UNSIGNED_SHORT;
+
+    return eb;
+}
+
+void
+GLElementBufferSendData(GLElementBuffer *buffer, const u32 *indicies, u64 count)
+{
+    ASSERT_EQ(buffer->indexType, GL_UNSIGNED_INT);
+
+    buffer->elements = indicies;
+    buffer->count = count;
+
+    usize elementsBufferSize = sizeof(indicies[0]) * buffer->count;
+
+    GLBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer->id);
+    GL_CALL(glBufferData(
+        GL_ELEMENT_ARRAY_BUFFER, elementsBufferSize,
+        (const void *)buffer->elements, GL_DYNAMIC_DRAW /* GL_STATIC_DRAW */));
+    GLRenderStatsRecordBufferUpload(elementsBufferSize, true);
+    GLResourceSetSize(GL_RENDER_OBJECT_BUFFER, buffer->id, elementsBufferSize);
+}
+
+void
+GLElementBufferDestroy(GLElementBuffer *buffer)
+{
+    GLResourceDestroy(GL_RENDER_OBJECT_BUFFER, buffer->id);
+    *buffer = INIT_EMPTY_STRUCT(GLElementBuffer);
+}
+
+GLElementBuffer
+GLElementBufferMakeQuads(Scratch *scratch, u32 quadCount)
+{
+    static const u32 quadIndicies[] = {0, 1, 2, 0, 2, 3};
+    static const u32 quadVertexCount = 4;
+
+    u64 indiciesCount = (u64)quadCount * STATIC_ARRAY_LENGTH(quadIndicies);
+    u32 *indicies = ScratchAlloc(scratch, sizeof(u32) * indiciesCount);
+    ASSERT_NONNULL(indicies);
+
+    for (u32 quadIndex = 0; quadIndex < quadCount; ++quadIndex) {
+        u32 *quad = indicies + quadIndex * STATIC_ARRAY_LENGTH(quadIndicies);
+
+        for (u32 i = 0; i < STATIC_ARRAY_LENGTH(quadIndicies); ++i) {
+            quad[i] = quadIndex * quadVertexCount + quadIndicies[i];
+        }
+    }
+
+    return GLElementBufferMake(indicies, indiciesCount);
+}
+
+GLElementBuffer
+GLElementBufferMakeQuadsU16(Scratch *scratch, u32 quadCount)
+{
+    static const u16 quadIndicies[] = {0, 1, 2, 0, 2, 3};
+    static const u32 quadVertexCount = 4;
+
+    ASSERT_ISTRUE(
+        (u64)quadCount * quadVertexCount <= GL_ELEMENT_U16_MAX_VERTEX_COUNT);
+
+    u64 indiciesCount = (u64)quadCount * STATIC_ARRAY_LENGTH(quadIndicies);
+    u16 *indicies = ScratchAlloc(scratch, sizeof(u16) * indiciesCount);
+    ASSERT_NONNULL(indicies);
+
+    for (u32 quadIndex = 0; quadIndex < quadCount; ++quadIndex) {
+        u16 *quad = indicies + quadIndex * STATIC_ARRAY_LENGTH(quadIndicies);
+
+        for (u32 i = 0; i < STATIC_ARRAY_LENGTH(quadIndicies); ++i) {
+            quad[i] = (u16)(quadIndex * quadVertexCount + quadIndicies[i]);
+        }
+    }
+
+    return GLElementBufferMakeU16(indicies, indiciesCount);
+}
+
+usize
+GLIndexTypeGetSize(u32 indexType)
+{
+    switch (indexType) {
+    case GL_UNSIGNED_SHORT:
+        return sizeof(u16);
+    case GL_UNSIGNED_BYTE:
+        return sizeof(u8);
+    default:
+        return sizeof(u32);
+    }
+}
+
+GLUniformBuffer
+GLUniformBufferMake(const void *data, usize size)
+{
+    GLUniformBuffer buffer = {0};
+
+    buffer.size = size;
+
+    GL_CALL(glGenBuffers(1, &buffer.id));
+    GLResourceRegister(GL_RENDER_OBJECT_BUFFER, buffer.id, size);
+    GLBindBuffer(GL_UNIFORM_BUFFER, buffer.id);
+    GL_CALL(glBufferData(GL_UNIFORM_BUFFER, size, data, GL_DYNAMIC_DRAW));
+    GLRenderStatsRecordBufferUpload(data != NULL ? size : 0, true);
+
+    return buffer;
+}
+
+void
+GLUniformBufferSendData(GLUniformBuffer *buffer, const void *data, usize size)
+{
+    GLBindBuffer(GL_UNIFORM_BUFFER, buffer->id);
+
+    if (size > buffer->size) {
+        buffer->size = size;
+        GL_CALL(glBufferData(GL_UNIFORM_BUFFER, size, data, GL_DYNAMIC_DRAW));
+        GLRenderStatsRecordBufferUpload(size, true);
+        GLResourceSetSize(GL_RENDER_OBJECT_BUFFER, buffer->id, size);
+    } else {
+        GL_CALL(glBufferSubData(GL_UNIFORM_BUFFER, 0, size, data));
+        GLRenderStatsRecordBufferUpload(size, false);
+    }
+}
+
+void
+GLUniformBufferDestroy(GLUniformBuffer *buffer)
+{
+    GLResourceDestroy(GL_RENDER_OBJECT_BUFFER, buffer->id);
+    *buffer = INIT_EMPTY_STRUCT(GLUniformBuffer);
+}
+
+void
+GLUniformBufferBind(const GLUniformBuffer *buffer, u32 binding)
+{
+    GLBindUniformBufferRange(binding, buffer->id, 0, 0);
+}
+
+GLUniformRing
+GLUniformRingMake(usize capacity)
+{
+    GLUniformRing ring = {0};
+
+    GLint alignment = 0;
+    GL_CALL(glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment));
+
+    ring.alignment = alignment > 0 ? (usize)alignment : 256;
+    ring.offset = 0;
+    ring.wrapCount = 0;
+    ring.buffer = GLUniformBufferMake(NULL, capacity);
+
+    return ring;
+}
+
+void
+GLUniformRingDestroy(GLUniformRing *ring)
+{
+    GLUniformBufferDestroy(&ring->buffer);
+    *ring = INIT_EMPTY_STRUCT(GLUniformRing);
+}
+
+void
+GLUniformRingPush(
+    GLUniformRing *ring, u32 binding, const void *data, usize size)
+{
+    ASSERT_ISTRUE(size <= ring->buffer.size);
+
+    usize offset =
+        (ring->offset + ring->alignment - 1) / ring->alignment * ring->alignment;
+
+    GLBindBuffer(GL_UNIFORM_BUFFER, ring->buffer.id);
+
+    if (offset + size > ring->buffer.size) {
+        // NOTE(gr3yknigh1): Orphan storage instead of waiting for GPU to
+        // finish with previous draws. [2025/11/16]
+        GL_CALL(glBufferData(
+            GL_UNIFORM_BUFFER, ring->buffer.size, NULL, GL_DYNAMIC_DRAW));
+        GLRenderStatsRecordBufferUpload(0, true);
+        offset = 0;
+        ++ring->wrapCount;
+    }
+
+    GL_CALL(glBufferSubData(GL_UNIFORM_BUFFER, (GLintptr)offset, size, data));
+    GLRenderStatsRecordBufferUpload(size, false);
+    GLBindUniformBufferRange(binding, ring->buffer.id, offset, size);
+
+    ring->offset = offset + size;
+}
+
+GLVertexBufferLayout
+GLVertexBufferLayoutMake(Scratch *scratch)
+{
+    return GLVertexBufferLayoutMakeEx(scratch, 0);
+}
+
+GLVertexBufferLayout
+GLVertexBufferLayoutMakeEx(Scratch *scratch, u32 divisor)
+{
+    GLVertexBufferLayout layout = {0};
+
+    layout.scratch = scratch;
+    layout.attributes = ScratchAllocZero(
+        scratch,
+        KILOBYTES(1)); // TODO(gr3yknigh1): replace with generic allocator
+    layout.attributesCount = 0;
+    layout.stride = 0;
+    layout.divisor = divisor;
+
+    return layout;
+}
+
+static void
+OpenGL_VertexBufferLayoutPushAttribute(
+    GLVertexBufferLayout *layout, u32 type, u32 count, usize size,
+    GLAttributeMode mode)
+{
+    GLAttribute *attribute = layout->attributes + layout->attributesCount;
+    attribute->mode = mode;
+    attribute->type = type;
+    attribute->count = count;
+    attribute->size = size;
+
+    layout->attributesCount += 1;
+    layout->stride += size;
+}
+
+void
+GLVertexBufferLayoutPushAttributeF32(GLVertexBufferLayout *layout, u32 count)
+{
+    OpenGL_VertexBufferLayoutPushAttribute(
+        layout, GL_FLOAT, count, sizeof(f32) * count, GL_ATTRIBUTE_MODE_FLOAT);
+}
+
+void
+GLVertexBufferLayoutPushAttributeU8(
+    GLVertexBufferLayout *layout, u32 count, GLAttributeMode mode)
+{
+    OpenGL_VertexBufferLayoutPushAttribute(
+        layout, GL_UNSIGNED_BYTE, count, sizeof(u8) * count, mode);
+}
+
+void
+GLVertexBufferLayoutPushAttributeU16(
+    GLVertexBufferLayout *layout, u32 count, GLAttributeMode mode)
+{
+    OpenGL_VertexBufferLayoutPushAttribute(
+        layout, GL_UNSIGNED_SHORT, count, sizeof(u16) * count, mode);
+}
+
+void
+GLVertexBufferLayoutPushAttributeI32(
+    GLVertexBufferLayout *layout, u32 count, GLAttributeMode mode)
+{
+    OpenGL_VertexBufferLayoutPushAttribute(
+        layout, GL_INT, count, sizeof(i32) * count, mode);
+}
+
+void
+GLVertexBufferLayoutPushAttributePacked1010102(
+    GLVertexBufferLayout *layout, bool isSigned, GLAttributeMode mode)
+{
+    ASSERT_NOTEQ(mode, GL_ATTRIBUTE_MODE_INTEGER);
+
+    OpenGL_VertexBufferLayoutPushAttribute(
+        layout,
+        isSigned ? GL_INT_2_10_10_10_REV : GL_UNSIGNED_INT_2_10_10_10_REV, 4,
+        sizeof(u32), mode);
+}
+
+void
+GLClear(f32 r, f32 g, f32 b, f32 a)
+{
+    GL_CALL(glClearColor(r, g, b, a));
+    GL_CALL(glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT));
+}
+
+void
+GLClearEx(f32 r, f32 g, f32 b, f32 a, i32 clearMask)
+{
+    GL_CALL(glClearColor(r, g, b, a));
+    GL_CALL(glClear(clearMask));
+}
+
+void
+GLDrawElements(
+    const GLElementBuffer *eb, const GLVertexBuffer *vb, GLVertexArray va)
+{
+    UNUSED(vb);
+
+    GLBindVertexArray(va);
+    GLBindBuffer(GL_ELEMENT_ARRAY_BUFFER, eb->id);
+    GL_CALL(glDrawElements(GL_TRIANGLES, eb->count, eb->indexType, 0));
+    GLRenderStatsRecordDraw(GL_TRIANGLES, eb->count, 0);
+}
+
+void
+GLDrawElementsEx(
+    const GLElementBuffer *eb, GLVertexArray va, u32 firstElement,
+    u32 elementCount)
+{
+    ASSERT_ISTRUE(firstElement + elementCount <= eb->count);
+
+    GLBindVertexArray(va);
+    GLBindBuffer(GL_ELEMENT_ARRAY_BUFFER, eb->id);
+    GL_CALL(glDrawElements(
+        GL_TRIANGLES, elementCount, eb->indexType,
+        (const void *)(GLIndexTypeGetSize(eb->indexType) *
+                       (usize)firstElement)));
+    GLRenderStatsRecordDraw(GL_TRIANGLES, elementCount, 0);
+}
+
+void
+GLDrawTriangles(
+    const GLVertexBuffer *vb, const GLVertexBufferLayout *layout,
+    GLVertexArray va)
+{
+    GLBindVertexArray(va);
+    GL_CALL(glDrawArrays(GL_TRIANGLES, 0, vb->size / layout->stride));
+    GLRenderStatsRecordDraw(GL_TRIANGLES, vb->size / layout->stride, 0);
+}
+
+void
+GLDrawMesh(const Mesh *mesh)
+{
+    GLDrawElements(
+        &mesh->elementBuffer, &mesh->vertexBuffer, mesh->vertexArray);
+}
+
+void
+GLDrawElementsInstanced(
+    const GLElementBuffer *eb, const GLVertexBuffer *vb, GLVertexArray va,
+    u32 instanceCount)
+{
+    UNUSED(vb);
+
+    GLBindVertexArray(va);
+    GLBindBuffer(GL_ELEMENT_ARRAY_BUFFER, eb->id);
+    GL_CALL(glDrawElementsInstanced(
+        GL_TRIANGLES, eb->count, eb->indexType, 0, instanceCount));
+    GLRenderStatsRecordDraw(GL_TRIANGLES, eb->count, instanceCount);
+}
+
+void
+GLMeshAttachInstanceBuffer(
+    Mesh *mesh, const GLInstanceBuffer *ib, const GLVertexBufferLayout *layout)
+{
+    GLVertexArrayAddInstanceBuffer(
+        mesh->vertexArray, ib, layout, mesh->vertexLayout.attributesCount);
+}
+
+void
+GLDrawMeshInstanced(const Mesh *mesh, const GLInstanceBuffer *ib)
+{
+    GLDrawElementsInstanced(
+        &mesh->elementBuffer, &mesh->vertexBuffer, mesh->vertexArray,
+        ib->count);
+}
+
+GLShaderID
+GLCompileShaderFromFile(
+    Scratch *scratch, cstring8 sourceFilePath, GLShaderType shaderType)
+{
+    ASSERT_ISTRUE(IsPathExists(sourceFilePath));
+    ASSERT_NOTEQ(shaderType, GL_SHADER_TYPE_NONE);
+
+    FileOpenResult sourceFileOpenResult =
+        FileOpenEx(sourceFilePath, scratch, PERMISSION_READ);
+    ASSERT_ISOK(sourceFileOpenResult.code);
+
+    FileHandle *sourceHandle = sourceFileOpenResult.handle;
+    ASSERT_ISTRUE(FileHandleIsValid(sourceHandle));
+
+    usize sourceFileSize = FileGetSize(sourceHandle);
+    ASSERT_NONZERO(sourceFileSize);
+
+    usize sourceBufferSize = sourceFileSize + 1;
+
+    Scratch tempScratch = TempScratchMake(scratch, sourceBufferSize);
+
+    void *sourceBuffer = ScratchAllocZero(&tempScratch, sourceBufferSize);
+    ASSERT_NONNULL(sourceBuffer);
+
+    FileLoadResultCode sourceLoadResult =
+        FileLoadToBuffer(sourceHandle, sourceBuffer, sourceFileSize, NULL);
+    ASSERT_ISOK(sourceLoadResult);
+
+    ASSERT_ISOK(FileClose(sourceHandle));
+
+    // NOTE(gr3yknigh1): GLCompilerShader cares about null-termination.
+    // Note that `sourceBuffer` should be c-string. [2024/11/06]
+    ((char8 *)sourceBuffer)[sourceBufferSize - 1] = 0;
+
+    GLShaderID shaderID = GLCompileShader(scratch, sourceBuffer, shaderType);
+
+    TempScratchClean(&tempScratch, scratch);
+
+    return shaderID;
+}
+
+static GLenum
+OpenGL_ConvertShaderTypeToGLEnum(GLShaderType type)
+{
+    if (type == GL_SHADER_TYPE_VERT) {
+        return GL_VERTEX_SHADER;
+    }
+
+    if (type == GL_SHADER_TYPE_FRAG) {
+        return GL_FRAGMENT_SHADER;
+    }
+
+    return 0;
+}
+
+GLShaderID
+GLCompileShader(
+    Scratch *scratch, cstring8 shaderSource, GLShaderType shaderType)
+{
+    ASSERT_NONNULL(shaderSource);
+    ASSERT_ISFALSE(CString8IsEmpty(shaderSource));
+    ASSERT_NOTEQ(shaderType, GL_SHADER_TYPE_NONE);
+
+    GLShaderID shaderId = 0;
+
+    GLenum glShaderType = OpenGL_ConvertShaderTypeToGLEnum(shaderType);
+
+    GL_CALL_O(glCreateShader(glShaderType), &shaderId);
+    GL_CALL(glShaderSource(shaderId, 1, &shaderSource, NULL));
+    GL_CALL(glCompileShader(shaderId));
+
+    GLint compilationStatus = GL_TRUE;
+    GL_CALL(glGetShaderiv(shaderId, GL_COMPILE_STATUS, &compilationStatus));
+
+    if (compilationStatus == GL_FALSE) {
+        GLint compilationLogLength = 0;
+        GL_CALL(
+            glGetShaderiv(shaderId, GL_INFO_LOG_LENGTH, &compilationLogLength));
+
+        if (compilationLogLength > 0) {
+
+            char8 *compilationInfoLog =
+                ScratchAlloc(scratch, compilationLogLength); // @cleanup XXX
+            GL_CALL(glGetShaderInfoLog(
+                shaderId, GL_INFO_LOG_LENGTH, NULL, compilationInfoLog));
+            PutString(compilationInfoLog);
+        }
+
+        GL_CALL(glDeleteShader(shaderId));
+        ThrowDebugBreak(); // @cleanup Hack
+        return 0;
+    }
+
+    GLResourceRegister(GL_RENDER_OBJECT_SHADER, shaderId, 0);
+    return shaderId;
+}
+
+void
+GLShaderDestroy(GLShaderID shader)
+{
+    GLResourceDestroy(GL_RENDER_OBJECT_SHADER, shader);
+}
+
+#define OPENGL_UNIFORM_NAME_CAPACITY EXPAND(1024)
+#define OPENGL_UNIFORM_NAME_STORAGE_SIZE KILOBYTES(32)
+#define OPENGL_UNIFORM_NAME_MAX_LENGTH EXPAND(256)
+#define OPENGL_REFLECTED_PROGRAM_CAPACITY EXPAND(256)
+
+typedef struct {
+    u32 hash;
+    u32 storageOffset;
+    GLUniformName name;
+} OpenGL_InternedName;
+
+/*
+ * @breaf Intern table of uniform names. Open addressing, linear probing.
+ */
+static struct {
+    OpenGL_InternedName slots[OPENGL_UNIFORM_NAME_CAPACITY];
+    u32 count;
+
+    char8 storage[OPENGL_UNIFORM_NAME_STORAGE_SIZE];
+    usize storageOccupied;
+} gUniformNames;
+
+typedef struct {
+    GLUniformName name;
+    GLUniformLocation location;
+} OpenGL_UniformSlot;
+
+typedef struct {
+    GLShaderProgramID program;
+
+    OpenGL_UniformSlot *uniforms; // Open addressing, linear probing.
+    u32 uniformsCapacity;         // Power of two.
+} OpenGL_ProgramReflection;
+
+static OpenGL_ProgramReflection
+    gProgramReflections[OPENGL_REFLECTED_PROGRAM_CAPACITY];
+
+static u32
+OpenGL_HashString(cstring8 s)
+{
+    // FNV-1a
+    u32 hash = 2166136261u;
+
+    for (const char8 *cursor = s; *cursor; ++cursor) {
+        hash ^= (u8)*cursor;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+static u32
+OpenGL_HashU32(u32 x)
+{
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+GLUniformName
+GLUniformNameIntern(cstring8 name)
+{
+    u32 hash = OpenGL_HashString(name);
+    u32 mask = OPENGL_UNIFORM_NAME_CAPACITY - 1;
+
+    for (u32 slotIndex = hash & mask;; slotIndex = (slotIndex + 1) & mask) {
+        OpenGL_InternedName *slot = gUniformNames.slots + slotIndex;
+
+        if (slot->name == 0) {
+            usize length = CString8GetLength(name);
+
+            ASSERT_ISTRUE(
+                gUniformNames.count + 1 < OPENGL_UNIFORM_NAME_CAPACITY / 2);
+            ASSERT_ISTRUE(
+                gUniformNames.storageOccupied + length + 1 <=
+                OPENGL_UNIFORM_NAME_STORAGE_SIZE);
+
+            slot->hash = hash;
+            slot->storageOffset = (u32)gUniformNames.storageOccupied;
+            slot->name = ++gUniformNames.count;
+
+            MemoryCopy(
+                gUniformNames.storage + gUniformNames.storageOccupied, name,
+                length + 1);
+            gUniformNames.storageOccupied += length + 1;
+
+            return slot->name;
+        }
+
+        if (slot->hash == hash &&
+            CString8IsEqual(
+                gUniformNames.storage + slot->storageOffset, name)) {
+            return slot->name;
+        }
+    }
+}
+
+static OpenGL_ProgramReflection *
+OpenGL_FindProgramReflection(GLShaderProgramID program, bool shouldInsert)
+{
+    u32 mask = OPENGL_REFLECTED_PROGRAM_CAPACITY - 1;
+
+    for (u32 probeIndex = 0, slotIndex = OpenGL_HashU32(program) & mask;
+         probeIndex < OPENGL_REFLECTED_PROGRAM_CAPACITY;
+         ++probeIndex, slotIndex = (slotIndex + 1) & mask) {
+        OpenGL_ProgramReflection *reflection =
+            gProgramReflections + slotIndex;
+
+        if (reflection->program == program) {
+            return reflection;
+        }
+
+        if (reflection->program == 0) {
+            if (shouldInsert) {
+                reflection->program = program;
+                return reflection;
+            }
+            return NULL;
+        }
+    }
+
+    return NULL;
+}
+
+static void
+OpenGL_ReflectionInsertUniform(
+    OpenGL_ProgramReflection *reflection, GLUniformName name,
+    GLUniformLocation location)
+{
+    u32 mask = reflection->uniformsCapacity - 1;
+
+    for (u32 slotIndex = OpenGL_HashU32(name) & mask;;
+         slotIndex = (slotIndex + 1) & mask) {
+        OpenGL_UniformSlot *slot = reflection->uniforms + slotIndex;
+
+        if (slot->name == 0 || slot->name == name) {
+            slot->name = name;
+            slot->location = location;
+            return;
+        }
+    }
+}
+
+static void
+OpenGL_BindWellKnownUniformBlocks(GLShaderProgramID program)
+{
+    static const struct {
+        cstring8 name;
+        u32 binding;
+    } wellKnownBlocks[] = {
+        {"Camera", GL_UNIFORM_BLOCK_BINDING_CAMERA},
+        {"Draw", GL_UNIFORM_BLOCK_BINDING_DRAW},
+    };
+
+    for (u32 blockIndex = 0; blockIndex < STATIC_ARRAY_LENGTH(wellKnownBlocks);
+         ++blockIndex) {
+        GLuint index = GL_INVALID_INDEX;
+        GL_CALL_O(
+            glGetUniformBlockIndex(program, wellKnownBlocks[blockIndex].name),
+            &index);
+
+        if (index != GL_INVALID_INDEX) {
+            GL_CALL(glUniformBlockBinding(
+                program, index, wellKnownBlocks[blockIndex].binding));
+        }
+    }
+}
+
+/*
+ * @breaf Stores locations of all active uniforms of the program.
+ */
+static void
+OpenGL_ReflectProgram(Scratch *scratch, GLShaderProgramID program)
+{
+    OpenGL_ProgramReflection *reflection =
+        OpenGL_FindProgramReflection(program, true);
+    ASSERT_NONNULL(reflection);
+
+    GLint activeUniformCount = 0;
+    GL_CALL(glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &activeUniformCount));
+
+    // NOTE(gr3yknigh1): Arrays are stored twice ("u_A" and "u_A[0]") and
+    // table is kept at most half full. [2025/11/16]
+    u32 capacity = 8;
+    while (capacity < (u32)activeUniformCount * 4) {
+        capacity *= 2;
+    }
+
+    reflection->uniformsCapacity = capacity;
+    reflection->uniforms =
+        ScratchAllocZero(scratch, sizeof(OpenGL_UniformSlot) * capacity);
+    ASSERT_NONNULL(reflection->uniforms);
+
+    for (GLint uniformIndex = 0; uniformIndex < activeUniformCount;
+         ++uniformIndex) {
+        char8 name[OPENGL_UNIFORM_NAME_MAX_LENGTH];
+        GLsizei nameLength = 0;
+        GLint size = 0;
+        GLenum type = 0;
+
+        GL_CALL(glGetActiveUniform(
+            program, (GLuint)uniformIndex, sizeof(name), &nameLength, &size,
+            &type, name));
+
+        GLint location = -1;
+        GL_CALL_O(glGetUniformLocation(program, name), &location);
+
+        if (location < 0) {
+            continue; // Member of uniform block.
+        }
+
+        OpenGL_ReflectionInsertUniform(
+            reflection, GLUniformNameIntern(name), (GLUniformLocation)location);
+
+        if (nameLength > 3 && CString8IsEqual(name + nameLength - 3, "[0]")) {
+            name[nameLength - 3] = 0;
+            OpenGL_ReflectionInsertUniform(
+                reflection, GLUniformNameIntern(name),
+                (GLUniformLocation)location);
+        }
+    }
+
+    OpenGL_BindWellKnownUniformBlocks(program);
+}
+
+GLUniformLocation
+GLShaderGetUniformLocation(GLShaderProgramID shader, GLUniformName name)
+{
+    OpenGL_ProgramReflection *reflection =
+        OpenGL_FindProgramReflection(shader, false);
+
+    if (reflection == NULL || name == 0) {
+        return GL_UNIFORM_LOCATION_NONE;
+    }
+
+    u32 mask = reflection->uniformsCapacity - 1;
+
+    for (u32 slotIndex = OpenGL_HashU32(name) & mask;;
+         slotIndex = (slotIndex + 1) & mask) {
+        OpenGL_UniformSlot *slot = reflection->uniforms + slotIndex;
+
+        if (slot->name == name) {
+            return slot->location;
+        }
+
+        if (slot->name == 0) {
+            return GL_UNIFORM_LOCATION_NONE;
+        }
+    }
+}
+
+static GLShaderProgramID
+OpenGL_LinkShaderProgram(
+    Scratch *scratch, const GLShaderProgramLinkData *data,
+    bool isBinaryRetrievable)
+{
+    ASSERT_NONNULL(data);
+    ASSERT_NONZERO(data->vertexShader);
+    ASSERT_NONZERO(data->fragmentShader);
+
+    GLShaderProgramID programID = 0;
+    GL_CALL_O(glCreateProgram(), &programID);
+
+    if (isBinaryRetrievable) {
+        GL_CALL(glProgramParameteri(
+            programID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+    }
+
+    GL_CALL(glAttachShader(programID, data->vertexShader));
+    GL_CALL(glAttachShader(programID, data->fragmentShader));
+    GL_CALL(glLinkProgram(programID));
+
+    GL_CALL(glValidateProgram(programID));
+
+    GLint linkStatus = GL_TRUE;
+    GL_CALL(glGetProgramiv(programID, GL_LINK_STATUS, &linkStatus));
+
+    if (linkStatus == GL_FALSE) {
+        GLint linkLogLength;
+        GL_CALL(glGetProgramiv(programID, GL_INFO_LOG_LENGTH, &linkLogLength));
+
+        if (linkLogLength > 0) {
+            char8 *linkInfoLog =
+                ScratchAlloc(scratch, linkLogLength); // @cleanup XXX
+            GL_CALL(glGetProgramInfoLog(
+                programID, GL_INFO_LOG_LENGTH, NULL, linkInfoLog));
+
+            PutString(linkInfoLog);
+        }
+
+        GL_CALL(glDeleteProgram(programID));
+        ThrowDebugBreak(); // @cleanup Hack
+        return 0;
+    }
+
+    // NOTE(gr3yknigh1): Linked program doesn't need shaders. Attached shader
+    // isn't freed by `glDeleteShader`, so they are detached right away and
+    // caller may destroy them. [2025/11/23]
+    GL_CALL(glDetachShader(programID, data->vertexShader));
+    GL_CALL(glDetachShader(programID, data->fragmentShader));
+
+    OpenGL_ReflectProgram(scratch, programID);
+    GLResourceRegister(GL_RENDER_OBJECT_PROGRAM, programID, 0);
+
+    return programID;
+}
+
+GLShaderProgramID
+GLLinkShaderProgram(Scratch *scratch, const GLShaderProgramLinkData *data)
+{
+    return OpenGL_LinkShaderProgram(scratch, data, false);
+}
+
+void
+GLShaderProgramDestroy(GLShaderProgramID program)
+{
+    GLResourceDestroy(GL_RENDER_OBJECT_PROGRAM, program);
+}
+
+#define OPENGL_PROGRAM_CACHE_MAGIC EXPAND(0x50534647u) // "GFSP"
+#define OPENGL_PROGRAM_CACHE_VERSION EXPAND(1)
+#define OPENGL_PATH_CAPACITY EXPAND(512)
+#define OPENGL_HASH64_SEED EXPAND(14695981039346656037ull)
+
+/*
+ * @breaf Header of program cache file, binary follows it.
+ */
+typedef struct {
+    u32 magic;
+    u32 version;
+    u64 key;
+    u32 binaryFormat;
+    u32 binarySize;
+    f32 compileMilliseconds;
+    u32 reserved;
+} OpenGL_ProgramCacheHeader;
+
+static u64
+OpenGL_HashBytes64(u64 hash, const void *data, usize size)
+{
+    // FNV-1a
+    const u8 *bytes = data;
+
+    for (usize index = 0; index < size; ++index) {
+        hash ^= bytes[index];
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+static u64
+OpenGL_HashCString64(u64 hash, cstring8 s)
+{
+    // NOTE(gr3yknigh1): Terminator is hashed too, so "ab" + "c" and "a" +
+    // "bc" give different hashes. [2025/11/23]
+    return OpenGL_HashBytes64(hash, s, CString8GetLength(s) + 1);
+}
+
+static f32
+OpenGL_TicksToMilliseconds(u64 ticks)
+{
+    return (f32)((f64)ticks * 1000.0 / (f64)GetPerformanceFrequency());
+}
+
+/*
+ * @breaf Reads whole file as c-string.
+ *
+ * @return `NULL` if file can't be read or scratch can't hold it.
+ */
+static char8 *
+OpenGL_LoadTextFile(Scratch *scratch, cstring8 filePath)
+{
+    FileOpenResult openResult = FileOpenEx(filePath, scratch, PERMISSION_READ);
+    if (openResult.code != FILE_OPEN_OK) {
+        return NULL;
+    }
+
+    usize fileSize = FileGetSize(openResult.handle);
+    char8 *text = ScratchAlloc(scratch, fileSize + 1);
+
+    if (text != NULL && fileSize > 0 &&
+        FileLoadToBuffer(openResult.handle, text, fileSize, NULL) !=
+            FILE_LOAD_OK) {
+        text = NULL;
+    }
+
+    if (text != NULL) {
+        text[fileSize] = 0;
+    }
+
+    FileClose(openResult.handle);
+    return text;
+}
+
+typedef struct {
+    char8 *data;
+    usize length;
+    usize capacity;
+    u32 fileCount; // Next source string number for `#line`.
+} OpenGL_ShaderSourceBuilder;
+
+static void
+OpenGL_ShaderSourceAppend(
+    OpenGL_ShaderSourceBuilder *builder, const char8 *text, usize length)
+{
+    ASSERT_ISTRUE(builder->length + length < builder->capacity);
+
+    MemoryCopy(builder->data + builder->length, text, length);
+    builder->length += length;
+    builder->data[builder->length] = 0;
+}
+
+static void
+OpenGL_ShaderSourceAppendCString(
+    OpenGL_ShaderSourceBuilder *builder, cstring8 text)
+{
+    OpenGL_ShaderSourceAppend(builder, text, CString8GetLength(text));
+}
+
+static void
+OpenGL_ShaderSourceAppendLineDirective(
+    OpenGL_ShaderSourceBuilder *builder, u32 line, u32 sourceString)
+{
+    char8 directive[64];
+    i32 length = snprintf(
+        directive, sizeof(directive), "#line %u %u\n", line, sourceString);
+    OpenGL_ShaderSourceAppend(builder, directive, (usize)length);
+}
+
+/*
+ * @breaf Skips spaces and tabs, then checks if line starts with `prefix`.
+ *
+ * @return Pointer past `prefix` or `NULL`.
+ */
+static const char8 *
+OpenGL_MatchDirective(const char8 *line, const char8 *lineEnd, cstring8 prefix)
+{
+    while (line < lineEnd && (*line == ' ' || *line == '\t')) {
+        ++line;
+    }
+
+    for (; *prefix; ++prefix, ++line) {
+        if (line >= lineEnd || *line != *prefix) {
+            return NULL;
+        }
+    }
+
+    return line;
+}
+
+static const char8 *
+OpenGL_FindLineEnd(const char8 *line)
+{
+    while (*line && *line != '\n') {
+        ++line;
+    }
+    return line;
+}
+
+static bool
+OpenGL_ShaderSourceHasDirective(cstring8 source, cstring8 directive)
+{
+    for (const char8 *line = source; *line;) {
+        const char8 *lineEnd = OpenGL_FindLineEnd(line);
+
+        if (OpenGL_MatchDirective(line, lineEnd, directive) != NULL) {
+            return true;
+        }
+
+        line = *lineEnd ? lineEnd + 1 : lineEnd;
+    }
+
+    return false;
+}
+
+static void
+OpenGL_ShaderSourceAppendDefines(
+    OpenGL_ShaderSourceBuilder *builder, const GLShaderDefine *defines,
+    u32 defineCount)
+{
+    for (u32 defineIndex = 0; defineIndex < defineCount; ++defineIndex) {
+        const GLShaderDefine *define = defines + defineIndex;
+
+        OpenGL_ShaderSourceAppendCString(builder, "#define ");
+        OpenGL_ShaderSourceAppendCString(builder, define->name);
+        if (define->value != NULL) {
+            OpenGL_ShaderSourceAppendCString(builder, " ");
+            OpenGL_ShaderSourceAppendCString(builder, define->value);
+        }
+        OpenGL_ShaderSourceAppendCString(builder, "\n");
+    }
+}
+
+static bool
+OpenGL_PreprocessShaderFile(
+    Scratch *scratch, OpenGL_ShaderSourceBuilder *builder, cstring8 filePath,
+    const GLShaderDefine *defines, u32 defineCount, u32 depth)
+{
+    ASSERT_ISTRUE(depth <= GL_SHADER_MAX_INCLUDE_DEPTH);
+
+    char8 *source = OpenGL_LoadTextFile(scratch, filePath);
+    if (source == NULL) {
+        return false;
+    }
+
+    u32 sourceString = builder->fileCount++;
+    bool isRoot = depth == 0;
+
+    // NOTE(gr3yknigh1): `#version` must precede everything else, so defines
+    // are injected right after it. [2025/11/23]
+    bool isDefinesInjected = false;
+    if (isRoot && !OpenGL_ShaderSourceHasDirective(source, "#version")) {
+        OpenGL_ShaderSourceAppendDefines(builder, defines, defineCount);
+        isDefinesInjected = true;
+    }
+
+    if (!isRoot) {
+        OpenGL_ShaderSourceAppendLineDirective(builder, 1, sourceString);
+    }
+
+    u32 lineNumber = 1;
+
+    for (const char8 *line = source; *line; ++lineNumber) {
+        const char8 *lineEnd = OpenGL_FindLineEnd(line);
+        const char8 *next = *lineEnd ? lineEnd + 1 : lineEnd;
+        const char8 *arguments = NULL;
+
+        if ((arguments = OpenGL_MatchDirective(line, lineEnd, "#include")) !=
+            NULL) {
+            const char8 *nameBegin = arguments;
+            while (nameBegin < lineEnd && *nameBegin != '"') {
+                ++nameBegin;
+            }
+            const char8 *nameEnd = nameBegin + 1;
+            while (nameEnd < lineEnd && *nameEnd != '"') {
+                ++nameEnd;
+            }
+            ASSERT_ISTRUE(nameEnd < lineEnd);
+
+            // NOTE(gr3yknigh1): Included path is relative to directory of
+            // including file. [2025/11/23]
+            usize directoryLength = CString8GetLength(filePath);
+            while (directoryLength > 0 &&
+                   filePath[directoryLength - 1] != '/' &&
+                   filePath[directoryLength - 1] != '\\') {
+                --directoryLength;
+            }
+
+            usize nameLength = (usize)(nameEnd - nameBegin - 1);
+            char8 includePath[OPENGL_PATH_CAPACITY];
+            ASSERT_ISTRUE(directoryLength + nameLength < sizeof(includePath));
+
+            MemoryCopy(includePath, filePath, directoryLength);
+            MemoryCopy(
+                includePath + directoryLength, nameBegin + 1, nameLength);
+            includePath[directoryLength + nameLength] = 0;
+
+            if (!OpenGL_PreprocessShaderFile(
+                    scratch, builder, includePath, NULL, 0, depth + 1)) {
+                return false;
+            }
+
+            OpenGL_ShaderSourceAppendLineDirective(
+                builder, lineNumber + 1, sourceString);
+        } else {
+            OpenGL_ShaderSourceAppend(builder, line, (usize)(next - line));
+
+            if (*lineEnd == 0) {
+                OpenGL_ShaderSourceAppendCString(builder, "\n");
+            }
+
+            if (!isDefinesInjected &&
+                OpenGL_MatchDirective(line, lineEnd, "#version") != NULL) {
+                OpenGL_ShaderSourceAppendDefines(builder, defines, defineCount);
+                OpenGL_ShaderSourceAppendLineDirective(
+                    builder, lineNumber + 1, sourceString);
+                isDefinesInjected = true;
+            }
+        }
+
+        line = next;
+    }
+
+    return true;
+}
+
+char8 *
+GLPreprocessShaderFile(
+    Scratch *scratch, cstring8 filePath, const GLShaderDefine *defines,
+    u32 defineCount)
+{
+    ASSERT_NONNULL(filePath);
+
+    OpenGL_ShaderSourceBuilder builder =
+        INIT_EMPTY_STRUCT(OpenGL_ShaderSourceBuilder);
+    builder.capacity = GL_SHADER_SOURCE_CAPACITY;
+    builder.data = ScratchAlloc(scratch, builder.capacity);
+    if (builder.data == NULL) {
+        return NULL;
+    }
+    builder.data[0] = 0;
+
+    if (!OpenGL_PreprocessShaderFile(
+            scratch, &builder, filePath, defines, defineCount, 0)) {
+        return NULL;
+    }
+
+    return builder.data;
+}
+
+static void
+OpenGL_ProgramCacheMakePath(
+    const GLProgramCache *cache, u64 key, char8 *path, usize pathCapacity)
+{
+    snprintf(
+        path, pathCapacity, "%s/%016llx.glprogram", cache->directory,
+        (unsigned long long)key);
+}
+
+/*
+ * @breaf Tries to create program from cached binary.
+ *
+ * @return Zero on miss: no file, file of other key or driver rejected binary.
+ */
+static GLShaderProgramID
+OpenGL_ProgramCacheLoad(
+    GLProgramCache *cache, cstring8 path, u64 key,
+    f32 *compileMilliseconds)
+{
+    if (!IsPathExists(path)) {
+        return 0;
+    }
+
+    FileOpenResult openResult =
+        FileOpenEx(path, &cache->arena, PERMISSION_READ);
+    if (openResult.code != FILE_OPEN_OK) {
+        return 0;
+    }
+
+    FileHandle *handle = openResult.handle;
+    usize fileSize = FileGetSize(handle);
+
+    OpenGL_ProgramCacheHeader header = INIT_EMPTY_STRUCT(
+        OpenGL_ProgramCacheHeader);
+    void *binary = NULL;
+
+    if (fileSize > sizeof(header) &&
+        FileLoadToBuffer(handle, &header, sizeof(header), NULL) ==
+            FILE_LOAD_OK &&
+        header.magic == OPENGL_PROGRAM_CACHE_MAGIC &&
+        header.version == OPENGL_PROGRAM_CACHE_VERSION && header.key == key &&
+        header.binarySize == fileSize - sizeof(header)) {
+        binary = ScratchAlloc(&cache->arena, header.binarySize);
+    }
+
+    if (binary != NULL &&
+        FileLoadToBufferEx(
+            handle, binary, header.binarySize, NULL, sizeof(header)) !=
+            FILE_LOAD_OK) {
+        binary = NULL;
+    }
+
+    FileClose(handle);
+
+    if (binary == NULL) {
+        return 0;
+    }
+
+    GLShaderProgramID programID = 0;
+    GL_CALL_O(glCreateProgram(), &programID);
+    GL_CALL(glProgramBinary(
+        programID, header.binaryFormat, binary, (GLsizei)header.binarySize));
+
+    GLint linkStatus = GL_FALSE;
+    GL_CALL(glGetProgramiv(programID, GL_LINK_STATUS, &linkStatus));
+
+    if (linkStatus == GL_FALSE) {
+        GL_CALL(glDeleteProgram(programID));
+        return 0;
+    }
+
+    *compileMilliseconds = header.compileMilliseconds;
+    GLResourceRegister(GL_RENDER_OBJECT_PROGRAM, programID, 0);
+    return programID;
+}
+
+static void
+OpenGL_ProgramCacheStore(
+    GLProgramCache *cache, cstring8 path, u64 key, GLShaderProgramID programID,
+    f32 compileMilliseconds)
+{
+    GLint binarySize = 0;
+    GL_CALL(glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &binarySize));
+
+    if (binarySize <= 0) {
+        return;
+    }
+
+    void *binary = ScratchAlloc(&cache->arena, (usize)binarySize);
+    if (binary == NULL) {
+        return;
+    }
+
+    OpenGL_ProgramCacheHeader header = INIT_EMPTY_STRUCT(
+        OpenGL_ProgramCacheHeader);
+    header.magic = OPENGL_PROGRAM_CACHE_MAGIC;
+    header.version = OPENGL_PROGRAM_CACHE_VERSION;
+    header.key = key;
+    header.compileMilliseconds = compileMilliseconds;
+
+    GLsizei binaryLength = 0;
+    GLenum binaryFormat = 0;
+    GL_CALL(glGetProgramBinary(
+        programID, binarySize, &binaryLength, &binaryFormat, binary));
+    header.binaryFormat = binaryFormat;
+    header.binarySize = (u32)binaryLength;
+
+    FileOpenResult openResult =
+        FileOpenEx(path, &cache->arena, PERMISSION_WRITE);
+    if (openResult.code != FILE_OPEN_OK) {
+        return;
+    }
+
+    // NOTE(gr3yknigh1): Partially written file is rejected on load by size
+    // check, so result of writes can be ignored. [2025/11/23]
+    if (FileWrite(openResult.handle, &header, sizeof(header)) ==
+        FILE_WRITE_OK) {
+        FileWrite(openResult.handle, binary, header.binarySize);
+    }
+
+    FileClose(openResult.handle);
+}
+
+GLProgramCache
+GLProgramCacheMake(cstring8 directory)
+{
+    ASSERT_NONNULL(directory);
+
+    GLProgramCache cache = INIT_EMPTY_STRUCT(GLProgramCache);
+    cache.directory = directory;
+    cache.arena = ScratchMake(GL_PROGRAM_CACHE_ARENA_SIZE);
+
+    GLint binaryFormatCount = 0;
+    if (GLAD_GL_VERSION_4_1) {
+        GL_CALL(
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormatCount));
+    }
+
+    cache.isSupported = binaryFormatCount > 0 && MakeDirectory(directory);
+
+    cstring8 driverStrings[] = {
+        (cstring8)glGetString(GL_VENDOR),
+        (cstring8)glGetString(GL_RENDERER),
+        (cstring8)glGetString(GL_VERSION),
+    };
+
+    cache.driverHash = OPENGL_HASH64_SEED;
+    for (u32 index = 0; index < STATIC_ARRAY_LENGTH(driverStrings); ++index) {
+        if (driverStrings[index] != NULL) {
+            cache.driverHash =
+                OpenGL_HashCString64(cache.driverHash, driverStrings[index]);
+        }
+    }
+
+    return cache;
+}
+
+void
+GLProgramCacheDestroy(GLProgramCache *cache)
+{
+    ScratchDestroy(&cache->arena);
+}
+
+static GLShaderProgramID
+OpenGL_LoadShaderProgramFromFiles(
+    Scratch *scratch, GLProgramCache *cache, cstring8 vertexShaderFilePath,
+    cstring8 fragmentShaderFilePath, const GLShaderDefine *defines,
+    u32 defineCount)
+{
+    ASSERT_NONNULL(cache);
+
+    cache->arena.occupied = 0;
+
+    char8 *vertexSource = GLPreprocessShaderFile(
+        &cache->arena, vertexShaderFilePath, defines, defineCount);
+    char8 *fragmentSource = GLPreprocessShaderFile(
+        &cache->arena, fragmentShaderFilePath, defines, defineCount);
+    ASSERT_NONNULL(vertexSource);
+    ASSERT_NONNULL(fragmentSource);
+
+    u64 key = cache->driverHash;
+    key = OpenGL_HashCString64(key, vertexSource);
+    key = OpenGL_HashCString64(key, fragmentSource);
+
+    char8 path[OPENGL_PATH_CAPACITY];
+    OpenGL_ProgramCacheMakePath(cache, key, path, sizeof(path));
+
+    u64 beginCounter = GetPerformanceCounter();
+
+    if (cache->isSupported) {
+        f32 compileMilliseconds = 0;
+        GLShaderProgramID programID =
+            OpenGL_ProgramCacheLoad(cache, path, key, &compileMilliseconds);
+
+        if (programID != 0) {
+            cache->arena.occupied = 0;
+            OpenGL_ReflectProgram(scratch, programID);
+
+            f32 loadMilliseconds = OpenGL_TicksToMilliseconds(
+                GetPerformanceCounter() - beginCounter);
+
+            cache->hitCount += 1;
+            cache->loadMilliseconds += loadMilliseconds;
+            if (compileMilliseconds > loadMilliseconds) {
+                cache->savedMilliseconds +=
+                    compileMilliseconds - loadMilliseconds;
+            }
+
+            return programID;
+        }
+    }
+
+    beginCounter = GetPerformanceCounter();
+
+    GLShaderProgramLinkData linkData =
+        INIT_EMPTY_STRUCT(GLShaderProgramLinkData);
+    linkData.vertexShader =
+        GLCompileShader(scratch, vertexSource, GL_SHADER_TYPE_VERT);
+    linkData.fragmentShader =
+        GLCompileShader(scratch, fragmentSource, GL_SHADER_TYPE_FRAG);
+
+    GLShaderProgramID programID =
+        OpenGL_LinkShaderProgram(scratch, &linkData, cache->isSupported);
+
+    GLShaderDestroy(linkData.vertexShader);
+    GLShaderDestroy(linkData.fragmentShader);
+
+    f32 compileMilliseconds =
+        OpenGL_TicksToMilliseconds(GetPerformanceCounter() - beginCounter);
+    cache->missCount += 1;
+    cache->compileMilliseconds += compileMilliseconds;
+
+    if (cache->isSupported && programID != 0) {
+        OpenGL_ProgramCacheStore(
+            cache, path, key, programID, compileMilliseconds);
+    }
+
+    cache->arena.occupied = 0;
+    return programID;
+}
+
+GLShaderProgramID
+GLLoadShaderProgramFromFiles(
+    Scratch *scratch, GLProgramCache *cache, cstring8 vertexShaderFilePath,
+    cstring8 fragmentShaderFilePath)
+{
+    return OpenGL_LoadShaderProgramFromFiles(
+        scratch, cache, vertexShaderFilePath, fragmentShaderFilePath, NULL, 0);
+}
+
+GLShaderPermutations
+GLShaderPermutationsMake(
+    GLProgramCache *cache, cstring8 vertexShaderFilePath,
+    cstring8 fragmentShaderFilePath, const cstring8 *keywords,
+    u32 keywordCount)
+{
+    ASSERT_NONNULL(cache);
+    ASSERT_ISTRUE(keywordCount <= GL_SHADER_MAX_KEYWORDS);
+
+    GLShaderPermutations permutations =
+        INIT_EMPTY_STRUCT(GLShaderPermutations);
+    permutations.cache = cache;
+    permutations.vertexShaderFilePath = vertexShaderFilePath;
+    permutations.fragmentShaderFilePath = fragmentShaderFilePath;
+    permutations.keywordCount = keywordCount;
+
+    for (u32 keywordIndex = 0; keywordIndex < keywordCount; ++keywordIndex) {
+        permutations.keywords[keywordIndex] = keywords[keywordIndex];
+    }
+
+    return permutations;
+}
+
+u32
+GLShaderPermutationsGetKeywordMask(
+    const GLShaderPermutations *permutations, cstring8 keyword)
+{
+    for (u32 keywordIndex = 0; keywordIndex < permutations->keywordCount;
+         ++keywordIndex) {
+        if (CString8IsEqual(permutations->keywords[keywordIndex], keyword)) {
+            return 1u << keywordIndex;
+        }
+    }
+
+    return 0;
+}
+
+GLShaderProgramID
+GLShaderPermutationsGet(
+    Scratch *scratch, GLShaderPermutations *permutations, u32 keywordMask)
+{
+    ASSERT_ISTRUE(keywordMask < (1u << permutations->keywordCount));
+
+    GLShaderProgramID *program = permutations->programs + keywordMask;
+    if (*program != 0) {
+        return *program;
+    }
+
+    GLShaderDefine defines[GL_SHADER_MAX_KEYWORDS];
+    u32 defineCount = 0;
+
+    for (u32 keywordIndex = 0; keywordIndex < permutations->keywordCount;
+         ++keywordIndex) {
+        if (keywordMask & (1u << keywordIndex)) {
+            defines[defineCount].name = permutations->keywords[keywordIndex];
+            defines[defineCount].value = NULL;
+            ++defineCount;
+        }
+    }
+
+    *program = OpenGL_LoadShaderProgramFromFiles(
+        scratch, permutations->cache, permutations->vertexShaderFilePath,
+        permutations->fragmentShaderFilePath, defines, defineCount);
+    permutations->compiledCount += 1;
+
+    return *program;
+}
+
+static inline GLenum
+OpenGL_ConvertColorLayoutToOpenGLValues(ColorLayout layout)
+{
+    if (layout == COLOR_LAYOUT_BGR) {
+        return GL_BGR;
+    }
+
+    if (layout == COLOR_LAYOUT_RGBA) {
+        return GL_RGBA;
+    }
+
+    if (layout == COLOR_LAYOUT_BGRA) {
+        return GL_BGRA;
+    }
+
+    if (layout == COLOR_LAYOUT_RGB) {
+        return GL_RGB;
+    }
+
+    return (GLenum)-1;
+}
+
+static u32
+OpenGL_GetColorLayoutChannelCount(ColorLayout layout)
+{
+    if (layout == COLOR_LAYOUT_RGBA || layout == COLOR_LAYOUT_BGRA) {
+        return 4;
+    }
+
+    return 3;
+}
+
+static void
+OpenGL_SetPictureTextureParameters(void)
+{
+    GL_CALL(
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_MIRRORED_REPEAT));
+    GL_CALL(
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_MIRRORED_REPEAT));
+
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+}
+
+static u32
+OpenGL_GetMipLevelCount(u32 width, u32 height)
+{
+    u32 size = width > height ? width : height;
+    u32 levelCount = 1;
+
+    while (size > 1) {
+        size >>= 1;
+        ++levelCount;
+    }
+
+    return levelCount;
+}
+
+/*
+ * @breaf Estimates video memory of texture. Drivers pad RGB texels to four
+ * bytes and full mip chain adds third of base level.
+ */
+static usize
+OpenGL_EstimateTextureSize(
+    u32 width, u32 height, u32 layerCount, bool hasMips)
+{
+    usize size = (usize)width * height * layerCount * 4;
+    return hasMips ? size * 4 / 3 : size;
+}
+
+GLTexture
+GLTextureMakeFromBMPicture(const BMPicture *picture, ColorLayout colorLayout)
+{
+    u32 width = picture->dibHeader.width;
+    u32 height = picture->dibHeader.height;
+
+    // NOTE(gr3yknigh1): Mutable storage, since `glTexStorage2D` needs 4.2 and
+    // breakout and ffs_3d ask for 3.3 core context. [2025/11/23]
+    GLuint texture;
+    GL_CALL(glGenTextures(1, &texture));
+    GLResourceRegister(
+        GL_RENDER_OBJECT_TEXTURE, texture,
+        OpenGL_EstimateTextureSize(width, height, 1, true));
+    GLBindTexture(0, GL_TEXTURE_2D, texture);
+    GL_CALL(glTexImage2D(
+        GL_TEXTURE_2D, 0, GL_RGB, width, height, 0,
+        OpenGL_ConvertColorLayoutToOpenGLValues(colorLayout), GL_UNSIGNED_BYTE,
+        picture->data));
+    GLRenderStatsRecordTextureUpload(
+        (usize)width * height * OpenGL_GetColorLayoutChannelCount(colorLayout));
+    GL_CALL(glGenerateMipmap(GL_TEXTURE_2D));
+
+    OpenGL_SetPictureTextureParameters();
+
+    // Unbind (cleanup)
+    GLBindTexture(0, GL_TEXTURE_2D, 0);
+
+    return (GLTexture)texture;
+}
+
+GLTexture
+GLTextureMakeImmutable2D(u32 width, u32 height)
+{
+    GLuint texture;
+    GL_CALL(glGenTextures(1, &texture));
+    GLResourceRegister(
+        GL_RENDER_OBJECT_TEXTURE, texture,
+        OpenGL_EstimateTextureSize(width, height, 1, true));
+    GLBindTexture(0, GL_TEXTURE_2D, texture);
+
+    u32 levelCount = OpenGL_GetMipLevelCount(width, height);
+    if (GLAD_GL_VERSION_4_2) {
+        GL_CALL(
+            glTexStorage2D(GL_TEXTURE_2D, levelCount, GL_RGB8, width, height));
+    } else {
+        // NOTE(gr3yknigh1): Before 4.2 every level is specified by hand, so
+        // texture is complete only with whole chain. [2025/11/23]
+        for (u32 level = 0; level < levelCount; ++level) {
+            u32 levelWidth = width >> level > 0 ? width >> level : 1;
+            u32 levelHeight = height >> level > 0 ? height >> level : 1;
+            GL_CALL(glTexImage2D(
+                GL_TEXTURE_2D, level, GL_RGB8, levelWidth, levelHeight, 0,
+                GL_RGB, GL_UNSIGNED_BYTE, NULL));
+        }
+        GL_CALL(glTexParameteri(
+            GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levelCount - 1));
+    }
 
-    GL_CALL(glBindVertexArray(va));
-    GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, eb->id));
-    GL_CALL(glDrawElements(GL_TRIANGLES, eb->count, GL_UNSIGNED_INT, 0));
-}
+    OpenGL_SetPictureTextureParameters();
 
-void
-GLDrawTriangles(
-    const GLVertexBuffer *vb, const GLVertexBufferLayout *layout,
-    GLVertexArray va)
-{
-    GL_CALL(glBindVertexArray(va));
-    GL_CALL(glDrawArrays(GL_TRIANGLES, 0, vb->size / layout->stride));
+    // Unbind (cleanup)
+    GLBindTexture(0, GL_TEXTURE_2D, 0);
+
+    return (GLTexture)texture;
 }
 
 void
-GLDrawMesh(const Mesh *mesh)
+GLTextureSendData2D(
+    GLTexture texture, u32 width, u32 height, ColorLayout colorLayout,
+    const void *pixels)
 {
-    GLDrawElements(
-        &mesh->elementBuffer, &mesh->vertexBuffer, mesh->vertexArray);
+    GLBindTexture(0, GL_TEXTURE_2D, texture);
+    GL_CALL(glTexSubImage2D(
+        GL_TEXTURE_2D, 0, 0, 0, width, height,
+        OpenGL_ConvertColorLayoutToOpenGLValues(colorLayout), GL_UNSIGNED_BYTE,
+        pixels));
+    GLRenderStatsRecordTextureUpload(
+        (usize)width * height * OpenGL_GetColorLayoutChannelCount(colorLayout));
+    GL_CALL(glGenerateMipmap(GL_TEXTURE_2D));
+    GLBindTexture(0, GL_TEXTURE_2D, 0);
 }
 
-GLShaderID
-GLCompileShaderFromFile(
-    Scratch *scratch, cstring8 sourceFilePath, GLShaderType shaderType)
+GLTexture
+GLTextureArrayMakeFromBMPictureTiles(
+    const BMPicture *picture, ColorLayout colorLayout, u32 tileWidth,
+    u32 tileHeight)
 {
-    ASSERT_ISTRUE(IsPathExists(sourceFilePath));
-    ASSERT_NOTEQ(shaderType, GL_SHADER_TYPE_NONE);
-
-    FileOpenResult sourceFileOpenResult =
-        FileOpenEx(sourceFilePath, scratch, PERMISSION_READ);
-    ASSERT_ISOK(sourceFileOpenResult.code);
+    ASSERT_NONZERO(tileWidth);
+    ASSERT_NONZERO(tileHeight);
 
-    FileHandle *sourceHandle = sourceFileOpenResult.handle;
-    ASSERT_ISTRUE(FileHandleIsValid(sourceHandle));
+    u32 pictureWidth = picture->dibHeader.width;
+    u32 pictureHeight = picture->dibHeader.height;
+    u32 xTileCount = pictureWidth / tileWidth;
+    u32 yTileCount = pictureHeight / tileHeight;
+    u32 layerCount = xTileCount * yTileCount;
+    ASSERT_NONZERO(layerCount);
 
-    usize sourceFileSize = FileGetSize(sourceHandle);
-    ASSERT_NONZERO(sourceFileSize);
+    GLint maxLayerCount = 0;
+    GL_CALL(glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxLayerCount));
+    ASSERT_ISTRUE(layerCount <= (u32)maxLayerCount);
 
-    usize sourceBufferSize = sourceFileSize + 1;
+    GLuint texture;
+    GL_CALL(glGenTextures(1, &texture));
+    GLResourceRegister(
+        GL_RENDER_OBJECT_TEXTURE, texture,
+        OpenGL_EstimateTextureSize(tileWidth, tileHeight, layerCount, true));
+    GLBindTexture(0, GL_TEXTURE_2D_ARRAY, texture);
+    GL_CALL(glTexStorage3D(
+        GL_TEXTURE_2D_ARRAY, OpenGL_GetMipLevelCount(tileWidth, tileHeight),
+        GL_RGB8, tileWidth, tileHeight, layerCount));
+
+    // NOTE(gr3yknigh1): Tiles are copied straight out of the picture, rows
+    // of picture are strided by unpack row length. [2025/11/23]
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, pictureWidth));
+
+    GLenum format = OpenGL_ConvertColorLayoutToOpenGLValues(colorLayout);
+
+    for (u32 layer = 0; layer < layerCount; ++layer) {
+        GL_CALL(glPixelStorei(
+            GL_UNPACK_SKIP_PIXELS, (layer % xTileCount) * tileWidth));
+        GL_CALL(glPixelStorei(
+            GL_UNPACK_SKIP_ROWS, (layer / xTileCount) * tileHeight));
+        GL_CALL(glTexSubImage3D(
+            GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, tileWidth, tileHeight, 1,
+            format, GL_UNSIGNED_BYTE, picture->data));
+        GLRenderStatsRecordTextureUpload(
+            (usize)tileWidth * tileHeight *
+            OpenGL_GetColorLayoutChannelCount(colorLayout));
+    }
 
-    Scratch tempScratch = TempScratchMake(scratch, sourceBufferSize);
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+    GL_CALL(glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0));
+    GL_CALL(glPixelStorei(GL_UNPACK_SKIP_ROWS, 0));
 
-    void *sourceBuffer = ScratchAllocZero(&tempScratch, sourceBufferSize);
-    ASSERT_NONNULL(sourceBuffer);
+    GL_CALL(glGenerateMipmap(GL_TEXTURE_2D_ARRAY));
 
-    FileLoadResultCode sourceLoadResult =
-        FileLoadToBuffer(sourceHandle, sourceBuffer, sourceFileSize, NULL);
-    ASSERT_ISOK(sourceLoadResult);
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT));
+    GL_CALL(glTexParameteri(
+        GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER,
+        GL_NEAREST_MIPMAP_LINEAR));
+    GL_CALL(glTexParameteri(
+        GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
 
-    ASSERT_ISOK(FileClose(sourceHandle));
+    GLBindTexture(0, GL_TEXTURE_2D_ARRAY, 0);
 
-    // NOTE(gr3yknigh1): GLCompilerShader cares about null-termination.
-    // Note that `sourceBuffer` should be c-string. [2024/11/06]
-    ((char8 *)sourceBuffer)[sourceBufferSize - 1] = 0;
+    return (GLTexture)texture;
+}
 
-    GLShaderID shaderID = GLCompileShader(scratch, sourceBuffer, shaderType);
+GLRenderTarget
+GLRenderTargetMake(u32 width, u32 height)
+{
+    ASSERT_NONZERO(width);
+    ASSERT_NONZERO(height);
+
+    GLRenderTarget target = INIT_EMPTY_STRUCT(GLRenderTarget);
+    target.width = width;
+    target.height = height;
+
+    GL_CALL(glGenTextures(1, &target.color));
+    GLResourceRegister(
+        GL_RENDER_OBJECT_TEXTURE, target.color,
+        OpenGL_EstimateTextureSize(width, height, 1, false));
+    GLBindTexture(0, GL_TEXTURE_2D, target.color);
+    GL_CALL(glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, width, height));
+    GL_CALL(
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+    GL_CALL(
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+    GLBindTexture(0, GL_TEXTURE_2D, 0);
+
+    GL_CALL(glGenRenderbuffers(1, &target.depthStencil));
+    GLResourceRegister(
+        GL_RENDER_OBJECT_RENDERBUFFER, target.depthStencil,
+        OpenGL_EstimateTextureSize(width, height, 1, false));
+    GL_CALL(glBindRenderbuffer(GL_RENDERBUFFER, target.depthStencil));
+    GL_CALL(glRenderbufferStorage(
+        GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height));
+    GL_CALL(glBindRenderbuffer(GL_RENDERBUFFER, 0));
+
+    GL_CALL(glGenFramebuffers(1, &target.framebuffer));
+    GLResourceRegister(GL_RENDER_OBJECT_FRAMEBUFFER, target.framebuffer, 0);
+    GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, target.framebuffer));
+    GL_CALL(glFramebufferTexture2D(
+        GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target.color, 0));
+    GL_CALL(glFramebufferRenderbuffer(
+        GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER,
+        target.depthStencil));
+
+    GLenum status;
+    GL_CALL_O(glCheckFramebufferStatus(GL_FRAMEBUFFER), &status);
+    ASSERT_EQ(status, GL_FRAMEBUFFER_COMPLETE);
+    UNUSED(status);
+
+    GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, 0));
+
+    return target;
+}
 
-    TempScratchClean(&tempScratch, scratch);
+void
+GLRenderTargetDestroy(GLRenderTarget *target)
+{
+    GLResourceDestroy(GL_RENDER_OBJECT_FRAMEBUFFER, target->framebuffer);
+    GLResourceDestroy(GL_RENDER_OBJECT_RENDERBUFFER, target->depthStencil);
+    GLTextureDestroy(target->color);
 
-    return shaderID;
+    *target = INIT_EMPTY_STRUCT(GLRenderTarget);
 }
 
-static GLenum
-OpenGL_ConvertShaderTypeToGLEnum(GLShaderType type)
+void
+GLRenderTargetBind(const GLRenderTarget *target, u32 width, u32 height)
 {
-    if (type == GL_SHADER_TYPE_VERT) {
-        return GL_VERTEX_SHADER;
-    }
-
-    if (type == GL_SHADER_TYPE_FRAG) {
-        return GL_FRAGMENT_SHADER;
-    }
+    ASSERT_ISTRUE(width <= target->width && height <= target->height);
 
-    return 0;
+    GL_CALL(glBindFramebuffer(GL_DRAW_FRAMEBUFFER, target->framebuffer));
+    GL_CALL(glViewport(0, 0, (GLsizei)width, (GLsizei)height));
 }
 
-GLShaderID
-GLCompileShader(
-    Scratch *scratch, cstring8 shaderSource, GLShaderType shaderType)
+void
+GLRenderTargetBlit(
+    const GLRenderTarget *target, u32 width, u32 height,
+    u32 destinationFramebuffer, u32 destinationWidth, u32 destinationHeight)
 {
-    ASSERT_NONNULL(shaderSource);
-    ASSERT_ISFALSE(CString8IsEmpty(shaderSource));
-    ASSERT_NOTEQ(shaderType, GL_SHADER_TYPE_NONE);
+    GL_CALL(glBindFramebuffer(GL_READ_FRAMEBUFFER, target->framebuffer));
+    GL_CALL(glBindFramebuffer(GL_DRAW_FRAMEBUFFER, destinationFramebuffer));
 
-    GLShaderID shaderId = 0;
+    GL_CALL(glBlitFramebuffer(
+        0, 0, (GLint)width, (GLint)height, 0, 0, (GLint)destinationWidth,
+        (GLint)destinationHeight, GL_COLOR_BUFFER_BIT, GL_LINEAR));
 
-    GLenum glShaderType = OpenGL_ConvertShaderTypeToGLEnum(shaderType);
+    GL_CALL(glBindFramebuffer(GL_READ_FRAMEBUFFER, 0));
+    GL_CALL(glViewport(
+        0, 0, (GLsizei)destinationWidth, (GLsizei)destinationHeight));
+}
 
-    GL_CALL_O(glCreateShader(glShaderType), &shaderId);
-    GL_CALL(glShaderSource(shaderId, 1, &shaderSource, NULL));
-    GL_CALL(glCompileShader(shaderId));
+GLBufferTexture
+GLBufferTextureMake(u32 internalFormat)
+{
+    GLBufferTexture bufferTexture = {0};
+    bufferTexture.internalFormat = internalFormat;
+
+    GL_CALL(glGenBuffers(1, &bufferTexture.buffer));
+    GLResourceRegister(GL_RENDER_OBJECT_BUFFER, bufferTexture.buffer, 0);
+    GLBindBuffer(GL_TEXTURE_BUFFER, bufferTexture.buffer);
+    GL_CALL(glBufferData(GL_TEXTURE_BUFFER, 0, NULL, GL_DYNAMIC_DRAW));
+    GLRenderStatsRecordBufferUpload(0, true);
+
+    // NOTE(gr3yknigh1): Texture has no storage of it's own, size is
+    // accounted to buffer. [2025/11/23]
+    GL_CALL(glGenTextures(1, &bufferTexture.texture));
+    GLResourceRegister(GL_RENDER_OBJECT_TEXTURE, bufferTexture.texture, 0);
+    GLBindTexture(0, GL_TEXTURE_BUFFER, bufferTexture.texture);
+    GL_CALL(glTexBuffer(
+        GL_TEXTURE_BUFFER, internalFormat, bufferTexture.buffer));
+
+    return bufferTexture;
+}
 
-    GLint compilationStatus = GL_TRUE;
-    GL_CALL(glGetShaderiv(shaderId, GL_COMPILE_STATUS, &compilationStatus));
+void
+GLBufferTextureDestroy(GLBufferTexture *bufferTexture)
+{
+    GLTextureDestroy(bufferTexture->texture);
+    GLResourceDestroy(GL_RENDER_OBJECT_BUFFER, bufferTexture->buffer);
+    *bufferTexture = INIT_EMPTY_STRUCT(GLBufferTexture);
+}
 
-    if (compilationStatus == GL_FALSE) {
-        GLint compilationLogLength = 0;
-        GL_CALL(
-            glGetShaderiv(shaderId, GL_INFO_LOG_LENGTH, &compilationLogLength));
+GLGpuProfiler
+GLGpuProfilerMake(Profiler *profiler)
+{
+    GLGpuProfiler gpuProfiler = INIT_EMPTY_STRUCT(GLGpuProfiler);
+    gpuProfiler.profiler = profiler;
 
-        if (compilationLogLength > 0) {
+    GLint counterBits = 0;
+    GL_CALL(glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &counterBits));
+    gpuProfiler.isSupported = counterBits > 0;
 
-            char8 *compilationInfoLog =
-                ScratchAlloc(scratch, compilationLogLength); // @cleanup XXX
-            GL_CALL(glGetShaderInfoLog(
-                shaderId, GL_INFO_LOG_LENGTH, NULL, compilationInfoLog));
-            PutString(compilationInfoLog);
-        }
+    if (!gpuProfiler.isSupported) {
+        return gpuProfiler;
+    }
 
-        ThrowDebugBreak(); // @cleanup Hack
-        return 0;
+    for (u32 frameIndex = 0; frameIndex < GL_GPU_PROFILER_LATENCY;
+         ++frameIndex) {
+        GLGpuProfilerFrame *frame = gpuProfiler.frames + frameIndex;
+        GL_CALL(glGenQueries(
+            STATIC_ARRAY_LENGTH(frame->queries), frame->queries));
     }
 
-    return shaderId;
+    // NOTE(gr3yknigh1): Both clocks are sampled once, drift between them is
+    // small enough for captures of few seconds. [2025/11/23]
+    if (profiler != NULL) {
+        GLint64 gpuNanoseconds = 0;
+        GL_CALL(glGetInteger64v(GL_TIMESTAMP, &gpuNanoseconds));
+        gpuProfiler.gpuToProfilerNanoseconds =
+            (i64)ProfilerGetNanoseconds(profiler) - gpuNanoseconds;
+    }
+
+    return gpuProfiler;
 }
 
-GLShaderProgramID
-GLLinkShaderProgram(Scratch *scratch, const GLShaderProgramLinkData *data)
+static void
+OpenGL_GpuProfilerResolveFrame(
+    GLGpuProfiler *gpuProfiler, GLGpuProfilerFrame *frame)
 {
-    ASSERT_NONNULL(data);
-    ASSERT_NONZERO(data->vertexShader);
-    ASSERT_NONZERO(data->fragmentShader);
+    frame->isPending = false;
 
-    GLShaderProgramID programID = 0;
-    GL_CALL_O(glCreateProgram(), &programID);
-
-    GL_CALL(glAttachShader(programID, data->vertexShader));
-    GL_CALL(glAttachShader(programID, data->fragmentShader));
-    GL_CALL(glLinkProgram(programID));
+    if (frame->scopeCount == 0) {
+        gpuProfiler->resultCount = 0;
+        return;
+    }
 
-    GL_CALL(glValidateProgram(programID));
+    // NOTE(gr3yknigh1): With nested scopes last end query isn't the last one
+    // issued, so every end is checked. Reading result of not available query
+    // would stall. [2025/11/23]
+    for (u32 scope = 0; scope < frame->scopeCount; ++scope) {
+        GLint isAvailable = GL_FALSE;
+        GL_CALL(glGetQueryObjectiv(
+            frame->queries[scope * 2 + 1], GL_QUERY_RESULT_AVAILABLE,
+            &isAvailable));
+
+        if (!isAvailable) {
+            gpuProfiler->droppedFrameCount += 1;
+            return;
+        }
+    }
 
-    GLint linkStatus = GL_TRUE;
-    GL_CALL(glGetProgramiv(programID, GL_LINK_STATUS, &linkStatus));
+    for (u32 scope = 0; scope < frame->scopeCount; ++scope) {
+        GLuint64 begin = 0;
+        GLuint64 end = 0;
+        GL_CALL(glGetQueryObjectui64v(
+            frame->queries[scope * 2], GL_QUERY_RESULT, &begin));
+        GL_CALL(glGetQueryObjectui64v(
+            frame->queries[scope * 2 + 1], GL_QUERY_RESULT, &end));
+
+        u64 duration = end > begin ? end - begin : 0;
+        GLGpuScopeResult *result = gpuProfiler->results + scope;
+        result->name = frame->names[scope];
+        result->milliseconds = (f32)((f64)duration / 1000000.0);
+
+        i64 profilerBegin =
+            (i64)begin + gpuProfiler->gpuToProfilerNanoseconds;
+        if (gpuProfiler->profiler != NULL && profilerBegin >= 0) {
+            ProfilerPushEvent(
+                gpuProfiler->profiler, PROFILER_TRACK_GPU, frame->names[scope],
+                (u64)profilerBegin, duration);
+        }
+    }
 
-    if (linkStatus == GL_FALSE) {
-        GLint linkLogLength;
-        GL_CALL(glGetProgramiv(programID, GL_INFO_LOG_LENGTH, &linkLogLength));
+    gpuProfiler->resultCount = frame->scopeCount;
+}
 
-        if (linkLogLength > 0) {
-            char8 *linkInfoLog =
-                ScratchAlloc(scratch, linkLogLength); // @cleanup XXX
-            GL_CALL(glGetProgramInfoLog(
-                programID, GL_INFO_LOG_LENGTH, NULL, linkInfoLog));
+void
+GLGpuProfilerBeginFrame(GLGpuProfiler *gpuProfiler)
+{
+    ASSERT_ISFALSE(gpuProfiler->isFrameBegun);
+    gpuProfiler->isFrameBegun = true;
 
-            PutString(linkInfoLog);
-        }
+    GLGpuProfilerFrame *frame =
+        gpuProfiler->frames + gpuProfiler->frameIndex % GL_GPU_PROFILER_LATENCY;
 
-        ThrowDebugBreak(); // @cleanup Hack
-        return 0;
+    if (frame->isPending) {
+        OpenGL_GpuProfilerResolveFrame(gpuProfiler, frame);
     }
 
-    return programID;
+    frame->scopeCount = 0;
 }
 
-static inline GLenum
-OpenGL_ConvertColorLayoutToOpenGLValues(ColorLayout layout)
+void
+GLGpuProfilerEndFrame(GLGpuProfiler *gpuProfiler)
 {
-    if (layout == COLOR_LAYOUT_BGR) {
-        return GL_BGR;
-    }
+    ASSERT_ISTRUE(gpuProfiler->isFrameBegun);
+    gpuProfiler->isFrameBegun = false;
 
-    if (layout == COLOR_LAYOUT_RGBA) {
-        return GL_RGBA;
-    }
+    GLGpuProfilerFrame *frame =
+        gpuProfiler->frames + gpuProfiler->frameIndex % GL_GPU_PROFILER_LATENCY;
+    frame->isPending = gpuProfiler->isSupported;
+    gpuProfiler->frameIndex += 1;
+}
 
-    if (layout == COLOR_LAYOUT_BGRA) {
-        return GL_BGRA;
-    }
+u32
+GLGpuProfilerBeginScope(GLGpuProfiler *gpuProfiler, cstring8 name)
+{
+    ASSERT_ISTRUE(gpuProfiler->isFrameBegun);
 
-    if (layout == COLOR_LAYOUT_RGB) {
-        return GL_RGB;
+    GLGpuProfilerFrame *frame =
+        gpuProfiler->frames + gpuProfiler->frameIndex % GL_GPU_PROFILER_LATENCY;
+
+    if (!gpuProfiler->isSupported ||
+        frame->scopeCount >= GL_GPU_PROFILER_MAX_SCOPES) {
+        return PROFILER_INVALID_SCOPE;
     }
 
-    return (GLenum)-1;
+    u32 scope = frame->scopeCount++;
+    frame->names[scope] = name;
+    GL_CALL(glQueryCounter(frame->queries[scope * 2], GL_TIMESTAMP));
+
+    // NOTE(gr3yknigh1): End query is issued right away too, so scope, which
+    // is never closed, still has result. [2025/11/23]
+    GL_CALL(glQueryCounter(frame->queries[scope * 2 + 1], GL_TIMESTAMP));
+
+    return scope;
 }
 
-GLTexture
-GLTextureMakeFromBMPicture(const BMPicture *picture, ColorLayout colorLayout)
+void
+GLGpuProfilerEndScope(GLGpuProfiler *gpuProfiler, u32 scope)
 {
-    GLuint texture;
-    GL_CALL(glGenTextures(1, &texture));
-    GL_CALL(glBindTexture(GL_TEXTURE_2D, texture));
-    GL_CALL(glTexImage2D(
-        GL_TEXTURE_2D, 0, GL_RGB, picture->dibHeader.width,
-        picture->dibHeader.height, 0,
-        OpenGL_ConvertColorLayoutToOpenGLValues(colorLayout), GL_UNSIGNED_BYTE,
-        picture->data));
-    GL_CALL(glGenerateMipmap(GL_TEXTURE_2D));
-
-    GL_CALL(
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_MIRRORED_REPEAT));
-    GL_CALL(
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_MIRRORED_REPEAT));
+    if (scope == PROFILER_INVALID_SCOPE) {
+        return;
+    }
 
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+    GLGpuProfilerFrame *frame =
+        gpuProfiler->frames + gpuProfiler->frameIndex % GL_GPU_PROFILER_LATENCY;
+    GL_CALL(glQueryCounter(frame->queries[scope * 2 + 1], GL_TIMESTAMP));
+}
 
-    // Unbind (cleanup)
-    GL_CALL((glBindTexture(GL_TEXTURE_2D, 0)));
+void
+GLGpuProfilerDestroy(GLGpuProfiler *gpuProfiler)
+{
+    if (!gpuProfiler->isSupported) {
+        return;
+    }
 
-    return (GLTexture)texture;
+    for (u32 frameIndex = 0; frameIndex < GL_GPU_PROFILER_LATENCY;
+         ++frameIndex) {
+        GLGpuProfilerFrame *frame = gpuProfiler->frames + frameIndex;
+        GL_CALL(glDeleteQueries(
+            STATIC_ARRAY_LENGTH(frame->queries), frame->queries));
+    }
 }
 
 GFS_API GLUniformLocation
 GLShaderFindUniformLocation(GLShaderProgramID shader, cstring8 name)
 {
+    if (OpenGL_FindProgramReflection(shader, false) != NULL) {
+        return GLShaderGetUniformLocation(shader, GLUniformNameIntern(name));
+    }
+
     u32 uniformLocation = 0;
     GL_CALL_O(glGetUniformLocation(shader, name), &uniformLocation);
     return uniformLocation;
@@ -393,15 +2967,23 @@ void
 GLShaderSetUniformF32(
     GLShaderProgramID shader, GLUniformLocation location, f32 value)
 {
-    UNUSED(shader);
+    GLUseProgram(shader);
     GL_CALL(glUniform1f(location, value));
 }
 
+void
+GLShaderSetUniformV2F32(
+    GLShaderProgramID shader, GLUniformLocation location, f32 x, f32 y)
+{
+    GLUseProgram(shader);
+    GL_CALL(glUniform2f(location, x, y));
+}
+
 void
 GLShaderSetUniformV3F32(
     GLShaderProgramID shader, GLUniformLocation location, f32 x, f32 y, f32 z)
 {
-    UNUSED(shader);
+    GLUseProgram(shader);
     GL_CALL(glUniform3f(location, x, y, z));
 }
 
@@ -409,7 +2991,7 @@ void
 GLShaderSetUniformI32(
     GLShaderProgramID shader, GLUniformLocation location, i32 value)
 {
-    UNUSED(shader);
+    GLUseProgram(shader);
     GL_CALL(glUniform1i(location, value));
 }
 
@@ -417,7 +2999,7 @@ void
 GLShaderSetUniformM4F32(
     GLShaderProgramID shader, GLUniformLocation location, f32 *items)
 {
-    UNUSED(shader);
+    GLUseProgram(shader);
     GL_CALL(glUniformMatrix4fv(location, 1, GL_FALSE, items));
 }
 
@@ -467,6 +3049,226 @@ GLAssertNoErrors(cstring8 expression, cstring8 sourceFile, u64 sourceLine)
     }
 }
 
+typedef struct {
+    u32 flags;
+    GLDebugOutputCounters counters;
+
+    cstring8 callExpression;
+    cstring8 callSourceFile;
+    u64 callSourceLine;
+
+    // NOTE(gr3yknigh1): Open addressing set of hashes of reported messages.
+    // Without synchronous flag callback may run on driver thread, then rare
+    // race only prints message twice. [2025/11/23]
+    u64 messageHashes[GL_DEBUG_OUTPUT_MESSAGE_CAPACITY];
+} OpenGL_DebugOutput;
+
+static OpenGL_DebugOutput gDebugOutput;
+
+static cstring8
+OpenGL_GetDebugTypeString(GLenum type)
+{
+    switch (type) {
+    case GL_DEBUG_TYPE_ERROR:
+        return "error";
+    case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR:
+        return "deprecated";
+    case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:
+        return "undefined behavior";
+    case GL_DEBUG_TYPE_PORTABILITY:
+        return "portability";
+    case GL_DEBUG_TYPE_PERFORMANCE:
+        return "performance";
+    case GL_DEBUG_TYPE_MARKER:
+        return "marker";
+    }
+
+    return "other";
+}
+
+static cstring8
+OpenGL_GetDebugSeverityString(GLenum severity)
+{
+    switch (severity) {
+    case GL_DEBUG_SEVERITY_HIGH:
+        return "high";
+    case GL_DEBUG_SEVERITY_MEDIUM:
+        return "medium";
+    case GL_DEBUG_SEVERITY_LOW:
+        return "low";
+    }
+
+    return "notification";
+}
+
+/*
+ * @breaf Remembers message.
+ *
+ * @return `false` if message was already reported.
+ */
+static bool
+OpenGL_DebugOutputRememberMessage(u64 hash)
+{
+    // NOTE(gr3yknigh1): Zero marks empty slot. [2025/11/23]
+    hash |= 1;
+
+    for (u32 probe = 0; probe < GL_DEBUG_OUTPUT_MESSAGE_CAPACITY; ++probe) {
+        u64 *slot = gDebugOutput.messageHashes +
+                    (hash + probe) % GL_DEBUG_OUTPUT_MESSAGE_CAPACITY;
+
+        if (*slot == hash) {
+            return false;
+        }
+
+        if (*slot == 0) {
+            *slot = hash;
+            return true;
+        }
+    }
+
+    // NOTE(gr3yknigh1): Set is full, so better repeat message than lose new
+    // one. [2025/11/23]
+    return true;
+}
+
+static void APIENTRY
+OpenGL_DebugOutputCallback(
+    GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length,
+    const GLchar *message, const void *userParameter)
+{
+    UNUSED(userParameter);
+
+    GLDebugOutputCounters *counters = &gDebugOutput.counters;
+    bool isError = type == GL_DEBUG_TYPE_ERROR;
+
+    switch (type) {
+    case GL_DEBUG_TYPE_ERROR:
+        AtomicFetchAddU32(&counters->errorCount, 1);
+        break;
+    case GL_DEBUG_TYPE_PERFORMANCE:
+        AtomicFetchAddU32(&counters->performanceCount, 1);
+        break;
+    case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR:
+    case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:
+    case GL_DEBUG_TYPE_PORTABILITY:
+        AtomicFetchAddU32(&counters->warningCount, 1);
+        break;
+    default:
+        AtomicFetchAddU32(&counters->otherCount, 1);
+        break;
+    }
+
+    u64 hash = OPENGL_HASH64_SEED;
+    hash = OpenGL_HashBytes64(hash, &source, sizeof(source));
+    hash = OpenGL_HashBytes64(hash, &type, sizeof(type));
+    hash = OpenGL_HashBytes64(hash, &id, sizeof(id));
+    if (length > 0) {
+        hash = OpenGL_HashBytes64(hash, message, (usize)length);
+    }
+
+    bool isBreaking =
+        isError &&
+        (gDebugOutput.flags & GL_DEBUG_OUTPUT_BREAK_ON_ERROR_FLAG) != 0;
+
+    if (!OpenGL_DebugOutputRememberMessage(hash)) {
+        AtomicFetchAddU32(&counters->repeatedCount, 1);
+
+        if (!isBreaking) {
+            return;
+        }
+    }
+
+    char8 printBuffer[KILOBYTES(2)];
+    snprintf(
+        printBuffer, sizeof(printBuffer),
+        "%s: [GL] %s (%s, id=%u): %s\n"
+        "    last call: '%s' at %s:%llu\n",
+        isError ? "E" : "W", OpenGL_GetDebugTypeString(type),
+        OpenGL_GetDebugSeverityString(severity), id, message,
+        gDebugOutput.callExpression != NULL ? gDebugOutput.callExpression
+                                            : "(unknown)",
+        gDebugOutput.callSourceFile != NULL ? gDebugOutput.callSourceFile
+                                            : "(unknown)",
+        (unsigned long long)gDebugOutput.callSourceLine);
+
+    if (isBreaking) {
+        THROW(printBuffer);
+    }
+
+    PutString(printBuffer);
+}
+
+#if defined(GLAD_DEBUG)
+static void
+OpenGL_LoaderPostCallback(cstring8 name, void *function, int argumentCount, ...)
+{
+    UNUSED(name);
+    UNUSED(function);
+    UNUSED(argumentCount);
+}
+#endif
+
+bool
+GLDebugOutputEnable(u32 flags)
+{
+    // NOTE(gr3yknigh1): Under `GLAD_DEBUG` `glDebugMessageCallback` is a
+    // wrapper, which is never `NULL`, so check version which glad has loaded.
+    // [2025/11/23]
+    if (!GLAD_GL_VERSION_4_3 || glad_glDebugMessageCallback == NULL) {
+        return false;
+    }
+
+    gDebugOutput.flags = flags;
+
+#if defined(GLAD_DEBUG)
+    // NOTE(gr3yknigh1): Debug flavour of glad calls `glGetError` after every
+    // function. Callback reports the same errors without round trips.
+    // [2025/11/23]
+    glad_set_post_callback(OpenGL_LoaderPostCallback);
+#endif
+
+    GL_CALL(glEnable(GL_DEBUG_OUTPUT));
+    if ((flags & GL_DEBUG_OUTPUT_SYNCHRONOUS_FLAG) != 0) {
+        GL_CALL(glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS));
+    } else {
+        GL_CALL(glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS));
+    }
+
+    GL_CALL(glDebugMessageCallback(OpenGL_DebugOutputCallback, NULL));
+    GL_CALL(glDebugMessageControl(
+        GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, NULL,
+        (flags & GL_DEBUG_OUTPUT_NOTIFICATIONS_FLAG) != 0));
+
+    return true;
+}
+
+void
+GLDebugOutputIgnoreMessage(u32 source, u32 type, u32 id)
+{
+    GL_CALL(glDebugMessageControl(source, type, GL_DONT_CARE, 1, &id, false));
+}
+
+GLDebugOutputCounters
+GLDebugOutputGetCounters(void)
+{
+    return gDebugOutput.counters;
+}
+
+void
+GLDebugOutputResetCounters(void)
+{
+    MemoryZero(&gDebugOutput.counters, sizeof(gDebugOutput.counters));
+}
+
+void
+GLDebugOutputSetCallSite(
+    cstring8 expression, cstring8 sourceFile, u64 sourceLine)
+{
+    gDebugOutput.callExpression = expression;
+    gDebugOutput.callSourceFile = sourceFile;
+    gDebugOutput.callSourceLine = sourceLine;
+}
+
 Mesh *
 GLGetCubeMesh(Scratch *scratch, GLVertexesOrientation orientation)
 {
@@ -0,0 +1,379 @@
+/*
+ * FILE      gfs\code\gfs\src\texture_streamer.c
+ * AUTHOR    Ilya Akkuzin <gr3yknigh1@gmail.com>
+ * COPYRIGHT (c) 2025 Ilya Akkuzin
+ * */
+
+#include "gfs/texture_streamer.h"
+
+#include <glad/glad.h>
+
+#include "gfs/types.h"
+#include "gfs/macros.h"
+#include "gfs/memory.h"
+#include "gfs/assert.h"
+#include "gfs/platform.h"
+#include "gfs/bmp.h"
+#include "gfs/render_opengl.h"
+
+#define GL_TEXTURE_STREAMER_WORKER_ARENA_SIZE KILOBYTES(4)
+
+// NOTE(gr3yknigh1): Room for file handle and alignment on top of file size,
+// which is always bigger than picture data. [2025/11/23]
+#define GL_TEXTURE_STREAMER_DECODE_SLACK KILOBYTES(1)
+
+static void
+GLTextureStreamerPushJob(GLTextureStreamer *streamer, GLTextureUpload *upload)
+{
+    u32 pushed = streamer->jobsPushed;
+    streamer->jobs[pushed % GL_TEXTURE_STREAMER_CAPACITY] =
+        (u32)(upload - streamer->uploads);
+    AtomicFetchAddU32(&streamer->jobsPushed, 1);
+    SemaphoreSignal(streamer->jobReady);
+}
+
+static void
+GLTextureStreamerDecode(GLTextureStreamer *streamer, GLTextureUpload *upload)
+{
+    if (!IsPathExists(upload->filePath)) {
+        AtomicStoreU32(&upload->state, GL_TEXTURE_UPLOAD_FAILED);
+        return;
+    }
+
+    Scratch temp = TempScratchMake(&streamer->workerArena, KILOBYTES(1));
+    FileOpenResult result =
+        FileOpenEx(upload->filePath, &temp, PERMISSION_READ);
+    usize fileSize = 0;
+    if (result.code == FILE_OPEN_OK) {
+        fileSize = FileGetSize(result.handle);
+        FileClose(result.handle);
+    }
+    TempScratchClean(&temp, &streamer->workerArena);
+
+    if (fileSize == 0) {
+        AtomicStoreU32(&upload->state, GL_TEXTURE_UPLOAD_FAILED);
+        return;
+    }
+
+    upload->decodeArena =
+        ScratchMake(fileSize + GL_TEXTURE_STREAMER_DECODE_SLACK);
+    if (upload->decodeArena.data == NULL) {
+        AtomicStoreU32(&upload->state, GL_TEXTURE_UPLOAD_FAILED);
+        return;
+    }
+
+    BMPictureLoadFromFile(
+        &upload->picture, &upload->decodeArena, upload->filePath);
+    upload->width = upload->picture.dibHeader.width;
+    upload->height = upload->picture.dibHeader.height;
+    upload->size = upload->picture.dibHeader.imageSize;
+
+    AtomicStoreU32(&upload->state, GL_TEXTURE_UPLOAD_DECODED);
+}
+
+static void
+GLTextureStreamerCopy(GLTextureUpload *upload)
+{
+    MemoryCopy(upload->staging, upload->picture.data, upload->size);
+    ScratchDestroy(&upload->decodeArena);
+    AtomicStoreU32(&upload->state, GL_TEXTURE_UPLOAD_COPIED);
+}
+
+static void
+GLTextureStreamerWorkerProc(void *parameter)
+{
+    GLTextureStreamer *streamer = parameter;
+
+    for (;;) {
+        SemaphoreWait(streamer->jobReady);
+
+        // NOTE(gr3yknigh1): Every job signals once, so extra signal without
+        // a job behind it is stop request. [2025/11/23]
+        u32 popped = streamer->jobsPopped;
+        if (popped == AtomicLoadU32(&streamer->jobsPushed)) {
+            ASSERT_ISTRUE(AtomicLoadU32(&streamer->isStopping));
+            break;
+        }
+
+        GLTextureUpload *upload =
+            streamer->uploads +
+            streamer->jobs[popped % GL_TEXTURE_STREAMER_CAPACITY];
+
+        switch (AtomicLoadU32(&upload->state)) {
+        case GL_TEXTURE_UPLOAD_DECODING:
+            GLTextureStreamerDecode(streamer, upload);
+            break;
+        case GL_TEXTURE_UPLOAD_COPYING:
+            GLTextureStreamerCopy(upload);
+            break;
+        default:
+            ASSERT_ISTRUE(false);
+            break;
+        }
+
+        AtomicFetchAddU32(&streamer->jobsPopped, 1);
+    }
+}
+
+GLTextureStreamer *
+GLTextureStreamerMake(Scratch *scratch, usize frameBudgetBytes)
+{
+    GLTextureStreamer *streamer =
+        ScratchAllocZero(scratch, sizeof(GLTextureStreamer));
+    if (streamer == NULL) {
+        return NULL;
+    }
+
+    streamer->frameBudgetBytes = frameBudgetBytes;
+    streamer->workerArena =
+        TempScratchMake(scratch, GL_TEXTURE_STREAMER_WORKER_ARENA_SIZE);
+    if (streamer->workerArena.data == NULL) {
+        return NULL;
+    }
+
+    GL_CALL(glGenBuffers(
+        GL_TEXTURE_STREAMER_STAGING_COUNT, streamer->stagingBuffers));
+    for (u32 index = 0; index < GL_TEXTURE_STREAMER_STAGING_COUNT; ++index) {
+        GLResourceRegister(
+            GL_RENDER_OBJECT_BUFFER, streamer->stagingBuffers[index], 0);
+    }
+
+    streamer->jobReady = SemaphoreCreate(scratch, 0);
+    if (streamer->jobReady == NULL) {
+        return NULL;
+    }
+
+    streamer->worker =
+        ThreadCreate(scratch, GLTextureStreamerWorkerProc, streamer);
+    if (streamer->worker == NULL) {
+        return NULL;
+    }
+
+    return streamer;
+}
+
+GLTextureUpload *
+GLTextureStreamerRequest(
+    GLTextureStreamer *streamer, cstring8 filePath, ColorLayout colorLayout)
+{
+    for (u32 index = 0; index < GL_TEXTURE_STREAMER_CAPACITY; ++index) {
+        GLTextureUpload *upload = streamer->uploads + index;
+
+        if (AtomicLoadU32(&upload->state) != GL_TEXTURE_UPLOAD_NONE) {
+            continue;
+        }
+
+        MemoryZero(upload, sizeof(*upload));
+        upload->filePath = filePath;
+        upload->colorLayout = colorLayout;
+        AtomicStoreU32(&upload->state, GL_TEXTURE_UPLOAD_DECODING);
+
+        GLTextureStreamerPushJob(streamer, upload);
+        return upload;
+    }
+
+    return NULL;
+}
+
+static bool
+GLTextureStreamerBeginCopy(
+    GLTextureStreamer *streamer, GLTextureUpload *upload)
+{
+    u32 stagingIndex = GL_TEXTURE_STREAMER_STAGING_COUNT;
+    for (u32 index = 0; index < GL_TEXTURE_STREAMER_STAGING_COUNT; ++index) {
+        if (streamer->stagingOwners[index] == NULL) {
+            stagingIndex = index;
+            break;
+        }
+    }
+
+    if (stagingIndex == GL_TEXTURE_STREAMER_STAGING_COUNT) {
+        return false;
+    }
+
+    // NOTE(gr3yknigh1): First upload of the update always passes, otherwise
+    // picture bigger than budget would never be uploaded. [2025/11/23]
+    usize frameBytes = streamer->stats.frameBytes;
+    if (frameBytes > 0 &&
+        frameBytes + upload->size > streamer->frameBudgetBytes) {
+        return false;
+    }
+
+    // NOTE(gr3yknigh1): Context is 4.3, so no persistent mapping
+    // (`glBufferStorage`). Orphaning buffer before map lets driver hand out
+    // fresh memory instead of waiting for previous transfer. [2025/11/23]
+    u32 stagingBuffer = streamer->stagingBuffers[stagingIndex];
+    GLBindBuffer(GL_PIXEL_UNPACK_BUFFER, stagingBuffer);
+    GL_CALL(glBufferData(
+        GL_PIXEL_UNPACK_BUFFER, upload->size, NULL, GL_STREAM_DRAW));
+    GLRenderStatsRecordBufferUpload(upload->size, true);
+    GLResourceSetSize(GL_RENDER_OBJECT_BUFFER, stagingBuffer, upload->size);
+
+    void *staging;
+    GL_CALL_O(
+        glMapBufferRange(
+            GL_PIXEL_UNPACK_BUFFER, 0, upload->size,
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT),
+        &staging);
+    GLBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    if (staging == NULL) {
+        return false;
+    }
+
+    streamer->stagingOwners[stagingIndex] = upload;
+    streamer->stats.frameBytes += upload->size;
+
+    upload->staging = staging;
+    upload->stagingIndex = stagingIndex;
+    AtomicStoreU32(&upload->state, GL_TEXTURE_UPLOAD_COPYING);
+
+    GLTextureStreamerPushJob(streamer, upload);
+    return true;
+}
+
+static void
+GLTextureStreamerReleaseStaging(
+    GLTextureStreamer *streamer, GLTextureUpload *upload)
+{
+    streamer->stagingOwners[upload->stagingIndex] = NULL;
+    upload->staging = NULL;
+}
+
+static void
+GLTextureStreamerTransfer(GLTextureStreamer *streamer, GLTextureUpload *upload)
+{
+    GLBindBuffer(
+        GL_PIXEL_UNPACK_BUFFER, streamer->stagingBuffers[upload->stagingIndex]);
+
+    GLboolean isUnmapped;
+    GL_CALL_O(glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER), &isUnmapped);
+
+    // NOTE(gr3yknigh1): Store may get corrupted while mapped (e.g. on mode
+    // switch), then there is nothing to transfer. [2025/11/23]
+    if (!isUnmapped) {
+        GLBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        GLTextureStreamerReleaseStaging(streamer, upload);
+        AtomicStoreU32(&upload->state, GL_TEXTURE_UPLOAD_FAILED);
+        return;
+    }
+
+    upload->texture = GLTextureMakeImmutable2D(upload->width, upload->height);
+    GLTextureSendData2D(
+        upload->texture, upload->width, upload->height, upload->colorLayout,
+        NULL);
+    GLBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    GLsync fence;
+    GL_CALL_O(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), &fence);
+    upload->fence = fence;
+    AtomicStoreU32(&upload->state, GL_TEXTURE_UPLOAD_TRANSFERRING);
+}
+
+static void
+GLTextureStreamerPollFence(
+    GLTextureStreamer *streamer, GLTextureUpload *upload)
+{
+    GLenum status;
+    GL_CALL_O(glClientWaitSync(upload->fence, 0, 0), &status);
+    if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+        return;
+    }
+
+    GL_CALL(glDeleteSync(upload->fence));
+    upload->fence = NULL;
+    GLTextureStreamerReleaseStaging(streamer, upload);
+
+    streamer->stats.uploadedCount += 1;
+    streamer->stats.uploadedBytes += upload->size;
+    AtomicStoreU32(&upload->state, GL_TEXTURE_UPLOAD_READY);
+}
+
+void
+GLTextureStreamerUpdate(GLTextureStreamer *streamer)
+{
+    streamer->stats.frameBytes = 0;
+    streamer->stats.pendingCount = 0;
+
+    for (u32 index = 0; index < GL_TEXTURE_STREAMER_CAPACITY; ++index) {
+        GLTextureUpload *upload = streamer->uploads + index;
+
+        u32 state = AtomicLoadU32(&upload->state);
+
+        switch (state) {
+        case GL_TEXTURE_UPLOAD_DECODED:
+            GLTextureStreamerBeginCopy(streamer, upload);
+            break;
+        case GL_TEXTURE_UPLOAD_COPIED:
+            GLTextureStreamerTransfer(streamer, upload);
+            break;
+        case GL_TEXTURE_UPLOAD_TRANSFERRING:
+            GLTextureStreamerPollFence(streamer, upload);
+            break;
+        default:
+            break;
+        }
+
+        if (state != GL_TEXTURE_UPLOAD_NONE &&
+            state < GL_TEXTURE_UPLOAD_READY) {
+            streamer->stats.pendingCount += 1;
+        }
+    }
+}
+
+bool
+GLTextureUploadIsReady(GLTextureUpload *upload)
+{
+    return AtomicLoadU32(&upload->state) == GL_TEXTURE_UPLOAD_READY;
+}
+
+void
+GLTextureUploadRelease(GLTextureUpload *upload)
+{
+    u32 state = AtomicLoadU32(&upload->state);
+    ASSERT_ISTRUE(
+        state == GL_TEXTURE_UPLOAD_READY || state == GL_TEXTURE_UPLOAD_FAILED);
+    UNUSED(state);
+
+    AtomicStoreU32(&upload->state, GL_TEXTURE_UPLOAD_NONE);
+}
+
+void
+GLTextureStreamerDestroy(GLTextureStreamer *streamer)
+{
+    AtomicStoreU32(&streamer->isStopping, true);
+    SemaphoreSignal(streamer->jobReady);
+    ThreadJoin(streamer->worker);
+    SemaphoreDestroy(streamer->jobReady);
+
+    for (u32 index = 0; index < GL_TEXTURE_STREAMER_CAPACITY; ++index) {
+        GLTextureUpload *upload = streamer->uploads + index;
+
+        switch (AtomicLoadU32(&upload->state)) {
+        case GL_TEXTURE_UPLOAD_DECODED:
+            ScratchDestroy(&upload->decodeArena);
+            break;
+        case GL_TEXTURE_UPLOAD_TRANSFERRING:
+            GL_CALL(glDeleteSync(upload->fence));
+            break;
+        default:
+            break;
+        }
+    }
+
+    for (u32 index = 0; index < GL_TEXTURE_STREAMER_STAGING_COUNT; ++index) {
+        GLTextureUpload *owner = streamer->stagingOwners[index];
+        if (owner != NULL &&
+            AtomicLoadU32(&owner->state) == GL_TEXTURE_UPLOAD_COPIED) {
+            GLBindBuffer(
+                GL_PIXEL_UNPACK_BUFFER, streamer->stagingBuffers[index]);
+            GL_CALL(glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
+            GLBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        }
+    }
+
+    for (u32 index = 0; index < GL_TEXTURE_STREAMER_STAGING_COUNT; ++index) {
+        GLResourceDestroy(
+            GL_RENDER_OBJECT_BUFFER, streamer->stagingBuffers[index]);
+    }
+}
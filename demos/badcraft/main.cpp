@@ -7,7 +7,7 @@
  *
  * TODOs:
  *   - [X] Render with element buffer
- *   - [ ] Learn and possibly implement instancing rendering
+ *   - [X] Learn and possibly implement instancing rendering
  *   - [X] Implement basic chunk render system
  *   - [ ] Try to use strip rendering
  *   - [ ] Learn and implement texture atlas
@@ -18,6 +18,11 @@
  */
 #include <cstdio>
 #include <cmath>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 #include <SDL2/SDL.h>
 #include <glad/glad.h>
@@ -33,19 +38,34 @@
 #include <gfs/macros.h>
 #include <gfs/assert.h>
 #include <gfs/game_state.h>
+#include <gfs/render.h>
 #include <gfs/render_opengl.h>
+#include <gfs/texture_streamer.h>
+#include <gfs/frame_capture.h>
+#include <gfs/dynamic_resolution.h>
+#include <gfs/job.h>
+#include <gfs/profiler.h>
 #include <gfs/physics.h>
+#include <gfs/static_assert.h>
 
 #include "camera.hpp"
 
 #define BLOCK_SIDE_SIZE EXPAND(1)
 #define CHUNK_SIDE_SIZE EXPAND(16)
+#define CHUNK_SIDE_SHIFT EXPAND(4)
+#define CHUNK_SIDE_MASK EXPAND(CHUNK_SIDE_SIZE - 1)
 #define CHUNK_MAX_BLOCK_COUNT \
     EXPAND(CHUNK_SIDE_SIZE *CHUNK_SIDE_SIZE *CHUNK_SIDE_SIZE)
 #define FACE_PER_BLOCK EXPAND(6)
 #define INDEXES_PER_FACE EXPAND(6)
 #define VERTEXES_PER_FACE EXPAND(4)
 
+// NOTE(gr3yknigh1): Faces are emitted only between solid and empty blocks,
+// chunk of 16^3 has at most 11520 such pairs inside plus 1536 on it's sides.
+// So every chunk fits in shared 16-bit quad index buffer. [2025/11/23]
+#define CHUNK_MAX_FACE_COUNT \
+    EXPAND(GL_ELEMENT_U16_MAX_VERTEX_COUNT / VERTEXES_PER_FACE)
+
 #define WORLD_CHUNK_X_COUNT EXPAND(6)
 #define WORLD_CHUNK_Y_COUNT EXPAND(6)
 #define WORLD_CHUNK_Z_COUNT EXPAND(6)
@@ -56,6 +76,35 @@
 #define BLOCK_MIN_Y 0
 #define BLOCK_MIN_Z 0
 
+#define CUBE_STRESS_MAX_COUNT EXPAND(50000)
+#define CUBE_STRESS_SPACING EXPAND(1.5f)
+#define CUBE_STRESS_Y_POSITION EXPAND(40)
+
+#define DRAW_UNIFORM_RING_CAPACITY MEGABYTES(4)
+
+#define RENDER_QUEUE_CAPACITY \
+    EXPAND(WORLD_CHUNK_COUNT + CUBE_STRESS_MAX_COUNT + 1)
+// NOTE(gr3yknigh1): Vertex buffer of every chunk, element buffer is shared.
+// [2025/11/23]
+#define RENDER_QUEUE_UPLOAD_CAPACITY EXPAND(WORLD_CHUNK_COUNT)
+
+#define TEXTURE_STREAMER_FRAME_BUDGET KILOBYTES(512)
+
+#define PROFILER_EVENT_CAPACITY EXPAND(65536)
+#define PROFILER_CAPTURE_FRAME_COUNT EXPAND(120)
+#define PROFILER_CAPTURE_PATH "badcraft_trace.json"
+
+#define DYNAMIC_RESOLUTION_BUDGET_MILLISECONDS EXPAND(14.0f)
+
+#define SCREENSHOT_PATH_PREFIX "badcraft_screenshot"
+#define VIDEO_PATH_PREFIX "badcraft_video"
+
+#define GPU_RESOURCE_MAX_BUDGET MEGABYTES(512)
+
+enum class RenderPass : u32 {
+    Opaque = 0,
+};
+
 #define BLOCK_MAX_X WORLD_CHUNK_X_COUNT *CHUNK_SIDE_SIZE
 #define BLOCK_MAX_Y WORLD_CHUNK_Y_COUNT *CHUNK_SIDE_SIZE
 #define BLOCK_MAX_Z WORLD_CHUNK_Z_COUNT *CHUNK_SIDE_SIZE
@@ -70,16 +119,76 @@ typedef struct {
     u32 faceEmitted;
 } Block;
 
-typedef struct {
-    f32 position[3];
-    f32 color[3];
-    f32 uv[2];
-} Vertex;
+enum class FaceNormal : u8 {
+    Front = 0,
+    Back,
+    Top,
+    Bottom,
+    Left,
+    Right,
+};
 
+/*
+ * @breaf Packed chunk vertex, decoded in `assets/chunk.vert.glsl`. Chunk
+ * origin comes from model matrix.
+ */
+typedef struct {
+    u8 position[3]; // Chunk-local, 0..CHUNK_SIDE_SIZE.
+    u8 normal;      // FaceNormal.
+    u16 tile;       // Row-major index of atlas tile.
+    u8 corner;      // Corner of the tile, 0..3.
+
+    // NOTE(gr3yknigh1): Times tile repeats along edges of merged face, minus
+    // one: [0, 4) along top edge, [4, 8) along left edge. Zero for faces of
+    // single block. [2025/11/23]
+    u8 extent;
+} ChunkVertex;
+
+EXPECT_TYPE_SIZE(ChunkVertex, 8);
+STATIC_ASSERT(CHUNK_SIDE_SIZE <= 16);
+
+// NOTE(gr3yknigh1): Vertexes go around the face, so all faces share same
+// index pattern {0, 1, 2, 0, 2, 3}. [2025/11/23]
 typedef struct {
-    Vertex vertexes[VERTEXES_PER_FACE]; // 4
+    ChunkVertex vertexes[VERTEXES_PER_FACE]; // 4
 } Face;
 
+/*
+ * @breaf Whole face in 32 bits, vertex pulling path. Expanded into quad in
+ * `assets/chunk_pulling.vert.glsl` by `gl_VertexID`.
+ *
+ * Bits: [0, 5) x, [5, 10) y, [10, 15) z, [15, 18) FaceNormal, [18, 32) tile.
+ */
+typedef u32 FaceRecord;
+
+#define FACE_RECORD_POSITION_BITS EXPAND(5)
+#define FACE_RECORD_NORMAL_SHIFT EXPAND(15)
+#define FACE_RECORD_TILE_SHIFT EXPAND(18)
+#define FACE_RECORD_MAX_TILE_COUNT EXPAND(1u << (32 - FACE_RECORD_TILE_SHIFT))
+
+STATIC_ASSERT(CHUNK_SIDE_SIZE <= (1 << FACE_RECORD_POSITION_BITS));
+
+static inline FaceRecord
+FaceRecordPack(u32 x, u32 y, u32 z, FaceNormal normal, u16 tile)
+{
+    return x | (y << FACE_RECORD_POSITION_BITS) |
+           (z << (FACE_RECORD_POSITION_BITS * 2)) |
+           (static_cast<u32>(normal) << FACE_RECORD_NORMAL_SHIFT) |
+           (static_cast<u32>(tile) << FACE_RECORD_TILE_SHIFT);
+}
+
+/*
+ * @breaf How chunks are meshed and drawn. Switching path regenerates all
+ * chunks.
+ */
+enum class ChunkRenderPath : i32 {
+    Vertexes = 0,  // Four `ChunkVertex` per face.
+    VertexPulling, // One `FaceRecord` per face, no vertex attributes.
+    Greedy,        // Same as `Vertexes`, coplanar faces merged into quads.
+    Binary,        // Same as `Vertexes`, faces culled with column bitmasks.
+    Count,
+};
+
 enum class ChunkState : u32 {
     NotTouched = 0,
     TerrainGenerated,
@@ -100,119 +209,327 @@ typedef struct {
     Block blocks[CHUNK_MAX_BLOCK_COUNT];
 
     ARRAY(Face) faces;
-    ARRAY(u32) indexes;
+    ARRAY(FaceRecord) faceRecords;
 
     Vector3F32 coords;
     ChunkState state;
+
+    // NOTE(gr3yknigh1): Each chunk keeps its geometry on GPU, so recorded
+    // draw commands can be executed in any order. Geometry is re-uploaded
+    // only after it was regenerated. [2025/11/16]
+    GLVertexArray vertexArray;
+    GLVertexBuffer vertexBuffer;
+    GLBufferTexture faceRecordTexture;
+    bool isGeometryUploaded;
 } Chunk;
 
 typedef struct {
     ARRAY(Chunk) chunks;
+    ChunkRenderPath renderPath;
+
+    // NOTE(gr3yknigh1): While set, chunks belong to build jobs, so main
+    // thread neither draws nor changes them. [2025/11/23]
+    bool isBuilding;
 } World;
 
+STATIC_ASSERT((1 << CHUNK_SIDE_SHIFT) == CHUNK_SIDE_SIZE);
+
+/*
+ * @breaf Block access by integer world coordinates. Remembers chunk of last
+ * access, so scans over neighbour blocks skip chunk lookup.
+ */
+typedef struct {
+    World *world;
+    Chunk *chunk; // `NULL` before first access.
+    Vector3I32 chunkCoords;
+} WorldCursor;
+
+#define FACE_NORMAL(NAME) static_cast<u8>(FaceNormal::NAME)
+
+// NOTE(gr3yknigh1): Corners must match `FACE_CORNERS` in
+// `assets/chunk_pulling.vert.glsl`. [2025/11/23]
+
 const static Face FRONT_FACE = LITERAL(Face){{
-    // Position  Colors      UV
-    {{0, 1, 1}, {1, 1, 1}, {0, 1}}, // [00] top-left
-    {{1, 1, 1}, {1, 1, 1}, {1, 1}}, // [01] top-right
-    {{1, 0, 1}, {1, 1, 1}, {1, 0}}, // [02] bottom-right
-    {{0, 0, 1}, {1, 1, 1}, {0, 0}}  // [03] bottom-left
+    // Position  Normal                Tile  Corner  Extent
+    {{0, 1, 1}, FACE_NORMAL(Front), 0, 0, 0}, // top-left
+    {{1, 1, 1}, FACE_NORMAL(Front), 0, 1, 0}, // top-right
+    {{1, 0, 1}, FACE_NORMAL(Front), 0, 2, 0}, // bottom-right
+    {{0, 0, 1}, FACE_NORMAL(Front), 0, 3, 0}  // bottom-left
 }};
 
-const static u32 FRONT_FACE_INDEXES[6] = {
-    0, 1, 3, // top-left
-    3, 1, 2, // bottom-right
-};
-
 const static Face BACK_FACE = LITERAL(Face){{
-    // Position  Colors     UV
-    {{1, 1, 0}, {1, 1, 1}, {0, 1}}, // [0] [04] top-left
-    {{0, 1, 0}, {1, 1, 1}, {1, 1}}, // [1] [05] top-right
-    {{0, 0, 0}, {1, 1, 1}, {1, 0}}, // [2] [06] bottom-right
-    {{1, 0, 0}, {1, 1, 1}, {0, 0}}  // [3] [07] bottom-left
+    // Position  Normal                Tile  Corner  Extent
+    {{1, 1, 0}, FACE_NORMAL(Back), 0, 0, 0}, // top-left
+    {{0, 1, 0}, FACE_NORMAL(Back), 0, 1, 0}, // top-right
+    {{0, 0, 0}, FACE_NORMAL(Back), 0, 2, 0}, // bottom-right
+    {{1, 0, 0}, FACE_NORMAL(Back), 0, 3, 0}  // bottom-left
 }};
 
-const static u32 BACK_FACE_INDEXES[6] = {
-    0, 1, 2, // 4, 5, 6, // top-left
-    2, 3, 0, // 6, 7, 4, // bottom-right
-};
-
 const static Face TOP_FACE = LITERAL(Face){{
-    // Position  Colors     UV
-    {{0, 1, 0}, {1, 1, 1}, {0, 1}}, // [0] [08] top-left
-    {{1, 1, 0}, {1, 1, 1}, {1, 1}}, // [1] [09] top-right
-    {{1, 1, 1}, {1, 1, 1}, {1, 0}}, // [2] [10] bottom-right
-    {{0, 1, 1}, {1, 1, 1}, {0, 0}}  // [3] [11] bottom-left
+    // Position  Normal                Tile  Corner  Extent
+    {{0, 1, 0}, FACE_NORMAL(Top), 0, 0, 0}, // top-left
+    {{1, 1, 0}, FACE_NORMAL(Top), 0, 1, 0}, // top-right
+    {{1, 1, 1}, FACE_NORMAL(Top), 0, 2, 0}, // bottom-right
+    {{0, 1, 1}, FACE_NORMAL(Top), 0, 3, 0}  // bottom-left
 }};
 
-const static u32 TOP_FACE_INDEXES[6] = {
-    3, 0, 1, // 11, 8,  9,  // top-left
-    1, 2, 3, // 9,  10, 11, // bottom-right
-};
-
 const static Face BOTTOM_FACE = LITERAL(Face){{
-    // Position  Colors    UV
-    {{0, 0, 1}, {1, 1, 1}, {0, 1}}, // [0] [12] top-left
-    {{1, 0, 1}, {1, 1, 1}, {1, 1}}, // [1] [13] top-right
-    {{1, 0, 0}, {1, 1, 1}, {1, 0}}, // [2] [14] bottom-right
-    {{0, 0, 0}, {1, 1, 1}, {0, 0}}  // [3] [15] bottom-left
+    // Position  Normal                Tile  Corner  Extent
+    {{0, 0, 1}, FACE_NORMAL(Bottom), 0, 0, 0}, // top-left
+    {{1, 0, 1}, FACE_NORMAL(Bottom), 0, 1, 0}, // top-right
+    {{1, 0, 0}, FACE_NORMAL(Bottom), 0, 2, 0}, // bottom-right
+    {{0, 0, 0}, FACE_NORMAL(Bottom), 0, 3, 0}  // bottom-left
 }};
 
-const static u32 BOTTOM_FACE_INDEXES[6] = {
-    0, 1, 3, // 12, 13, 15, // top-left
-    3, 1, 2, // 15, 13, 14, // bottom-right
-};
-
 const static Face LEFT_FACE = LITERAL(Face){{
-    // Position  Colors      UV
-    {{0, 1, 0}, {1, 1, 1}, {0, 1}}, // [0] [16] top-left
-    {{0, 1, 1}, {1, 1, 1}, {1, 1}}, // [1] [17] top-right
-    {{0, 0, 1}, {1, 1, 1}, {0, 0}}, // [2] [18] bottom-right
-    {{0, 0, 0}, {1, 1, 1}, {1, 0}}  // [3] [19] bottom-left
+    // Position  Normal                Tile  Corner  Extent
+    {{0, 1, 0}, FACE_NORMAL(Left), 0, 0, 0}, // top-left
+    {{0, 1, 1}, FACE_NORMAL(Left), 0, 1, 0}, // top-right
+    {{0, 0, 1}, FACE_NORMAL(Left), 0, 2, 0}, // bottom-right
+    {{0, 0, 0}, FACE_NORMAL(Left), 0, 3, 0}  // bottom-left
 }};
 
-const static u32 LEFT_FACE_INDEXES[6] = {
-    3, 0, 1, // 19, 16, 17, // top-left
-    1, 2, 3, // 17, 18, 19  // bottom-right
-};
-
 const static Face RIGHT_FACE = LITERAL(Face){{
-    // Position  Colors      UV
-    {{1, 1, 1}, {1, 1, 1}, {0, 1}}, // [0] [20] top-left
-    {{1, 1, 0}, {1, 1, 1}, {1, 1}}, // [1] [21] top-right
-    {{1, 0, 0}, {1, 1, 1}, {0, 0}}, // [2] [22] bottom-right
-    {{1, 0, 1}, {1, 1, 1}, {1, 0}}  // [3] [23] bottom-left
+    // Position  Normal                Tile  Corner  Extent
+    {{1, 1, 1}, FACE_NORMAL(Right), 0, 0, 0}, // top-left
+    {{1, 1, 0}, FACE_NORMAL(Right), 0, 1, 0}, // top-right
+    {{1, 0, 0}, FACE_NORMAL(Right), 0, 2, 0}, // bottom-right
+    {{1, 0, 1}, FACE_NORMAL(Right), 0, 3, 0}  // bottom-left
 }};
 
-const static u32 RIGHT_FACE_INDEXES[6] = {
-    0, 1, 3, // 20, 21, 23, // top-left
-    3, 1, 2, // 23, 21, 22  // bottom-right
+// NOTE(gr3yknigh1): Indexed by `FaceNormal`. [2025/11/23]
+const static Face *const FACES[FACE_PER_BLOCK] = {
+    &FRONT_FACE, &BACK_FACE, &TOP_FACE, &BOTTOM_FACE, &LEFT_FACE, &RIGHT_FACE,
 };
 
 static Chunk ChunkMake(Scratch *scratch, f32 x, f32 y, f32 z);
 static void ChunkGenerateBlocks(World *world, Chunk *chunk);
 static void ChunkGenerateGeometry(World *world, Chunk *chunk, Atlas *atlas);
+static void
+ChunkGenerateBlockGeometry(World *world, Chunk *chunk, Atlas *atlas);
+static void
+ChunkGenerateGreedyGeometry(World *world, Chunk *chunk, Atlas *atlas);
+static void
+ChunkGenerateBinaryGeometry(World *world, Chunk *chunk, Atlas *atlas);
+static void
+ChunkMakeBuffers(Chunk *chunk, const GLVertexBufferLayout *layout);
+static void ChunkDestroyBuffers(Chunk *chunk);
+static void ChunkRecordUpload(
+    RenderCommandBuffer *buffer, Chunk *chunk, ChunkRenderPath renderPath);
 
-static void MoveFaces(Face *faces, u32 faceCount, f32 x, f32 y, f32 z);
+static void MoveFaces(Face *faces, u32 faceCount, u8 x, u8 y, u8 z);
 static void CameraHandleInput(Camera *camera, f32 deltaTime);
 static BlockType GenerateNextBlock(f32 x, f32 y, f32 z);
 
 static void AssignTextures(
     Face *faces, u32 faceCount, Atlas *atlas, BlockType blockType);
 
-static bool IsPointInWorld(f32 x, f32 y, f32 z);
+static WorldCursor WorldCursorMake(World *world);
+static BlockType WorldGetBlock(WorldCursor *cursor, i32 x, i32 y, i32 z);
+static bool
+WorldSetBlock(WorldCursor *cursor, i32 x, i32 y, i32 z, BlockType type);
+static void WorldGetBlocks(
+    World *world, Vector3I32 min, Vector3I32 size, BlockType *types);
+static void WorldSetBlocks(
+    World *world, Vector3I32 min, Vector3I32 size, const BlockType *types,
+    bool doMarkDirty);
 
 static const u8 *gSDLKeyState = NULL;
 
-static void WorldReset(Scratch *scratch, World *world, Atlas *atlas);
+static void WorldReset(Scratch *scratch, World *world);
+
+static void StreamedTextureEvict(
+    GLRenderObjectType type, u32 handle, void *parameter);
+
+/*
+ * @breaf Stress scene which draws a lot of `GLGetCubeMesh` cubes. Used for
+ * comparing instanced rendering against draw call per cube.
+ */
+enum class CubeStressMode : i32 {
+    Individual,
+    Instanced,
+};
+
+typedef struct {
+    bool enabled;
+    CubeStressMode mode;
+    i32 count;
+
+    Mesh *mesh;
+    Vector3F32 *offsets;
+    GLInstanceBuffer instanceBuffer;
+    u32 uploadedCount;
+} CubeStress;
+
+static void CubeStressUpdateInstances(CubeStress *stress);
+
+#define RECORD_STATS_AVERAGE_FRAMES EXPAND(60)
+#define RECORD_BENCHMARK_FRAMES EXPAND(120)
+
+/*
+ * @breaf Main thread time of parallel command recording. Benchmark measures
+ * it for every worker count from 1 to `maxWorkerCount`.
+ */
+typedef struct {
+    i32 workerCount;
+    u32 maxWorkerCount;
+
+    f32 recordMilliseconds; // Average of last `RECORD_STATS_AVERAGE_FRAMES`.
+    f32 accumulatedMilliseconds;
+    u32 accumulatedFrames;
+
+    bool isBenchmarkRunning;
+    i32 workerCountBeforeBenchmark;
+    f32 benchmarkResults[RENDER_RECORD_MAX_WORKERS]; // Per worker count.
+    u32 benchmarkResultsCount;
+} RecordStats;
+
+static void RecordStatsStartBenchmark(RecordStats *stats);
+static void RecordStatsUpdate(RecordStats *stats, f32 milliseconds);
+
+typedef struct {
+    f32 meshMilliseconds; // Remeshing of the whole world, summed over workers.
+    u32 faceCount;
+    usize geometryBytes;
+    f32 frameMilliseconds; // Record, submit and `glFinish` of chunk frame.
+} ChunkRenderPathResult;
+
+/*
+ * @breaf Compares chunk render paths. Benchmark switches world to every path
+ * in turn, takes meshing time and geometry size from the frame, which
+ * remeshed the world, and averages frame time over next
+ * `RECORD_BENCHMARK_FRAMES` frames.
+ */
+typedef struct {
+    f32 meshMilliseconds; // Of last frame, which remeshed any chunk.
+
+    bool isBenchmarkRunning;
+    ChunkRenderPath pathBeforeBenchmark;
+    u32 benchmarkFrames;
+    f32 accumulatedMilliseconds;
+    ChunkRenderPathResult
+        benchmarkResults[static_cast<i32>(ChunkRenderPath::Count)];
+    bool hasBenchmarkResults;
+} ChunkRenderPathStats;
+
+#define MESH_BENCHMARK_ITERATIONS EXPAND(16)
+
+/*
+ * @breaf Meshing microbenchmark. Every chunk is meshed
+ * `MESH_BENCHMARK_ITERATIONS` times with each path on main thread, nothing
+ * is uploaded or drawn.
+ */
+typedef struct {
+    f32 chunkMicroseconds[static_cast<i32>(ChunkRenderPath::Count)];
+    u32 faceCounts[static_cast<i32>(ChunkRenderPath::Count)]; // Whole world.
+    bool hasResults;
+} ChunkMeshBenchmark;
+
+static void ChunkMeshBenchmarkRun(
+    ChunkMeshBenchmark *benchmark, World *world, Atlas *atlas);
+
+static void WorldSetRenderPath(World *world, ChunkRenderPath renderPath);
+
+#define WORLD_BUILD_BENCHMARK_RUNS EXPAND(5)
+
+/*
+ * @breaf Parameter of both build jobs of chunk.
+ */
+typedef struct {
+    World *world;
+    Chunk *chunk;
+    Atlas *atlas;
+} ChunkJob;
+
+/*
+ * @breaf Builds world on job system. Every chunk gets generation job and
+ * meshing job, which waits for generation of the chunk and it's six
+ * neighbours. Geometry is uploaded by main thread after build is finished.
+ */
+typedef struct {
+    JobSystem *jobs;
+    JobSystem *inlineJobs; // Without workers, runs jobs on calling thread.
+    ChunkJob chunkJobs[WORLD_CHUNK_COUNT];
+
+    u64 beginCounter;
+    f32 milliseconds; // Of last build, till main thread has seen it finish.
+
+    // NOTE(gr3yknigh1): Averages of `WORLD_BUILD_BENCHMARK_RUNS` blocking
+    // builds, reset of world before each isn't timed. [2025/11/23]
+    f32 singleThreadMilliseconds;
+    f32 multiThreadMilliseconds;
+    bool hasBenchmarkResults;
+} WorldBuilder;
+
+static WorldBuilder *WorldBuilderMake(Scratch *scratch);
+static void WorldBuilderDestroy(WorldBuilder *builder, World *world);
+static void WorldBuildStart(WorldBuilder *builder, World *world, Atlas *atlas);
+static bool WorldBuildUpdate(WorldBuilder *builder, World *world);
+static void WorldBuildBenchmark(
+    WorldBuilder *builder, Scratch *scratch, World *world, Atlas *atlas);
+static int WorldBuildBenchmarkHeadless(Scratch *scratch);
+
+static void
+ChunkRenderPathStatsStartBenchmark(ChunkRenderPathStats *stats, World *world);
+static void ChunkRenderPathStatsUpdate(
+    ChunkRenderPathStats *stats, World *world, f32 meshMilliseconds,
+    u32 faceCount, usize geometryBytes, f32 frameMilliseconds);
+
+/*
+ * @breaf Everything workers need to record one frame. Each worker takes
+ * contiguous share of chunks and cubes, regenerates dirty chunks and records
+ * their uploads and draws.
+ */
+typedef struct {
+    World *world;
+    Atlas *atlas;
+    GLTexture blockTextures; // Layer per atlas tile.
+    const Camera *camera;
+    const CubeStress *cubeStress;
+    GLShaderProgramID shader;
+    GLShaderProgramID chunkShader;
+    GLShaderProgramID chunkPullingShader;
+    GLShaderProgramID cubeInstancedShader;
+    GLDrawBlock identityDrawBlock;
+    const GLElementBuffer *chunkElementBuffer; // Shared by all chunks.
+    GLVertexArray emptyVertexArray; // Vertex pulling reads no attributes.
+    u64 performanceFrequency;
+
+    u32 faceCounts[RENDER_RECORD_MAX_WORKERS];
+    usize geometryBytes[RENDER_RECORD_MAX_WORKERS];
+    f32 meshMilliseconds[RENDER_RECORD_MAX_WORKERS];
+} FrameRecordContext;
+
+static void FrameRecordProc(
+    RenderCommandBuffer *buffer, u32 workerIndex, u32 workerCount,
+    void *parameter);
 
 int
 main(int argc, char *args[])
 {
-    UNUSED(argc);
-    UNUSED(args);
+    //
+    // NOTE(gr3yknigh1): Options:
+    //     --benchmark-world-build  Build world on single thread and on job
+    //                              workers without window, print timings
+    //                              and exit.
+    // [2025/11/23]
+    //
+    bool doWorldBuildBenchmark = false;
+
+    for (int argIndex = 1; argIndex < argc; ++argIndex) {
+        if (std::strcmp(args[argIndex], "--benchmark-world-build") == 0) {
+            doWorldBuildBenchmark = true;
+        }
+    }
 
     Scratch runtimeScratch = ScratchMake(GIGABYTES(1));
 
+    if (doWorldBuildBenchmark) {
+        int exitCode = WorldBuildBenchmarkHeadless(&runtimeScratch);
+        ScratchDestroy(&runtimeScratch);
+        return exitCode;
+    }
+
     SDL_version v = INIT_EMPTY_STRUCT(SDL_version);
     SDL_GetVersion(&v);
     SDL_LogInfo(
@@ -225,6 +542,9 @@ main(int argc, char *args[])
     SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
     SDL_GL_SetAttribute(
         SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+#if defined(GFS_OPENGL_DEBUG_OUTPUT)
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, SDL_GL_CONTEXT_DEBUG_FLAG);
+#endif
 
     SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
     SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 24);
@@ -240,6 +560,15 @@ main(int argc, char *args[])
     ASSERT_NONNULL(context);
     ASSERT_NONZERO(gladLoadGLLoader((GLADloadproc)SDL_GL_GetProcAddress));
 
+#if defined(GFS_OPENGL_DEBUG_OUTPUT)
+    if (!GLDebugOutputEnable(
+            GL_DEBUG_OUTPUT_SYNCHRONOUS_FLAG |
+            GL_DEBUG_OUTPUT_BREAK_ON_ERROR_FLAG)) {
+        SDL_LogWarn(
+            SDL_LOG_CATEGORY_APPLICATION, "OpenGL debug output is missing\n");
+    }
+#endif
+
     ImGui::CreateContext();
     ImGui::StyleColorsDark();
 
@@ -260,49 +589,121 @@ main(int argc, char *args[])
     SDL_LogInfo(
         SDL_LOG_CATEGORY_APPLICATION, "Language: %s\n", glShaderLanguage);
 
-    GL_CALL(glEnable(GL_BLEND));
-    GL_CALL(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
-    GL_CALL(glEnable(GL_DEPTH_TEST));
+    GLSetCapability(GL_BLEND, true);
+    GLBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    GLSetCapability(GL_DEPTH_TEST, true);
 
-    GL_CALL(glEnable(GL_CULL_FACE));
-    GL_CALL(glCullFace(GL_FRONT));
+    GLSetCapability(GL_CULL_FACE, true);
+    GLCullFace(GL_FRONT);
     GL_CALL(glFrontFace(GL_CCW));
 
-    GLShaderProgramLinkData shaderLinkData =
-        INIT_EMPTY_STRUCT(GLShaderProgramLinkData);
-    shaderLinkData.vertexShader = GLCompileShaderFromFile(
-        &runtimeScratch, "assets/basic.frag.glsl", GL_SHADER_TYPE_FRAG);
-    shaderLinkData.fragmentShader = GLCompileShaderFromFile(
-        &runtimeScratch, "assets/basic.vert.glsl", GL_SHADER_TYPE_VERT);
-    GLShaderProgramID shader =
-        GLLinkShaderProgram(&runtimeScratch, &shaderLinkData);
+    GLProgramCache programCache = GLProgramCacheMake("cache");
+
+    cstring8 basicShaderKeywords[] = {"INSTANCED", "VERTEX_OFFSET"};
+    GLShaderPermutations basicShaders = GLShaderPermutationsMake(
+        &programCache, "assets/basic.vert.glsl", "assets/basic.frag.glsl",
+        basicShaderKeywords, STATIC_ARRAY_LENGTH(basicShaderKeywords));
+
+    GLShaderProgramID shader = GLShaderPermutationsGet(
+        &runtimeScratch, &basicShaders,
+        GLShaderPermutationsGetKeywordMask(&basicShaders, "VERTEX_OFFSET"));
     ASSERT_NONZERO(shader);
 
+    GLShaderProgramID cubeInstancedShader = GLShaderPermutationsGet(
+        &runtimeScratch, &basicShaders,
+        GLShaderPermutationsGetKeywordMask(&basicShaders, "INSTANCED"));
+    ASSERT_NONZERO(cubeInstancedShader);
+
+    GLShaderProgramID chunkShader = GLLoadShaderProgramFromFiles(
+        &runtimeScratch, &programCache, "assets/chunk.vert.glsl",
+        "assets/chunk.frag.glsl");
+    ASSERT_NONZERO(chunkShader);
+
+    GLShaderProgramID chunkPullingShader = GLLoadShaderProgramFromFiles(
+        &runtimeScratch, &programCache, "assets/chunk_pulling.vert.glsl",
+        "assets/chunk.frag.glsl");
+    ASSERT_NONZERO(chunkPullingShader);
+
+    SDL_LogInfo(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "Program cache: %u hits (%.3f ms), %u misses (%.3f ms), %.3f ms "
+        "saved\n",
+        programCache.hitCount, programCache.loadMilliseconds,
+        programCache.missCount, programCache.compileMilliseconds,
+        programCache.savedMilliseconds);
+
     Atlas atlas = AtlasFromFile(
         &runtimeScratch, "assets/atlas.bmp", 16, 16, COLOR_LAYOUT_BGRA);
 
-    GLUniformLocation uniformVertexModifierLocation =
-        GLShaderFindUniformLocation(shader, "u_VertexModifier");
+    // NOTE(gr3yknigh1): Chunks sample tiles as layers, so tiles are mipmapped
+    // without bleeding into neighbours. [2025/11/23]
+    GLTexture blockTextures = AtlasToTextureArray(&atlas, COLOR_LAYOUT_BGRA);
+
+    GLTextureStreamer *textureStreamer =
+        GLTextureStreamerMake(&runtimeScratch, TEXTURE_STREAMER_FRAME_BUDGET);
+    ASSERT_NONNULL(textureStreamer);
+
+    cstring8 streamedTexturePaths[] = {
+        "assets/kitty.bmp", "assets/dirt.bmp", "assets/atlas.bmp"};
+    GLTextureUpload *streamedUploads[STATIC_ARRAY_LENGTH(
+        streamedTexturePaths)] = {};
+    GLTexture streamedTextures[STATIC_ARRAY_LENGTH(streamedTexturePaths)] = {};
+    u64 streamBeginCounter = 0;
+    f32 streamMilliseconds = 0;
+
+    GLFrameCapture *screenshotCapture = GLFrameCaptureMake(
+        &runtimeScratch, GL_FRAME_CAPTURE_FORMAT_BMP, SCREENSHOT_PATH_PREFIX);
+    ASSERT_NONNULL(screenshotCapture);
+    bool isScreenshotRequested = false;
+
+    // NOTE(gr3yknigh1): Made on first recording and kept till exit, so all
+    // recordings of the run go to one file. [2025/11/23]
+    GLFrameCapture *videoCapture = NULL;
+    bool isVideoRecording = false;
+
+    Profiler profiler = ProfilerMake(&runtimeScratch, PROFILER_EVENT_CAPACITY);
+    GLGpuProfiler gpuProfiler = GLGpuProfilerMake(&profiler);
+    u32 captureFramesLeft = 0;
+    bool isCaptureWritten = false;
+
+    GLShaderSetUniformI32(
+        chunkShader, GLShaderFindUniformLocation(chunkShader, "u_Texture"), 0);
+
+    GLShaderSetUniformI32(
+        chunkPullingShader,
+        GLShaderFindUniformLocation(chunkPullingShader, "u_Texture"), 0);
+    GLShaderSetUniformI32(
+        chunkPullingShader,
+        GLShaderFindUniformLocation(chunkPullingShader, "u_FaceRecords"),
+        RENDER_DATA_TEXTURE_UNIT);
+
     GLUniformLocation uniformVertexOffsetLocation =
         GLShaderFindUniformLocation(shader, "u_VertexOffset");
     GLUniformLocation uniformTextureLocation =
         GLShaderFindUniformLocation(shader, "u_Texture");
 
-    GLUniformLocation uniformModelLocation =
-        GLShaderFindUniformLocation(shader, "u_Model");
-    GLUniformLocation uniformViewLocation =
-        GLShaderFindUniformLocation(shader, "u_View");
-    GLUniformLocation uniformProjectionLocation =
-        GLShaderFindUniformLocation(shader, "u_Projection");
-
-    GLShaderSetUniformF32(shader, uniformVertexModifierLocation, 1.0f);
     GLShaderSetUniformV3F32(
         shader, uniformVertexOffsetLocation, 0.3f, 0.3f, 0.3f);
     GLShaderSetUniformI32(shader, uniformTextureLocation, 0);
 
+    // NOTE(gr3yknigh1): Matrices are shared between programs through
+    // `Camera` and `Draw` uniform blocks (see `GLLinkShaderProgram`), so
+    // nothing has to be re-uploaded after program switch. [2025/11/16]
+    GLUniformBuffer cameraBuffer =
+        GLUniformBufferMake(nullptr, sizeof(GLCameraBlock));
+    GLUniformRing drawRing = GLUniformRingMake(DRAW_UNIFORM_RING_CAPACITY);
+
     i32 windowWidth = 0, windowHeight = 0;
     SDL_GetWindowSize(window, &windowWidth, &windowHeight);
 
+    // NOTE(gr3yknigh1): Scene is rendered into part of window sized target,
+    // which is stretched over window, so target is remade only on
+    // resize. [2025/11/23]
+    GLRenderTarget sceneTarget = GLRenderTargetMake(windowWidth, windowHeight);
+    DynamicResolution dynamicResolution = DynamicResolutionMake(
+        DynamicResolutionSettingsMake(DYNAMIC_RESOLUTION_BUDGET_MILLISECONDS));
+    bool isDynamicResolutionEnabled = true;
+
     // Enable VSync
     SDL_GL_SetSwapInterval(-1);
 
@@ -319,31 +720,90 @@ main(int argc, char *args[])
 
     bool isFirstMouseMotion = true;
 
-    GL_CALL(glUseProgram(shader));
-    GL_CALL(
-        glActiveTexture(GL_TEXTURE0)); // TODO(gr3yknigh1): Investigate in multi
-                                       // texture support. [2024/09/22]
-    GL_CALL(glBindTexture(GL_TEXTURE_2D, atlas.texture));
+    GLUseProgram(shader);
+    // TODO(gr3yknigh1): Investigate in multi texture support. [2024/09/22]
+    GLBindTexture(0, GL_TEXTURE_2D, atlas.texture);
+
+    WorldBuilder *worldBuilder = WorldBuilderMake(&runtimeScratch);
+    ASSERT_NONNULL(worldBuilder);
 
     World world = INIT_EMPTY_STRUCT(World);
-    WorldReset(&runtimeScratch, &world, &atlas);
+    WorldReset(&runtimeScratch, &world);
+    WorldBuildStart(worldBuilder, &world, &atlas);
 
-    GLVertexArray chunkVertexArray = GLVertexArrayMake();
-    GLVertexBuffer chunkVertexBuffer = GLVertexBufferMake(
-        NULL, VERTEXES_PER_FACE * FACE_PER_BLOCK * CHUNK_MAX_BLOCK_COUNT);
+    // NOTE(gr3yknigh1): Layout of `ChunkVertex`. [2025/11/23]
     GLVertexBufferLayout chunkVertexBufferLayout =
         GLVertexBufferLayoutMake(&runtimeScratch); // XXX
-    GLVertexBufferLayoutPushAttributeF32(&chunkVertexBufferLayout, 3);
-    GLVertexBufferLayoutPushAttributeF32(&chunkVertexBufferLayout, 3);
-    GLVertexBufferLayoutPushAttributeF32(&chunkVertexBufferLayout, 2);
-    GLVertexArrayAddBuffer(
-        chunkVertexArray, &chunkVertexBuffer, &chunkVertexBufferLayout);
-    GLElementBuffer chunkElementBuffer = GLElementBufferMake(
-        NULL, INDEXES_PER_FACE * FACE_PER_BLOCK * CHUNK_MAX_BLOCK_COUNT);
+    GLVertexBufferLayoutPushAttributeU8(
+        &chunkVertexBufferLayout, 4, GL_ATTRIBUTE_MODE_INTEGER);
+    GLVertexBufferLayoutPushAttributeU16(
+        &chunkVertexBufferLayout, 1, GL_ATTRIBUTE_MODE_INTEGER);
+    GLVertexBufferLayoutPushAttributeU8(
+        &chunkVertexBufferLayout, 2, GL_ATTRIBUTE_MODE_INTEGER);
+    ASSERT_EQ(chunkVertexBufferLayout.stride, sizeof(ChunkVertex));
+
+    GLElementBuffer chunkElementBuffer =
+        GLElementBufferMakeQuadsU16(&runtimeScratch, CHUNK_MAX_FACE_COUNT);
+
+    // NOTE(gr3yknigh1): Core profile can't draw without bound vertex array,
+    // even if shader has no inputs. [2025/11/23]
+    GLVertexArray emptyVertexArray = GLVertexArrayMake();
+
+    ChunkRenderPathStats renderPathStats =
+        INIT_EMPTY_STRUCT(ChunkRenderPathStats);
+    ChunkMeshBenchmark meshBenchmark = INIT_EMPTY_STRUCT(ChunkMeshBenchmark);
+
+    RenderQueue renderQueue = RenderQueueMakeEx(
+        &runtimeScratch, RENDER_QUEUE_CAPACITY, RENDER_QUEUE_UPLOAD_CAPACITY);
+
+    RecordStats recordStats = INIT_EMPTY_STRUCT(RecordStats);
+    recordStats.maxWorkerCount = GetProcessorCount();
+    if (recordStats.maxWorkerCount > RENDER_RECORD_MAX_WORKERS) {
+        recordStats.maxWorkerCount = RENDER_RECORD_MAX_WORKERS;
+    }
+    recordStats.workerCount = static_cast<i32>(recordStats.maxWorkerCount);
+
+    // NOTE(gr3yknigh1): Main thread records first share itself, rest is
+    // recorded by workers, which live as long as the game. [2025/11/23]
+    JobSystem *recordJobs = JobSystemMake(
+        &runtimeScratch, recordStats.maxWorkerCount - 1,
+        RENDER_RECORD_MAX_WORKERS, 0);
+    ASSERT_NONNULL(recordJobs);
+
+    // NOTE(gr3yknigh1): Every buffer records into it's own arena, which is
+    // touched by single thread per frame. Any worker might get all commands
+    // of the frame, when it is the only one. [2025/11/16]
+    Scratch recordArenas[RENDER_RECORD_MAX_WORKERS];
+    RenderCommandBuffer recordBuffers[RENDER_RECORD_MAX_WORKERS];
+    for (u32 workerIndex = 0; workerIndex < recordStats.maxWorkerCount;
+         ++workerIndex) {
+        recordArenas[workerIndex] = ScratchMake(
+            (sizeof(RenderSortKey) + sizeof(RenderCommand)) *
+                RENDER_QUEUE_CAPACITY +
+            sizeof(RenderUpload) * RENDER_QUEUE_UPLOAD_CAPACITY);
+        recordBuffers[workerIndex] = RenderCommandBufferMake(
+            recordArenas + workerIndex, RENDER_QUEUE_CAPACITY,
+            RENDER_QUEUE_UPLOAD_CAPACITY);
+    }
+    f32 renderQueueSubmitMilliseconds = 0;
 
     bool showFrame = false;
     bool cullEnabled = true;
 
+    CubeStress cubeStress = INIT_EMPTY_STRUCT(CubeStress);
+    cubeStress.mode = CubeStressMode::Instanced;
+    cubeStress.count = 10000;
+    cubeStress.mesh = GLGetCubeMesh(&runtimeScratch, GL_COUNTER_CLOCK_WISE);
+    cubeStress.offsets = static_cast<Vector3F32 *>(ScratchAllocZero(
+        &runtimeScratch, sizeof(Vector3F32) * CUBE_STRESS_MAX_COUNT));
+    cubeStress.instanceBuffer = GLInstanceBufferMake(NULL, 0, 0);
+
+    GLVertexBufferLayout cubeInstanceLayout =
+        GLVertexBufferLayoutMakeEx(&runtimeScratch, 1);
+    GLVertexBufferLayoutPushAttributeF32(&cubeInstanceLayout, 3);
+    GLMeshAttachInstanceBuffer(
+        cubeStress.mesh, &cubeStress.instanceBuffer, &cubeInstanceLayout);
+
     while (!GameStateShouldStop()) {
         previousPerfCounter = currentPerfCounter;
         currentPerfCounter = SDL_GetPerformanceCounter();
@@ -385,17 +845,19 @@ main(int argc, char *args[])
             GameStateStop();
         }
 
-        if (gSDLKeyState[SDL_SCANCODE_R]) {
-            WorldReset(&runtimeScratch, &world, &atlas);
+        if (gSDLKeyState[SDL_SCANCODE_R] && !world.isBuilding &&
+            !renderPathStats.isBenchmarkRunning) {
+            WorldReset(&runtimeScratch, &world);
+            WorldBuildStart(worldBuilder, &world, &atlas);
         }
 
         if (gSDLKeyState[SDL_SCANCODE_F]) {
             showFrame = !showFrame;
 
             if (showFrame) {
-                glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+                GLPolygonMode(GL_LINE);
             } else {
-                glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+                GLPolygonMode(GL_FILL);
             }
         }
 
@@ -411,42 +873,18 @@ main(int argc, char *args[])
         CameraRotate(&camera, mouseXOffset, mouseYOffset);
         CameraHandleInput(&camera, deltaTime);
 
-        if (gSDLKeyState[SDL_SCANCODE_SPACE]) {
+        if (gSDLKeyState[SDL_SCANCODE_SPACE] && !world.isBuilding) {
             // Block selectiing picking...
             Vector3F32 p = INIT_EMPTY_STRUCT(Vector3F32);
             p.x = camera.position.x + (camera.front.x);
             p.y = camera.position.y + (camera.front.y);
             p.z = camera.position.z + (camera.front.z);
 
-            if (IsPointInWorld(p.x, p.y, p.z)) {
-                Vector3F32 chunkCoords;
-                chunkCoords.x = p.x / CHUNK_SIDE_SIZE;
-                chunkCoords.y = p.y / CHUNK_SIDE_SIZE;
-                chunkCoords.z = p.z / CHUNK_SIDE_SIZE;
-
-                i32 chunkIndex = GetOffsetFromCoords3DGridArrayRM(
-                    WORLD_CHUNK_X_COUNT, WORLD_CHUNK_Y_COUNT,
-                    WORLD_CHUNK_Z_COUNT, chunkCoords.x, chunkCoords.y,
-                    chunkCoords.z);
-
-                Chunk *chunk = world.chunks.data + chunkIndex;
-
-                Vector3F32 relPosition;
-                relPosition.x = p.x; // - CHUNK_SIDE_SIZE * chunkCoords.x;
-                relPosition.y = p.y; // - CHUNK_SIDE_SIZE * chunkCoords.y;
-                relPosition.z = p.z; // - CHUNK_SIDE_SIZE * chunkCoords.z;
-
-                i32 blockIndex = GetOffsetFromCoords3DGridArrayRM(
-                    CHUNK_SIDE_SIZE, CHUNK_SIDE_SIZE, CHUNK_SIDE_SIZE,
-                    relPosition.x, relPosition.y, relPosition.z);
-
-                Block *block = chunk->blocks + blockIndex;
-
-                if (block->type != BlockType::Nothing) {
-                    block->type = BlockType::Nothing;
-                    chunk->state = ChunkState::Dirty;
-                }
-            }
+            WorldCursor cursor = WorldCursorMake(&world);
+            WorldSetBlock(
+                &cursor, static_cast<i32>(glm::floor(p.x)),
+                static_cast<i32>(glm::floor(p.y)),
+                static_cast<i32>(glm::floor(p.z)), BlockType::Nothing);
         }
 
         SDL_GetWindowSize(window, &windowWidth, &windowHeight);
@@ -482,45 +920,216 @@ main(int argc, char *args[])
         }
 #endif
 
+        // NOTE(gr3yknigh1): Begins after FPS limiter, because it's `continue`
+        // would skip end of the scope. [2025/11/23]
+        u32 frameScope = ProfilerBeginScope(&profiler, "Frame");
+
         // Render
 
-        GL_CALL(glViewport(0, 0, windowWidth, windowHeight));
+        GLGpuProfilerBeginFrame(&gpuProfiler);
+        u32 frameGpuScope = GLGpuProfilerBeginScope(&gpuProfiler, "Frame");
+
+        if (sceneTarget.width != static_cast<u32>(windowWidth) ||
+            sceneTarget.height != static_cast<u32>(windowHeight)) {
+            GLRenderTargetDestroy(&sceneTarget);
+            sceneTarget = GLRenderTargetMake(windowWidth, windowHeight);
+        }
+
+        u32 sceneWidth = windowWidth, sceneHeight = windowHeight;
+        if (isDynamicResolutionEnabled) {
+            sceneWidth =
+                DynamicResolutionScaleSize(&dynamicResolution, windowWidth);
+            sceneHeight =
+                DynamicResolutionScaleSize(&dynamicResolution, windowHeight);
+        }
+
+        GLRenderTargetBind(&sceneTarget, sceneWidth, sceneHeight);
         GLClear(0, 0, 0, 1); // TODO: Map from 0..255 to 0..1
 
         glm::mat4 view = CameraGetViewMatix(&camera);
         glm::mat4 projection =
             CameraGetProjectionMatix(&camera, windowWidth, windowHeight);
-        glm::mat4 model = glm::identity<glm::mat4>();
+        glm::mat4 viewProjection = projection * view;
 
-        GLShaderSetUniformM4F32(
-            shader, uniformViewLocation, glm::value_ptr(view));
-        GLShaderSetUniformM4F32(
-            shader, uniformProjectionLocation, glm::value_ptr(projection));
-        GLShaderSetUniformM4F32(
-            shader, uniformModelLocation, glm::value_ptr(model));
+        GLCameraBlock cameraBlock = INIT_EMPTY_STRUCT(GLCameraBlock);
+        MemoryCopy(
+            cameraBlock.view, glm::value_ptr(view), sizeof(cameraBlock.view));
+        MemoryCopy(
+            cameraBlock.projection, glm::value_ptr(projection),
+            sizeof(cameraBlock.projection));
+        MemoryCopy(
+            cameraBlock.viewProjection, glm::value_ptr(viewProjection),
+            sizeof(cameraBlock.viewProjection));
 
-        u32 faceCount = 0;
-        u32 indexesCount = 0;
-        u32 drawCalls = 0;
+        GLUniformBufferSendData(
+            &cameraBuffer, &cameraBlock, sizeof(cameraBlock));
+        GLUniformBufferBind(&cameraBuffer, GL_UNIFORM_BLOCK_BINDING_CAMERA);
+
+        GLDrawBlock identityDrawBlock = INIT_EMPTY_STRUCT(GLDrawBlock);
+        MemoryCopy(
+            identityDrawBlock.model,
+            glm::value_ptr(glm::identity<glm::mat4>()),
+            sizeof(identityDrawBlock.model));
+
+        if (cubeStress.enabled &&
+            cubeStress.uploadedCount != static_cast<u32>(cubeStress.count)) {
+            CubeStressUpdateInstances(&cubeStress);
+        }
+
+        WorldBuildUpdate(worldBuilder, &world);
 
+        // NOTE(gr3yknigh1): GL objects can be created only on this thread,
+        // workers only record uploads into them. [2025/11/16]
         for (u32 chunkIndex = 0; chunkIndex < WORLD_CHUNK_COUNT; ++chunkIndex) {
             Chunk *chunk = world.chunks.data + chunkIndex;
 
-            if (chunk->state == ChunkState::Dirty) {
-                ChunkGenerateGeometry(&world, chunk, &atlas);
+            if (chunk->vertexArray == 0) {
+                ChunkMakeBuffers(chunk, &chunkVertexBufferLayout);
+            }
+        }
+
+        FrameRecordContext recordContext =
+            INIT_EMPTY_STRUCT(FrameRecordContext);
+        recordContext.world = &world;
+        recordContext.atlas = &atlas;
+        recordContext.blockTextures = blockTextures;
+        recordContext.camera = &camera;
+        recordContext.cubeStress = &cubeStress;
+        recordContext.shader = shader;
+        recordContext.chunkShader = chunkShader;
+        recordContext.chunkPullingShader = chunkPullingShader;
+        recordContext.cubeInstancedShader = cubeInstancedShader;
+        recordContext.identityDrawBlock = identityDrawBlock;
+        recordContext.chunkElementBuffer = &chunkElementBuffer;
+        recordContext.emptyVertexArray = emptyVertexArray;
+        recordContext.performanceFrequency = SDL_GetPerformanceFrequency();
+
+        u32 recordWorkerCount = static_cast<u32>(recordStats.workerCount);
+
+        u32 recordScope = ProfilerBeginScope(&profiler, "Record");
+        u64 recordBeginCounter = SDL_GetPerformanceCounter();
+        RenderRecordParallel(
+            recordJobs, recordBuffers, recordWorkerCount, FrameRecordProc,
+            &recordContext);
+        RenderQueueMerge(&renderQueue, recordBuffers, recordWorkerCount);
+        u64 recordEndCounter = SDL_GetPerformanceCounter();
+        ProfilerEndScope(&profiler, recordScope);
+
+        RecordStatsUpdate(
+            &recordStats,
+            static_cast<f32>(recordEndCounter - recordBeginCounter) * 1000.0f /
+                static_cast<f32>(SDL_GetPerformanceFrequency()));
+
+        u32 faceCount = 0;
+        u32 drawCalls = 0;
+        usize geometryBytes = 0;
+        f32 meshMilliseconds = 0;
+
+        for (u32 workerIndex = 0; workerIndex < recordWorkerCount;
+             ++workerIndex) {
+            faceCount += recordContext.faceCounts[workerIndex];
+            drawCalls += recordBuffers[workerIndex].count;
+            geometryBytes += recordContext.geometryBytes[workerIndex];
+            meshMilliseconds += recordContext.meshMilliseconds[workerIndex];
+        }
+
+        u32 submitScope = ProfilerBeginScope(&profiler, "Render queue");
+        u32 submitGpuScope =
+            GLGpuProfilerBeginScope(&gpuProfiler, "Render queue");
+        u64 queueSubmitBeginCounter = SDL_GetPerformanceCounter();
+        RenderQueueSubmit(&renderQueue, &drawRing);
+        GLGpuProfilerEndScope(&gpuProfiler, submitGpuScope);
+
+        // NOTE(gr3yknigh1): Otherwise benchmark measures only how fast driver
+        // takes commands, not how fast GPU draws them. [2025/11/23]
+        if (renderPathStats.isBenchmarkRunning) {
+            glFinish();
+        }
+
+        u64 queueSubmitEndCounter = SDL_GetPerformanceCounter();
+        ProfilerEndScope(&profiler, submitScope);
+        renderQueueSubmitMilliseconds =
+            static_cast<f32>(queueSubmitEndCounter - queueSubmitBeginCounter) *
+            1000.0f / static_cast<f32>(SDL_GetPerformanceFrequency());
+
+        ChunkRenderPathStatsUpdate(
+            &renderPathStats, &world, meshMilliseconds, faceCount,
+            geometryBytes,
+            static_cast<f32>(queueSubmitEndCounter - recordBeginCounter) *
+                1000.0f / static_cast<f32>(SDL_GetPerformanceFrequency()));
+
+        GLTextureStreamerUpdate(textureStreamer);
+
+        // NOTE(gr3yknigh1): Streamed textures aren't sampled anywhere yet, so
+        // they are never touched and are first to go, when resource budget is
+        // exceeded. [2025/11/23]
+        u32 streamedPendingCount = 0;
+        u32 streamedDoneCount = 0;
+        for (u32 uploadIndex = 0;
+             uploadIndex < STATIC_ARRAY_LENGTH(streamedUploads);
+             ++uploadIndex) {
+            GLTextureUpload *&upload = streamedUploads[uploadIndex];
+            if (upload == NULL) {
+                continue;
+            }
+
+            if (GLTextureUploadIsReady(upload)) {
+                GLTexture *texture = streamedTextures + uploadIndex;
+                if (*texture != 0) {
+                    GLTextureDestroy(*texture);
+                }
+
+                *texture = upload->texture;
+                GLResourceSetEvictable(
+                    GL_RENDER_OBJECT_TEXTURE, *texture, StreamedTextureEvict,
+                    texture);
+            } else if (upload->state != GL_TEXTURE_UPLOAD_FAILED) {
+                streamedPendingCount += 1;
+                continue;
             }
 
-            GLVertexBufferSendData(
-                &chunkVertexBuffer, reinterpret_cast<f32 *>(chunk->faces.data),
-                chunk->faces.count * sizeof(Face));
-            GLElementBufferSendData(
-                &chunkElementBuffer, chunk->indexes.data, chunk->indexes.count);
-            GLDrawElements(
-                &chunkElementBuffer, &chunkVertexBuffer, chunkVertexArray);
+            GLTextureUploadRelease(upload);
+            upload = NULL;
+            streamedDoneCount += 1;
+        }
+
+        if (streamedDoneCount > 0 && streamedPendingCount == 0) {
+            streamMilliseconds =
+                static_cast<f32>(
+                    SDL_GetPerformanceCounter() - streamBeginCounter) *
+                1000.0f / static_cast<f32>(SDL_GetPerformanceFrequency());
+        }
+
+        u32 upscaleGpuScope = GLGpuProfilerBeginScope(&gpuProfiler, "Upscale");
+        GLRenderTargetBlit(
+            &sceneTarget, sceneWidth, sceneHeight, 0, windowWidth,
+            windowHeight);
+        GLGpuProfilerEndScope(&gpuProfiler, upscaleGpuScope);
+
+        // NOTE(gr3yknigh1): First result is "Frame" scope. It lags behind by
+        // `GL_GPU_PROFILER_LATENCY` frames, which settle frames cover.
+        // [2025/11/23]
+        if (isDynamicResolutionEnabled) {
+            DynamicResolutionUpdate(
+                &dynamicResolution,
+                gpuProfiler.resultCount > 0
+                    ? gpuProfiler.results[0].milliseconds
+                    : 0,
+                deltaTime * 1000.0f);
+        }
 
-            faceCount += chunk->faces.count;
-            indexesCount += chunk->indexes.count;
-            ++drawCalls;
+        // NOTE(gr3yknigh1): Captured before ImGui, so only scene gets into
+        // frames. [2025/11/23]
+        if (isScreenshotRequested) {
+            GLCaptureFrame(screenshotCapture, 0, windowWidth, windowHeight);
+            isScreenshotRequested = false;
+        }
+        if (isVideoRecording) {
+            GLCaptureFrame(videoCapture, 0, windowWidth, windowHeight);
+        }
+        GLFrameCaptureUpdate(screenshotCapture);
+        if (videoCapture != NULL) {
+            GLFrameCaptureUpdate(videoCapture);
         }
 
         ImGui_ImplOpenGL3_NewFrame();
@@ -531,21 +1140,369 @@ main(int argc, char *args[])
         ImGui::Text("FPS: %.05f", 1 / deltaTime);
         ImGui::Text("DeltaTime: %.05f", deltaTime);
         ImGui::Text("Faces count: %u", faceCount);
-        ImGui::Text("Indexes count: %u", indexesCount);
-        ImGui::Text("Draw calls: %u", drawCalls);
+        ImGui::Text("Indexes count: %u", faceCount * INDEXES_PER_FACE);
+        ImGui::Text(
+            "Chunk geometry memory: %.3f MiB",
+            static_cast<f32>(geometryBytes) / MEGABYTES(1));
+        ImGui::Text("Draw calls: %u recorded", drawCalls);
+
+        GLRenderStats renderStats = GLRenderStatsGet();
+        GLRenderStatsResetFrame();
+        GLResourceRegistryUpdate();
+        ImGui::Text(
+            "GL draws: %u, %llu triangles", renderStats.drawCallCount,
+            static_cast<unsigned long long>(renderStats.triangleCount));
+        ImGui::Text(
+            "GL uploads: %.3f KiB buffers (%u allocations), "
+            "%.3f KiB textures (%u)",
+            static_cast<f32>(renderStats.bufferUploadBytes) / KILOBYTES(1),
+            renderStats.bufferAllocationCount,
+            static_cast<f32>(renderStats.textureUploadBytes) / KILOBYTES(1),
+            renderStats.textureUploadCount);
+        ImGui::Text(
+            "GL binds: %u programs, %u vertex arrays, %u textures",
+            renderStats.programBindCount, renderStats.vertexArrayBindCount,
+            renderStats.textureBindCount);
+        ImGui::Text(
+            "GL objects: %u buffers, %u textures, %u vertex arrays, "
+            "%u programs",
+            renderStats.objectCounts[GL_RENDER_OBJECT_BUFFER],
+            renderStats.objectCounts[GL_RENDER_OBJECT_TEXTURE],
+            renderStats.objectCounts[GL_RENDER_OBJECT_VERTEX_ARRAY],
+            renderStats.objectCounts[GL_RENDER_OBJECT_PROGRAM]);
+
+        GLStateCacheCounters stateCounters = GLStateCacheGetCounters();
+        GLStateCacheResetCounters();
+        ImGui::Text(
+            "GL state changes: %llu issued, %llu skipped",
+            static_cast<unsigned long long>(stateCounters.issuedCount),
+            static_cast<unsigned long long>(stateCounters.skippedCount));
+        ImGui::Text("Draw uniform ring wraps: %u", drawRing.wrapCount);
+
+        GLDebugOutputCounters debugCounters = GLDebugOutputGetCounters();
+        ImGui::Text(
+            "GL debug messages: %u performance, %u warnings, %u other "
+            "(%u repeated)",
+            debugCounters.performanceCount, debugCounters.warningCount,
+            debugCounters.otherCount, debugCounters.repeatedCount);
+        ImGui::Text(
+            "Program cache: %u hits, %u misses, %.3f ms saved",
+            programCache.hitCount, programCache.missCount,
+            programCache.savedMilliseconds);
+
+        const RenderQueueStats *queueStats = &renderQueue.stats;
+        ImGui::Text(
+            "Render queue: %llu commands, %.3f ms submit",
+            static_cast<unsigned long long>(queueStats->commandCount),
+            renderQueueSubmitMilliseconds);
+        ImGui::Text(
+            "Render queue state changes: %llu unsorted, %llu sorted",
+            static_cast<unsigned long long>(queueStats->stateChangesUnsorted),
+            static_cast<unsigned long long>(queueStats->stateChangesSorted));
+        RenderQueueResetStats(&renderQueue);
+
+        if (ImGui::CollapsingHeader("Parallel recording")) {
+            ImGui::SliderInt(
+                "Workers", &recordStats.workerCount, 1,
+                static_cast<i32>(recordStats.maxWorkerCount));
+            ImGui::Text(
+                "Record CPU time (main thread): %.3f ms",
+                recordStats.recordMilliseconds);
+
+            if (!recordStats.isBenchmarkRunning &&
+                ImGui::Button("Run benchmark")) {
+                RecordStatsStartBenchmark(&recordStats);
+            }
+
+            for (u32 resultIndex = 0;
+                 resultIndex < recordStats.benchmarkResultsCount;
+                 ++resultIndex) {
+                ImGui::Text(
+                    "%2u workers: %.3f ms", resultIndex + 1,
+                    recordStats.benchmarkResults[resultIndex]);
+            }
+        }
+
+        if (ImGui::CollapsingHeader("Chunk render path")) {
+            i32 renderPath = static_cast<i32>(world.renderPath);
+            ImGui::RadioButton(
+                "Vertexes", &renderPath,
+                static_cast<i32>(ChunkRenderPath::Vertexes));
+            ImGui::SameLine();
+            ImGui::RadioButton(
+                "Vertex pulling", &renderPath,
+                static_cast<i32>(ChunkRenderPath::VertexPulling));
+            ImGui::SameLine();
+            ImGui::RadioButton(
+                "Greedy", &renderPath,
+                static_cast<i32>(ChunkRenderPath::Greedy));
+            ImGui::SameLine();
+            ImGui::RadioButton(
+                "Binary", &renderPath,
+                static_cast<i32>(ChunkRenderPath::Binary));
+
+            if (!renderPathStats.isBenchmarkRunning && !world.isBuilding &&
+                renderPath != static_cast<i32>(world.renderPath)) {
+                WorldSetRenderPath(
+                    &world, static_cast<ChunkRenderPath>(renderPath));
+            }
+
+            ImGui::Text(
+                "Bytes per face: %u vertexes, %u vertex pulling",
+                static_cast<u32>(sizeof(Face)),
+                static_cast<u32>(sizeof(FaceRecord)));
+            ImGui::Text(
+                "Last remeshing CPU time: %.3f ms",
+                renderPathStats.meshMilliseconds);
+
+            if (!renderPathStats.isBenchmarkRunning && !world.isBuilding &&
+                ImGui::Button("Run benchmark##ChunkRenderPath")) {
+                ChunkRenderPathStatsStartBenchmark(&renderPathStats, &world);
+            }
+
+            static const char *pathNames[] = {
+                "Vertexes", "Vertex pulling", "Greedy", "Binary"};
+            STATIC_ASSERT(
+                STATIC_ARRAY_LENGTH(pathNames) ==
+                static_cast<i32>(ChunkRenderPath::Count));
+
+            if (renderPathStats.hasBenchmarkResults) {
+                for (i32 pathIndex = 0;
+                     pathIndex < static_cast<i32>(ChunkRenderPath::Count);
+                     ++pathIndex) {
+                    const ChunkRenderPathResult *result =
+                        renderPathStats.benchmarkResults + pathIndex;
+                    ImGui::Text(
+                        "%-14s mesh %.3f ms, %u faces, %.3f MiB, "
+                        "frame %.3f ms",
+                        pathNames[pathIndex], result->meshMilliseconds,
+                        result->faceCount,
+                        static_cast<f32>(result->geometryBytes) /
+                            MEGABYTES(1),
+                        result->frameMilliseconds);
+                }
+            }
+
+            if (!renderPathStats.isBenchmarkRunning && !world.isBuilding &&
+                ImGui::Button("Run meshing microbenchmark")) {
+                ChunkMeshBenchmarkRun(&meshBenchmark, &world, &atlas);
+            }
+
+            if (meshBenchmark.hasResults) {
+                for (i32 pathIndex = 0;
+                     pathIndex < static_cast<i32>(ChunkRenderPath::Count);
+                     ++pathIndex) {
+                    ImGui::Text(
+                        "%-14s %.3f us per chunk, %u faces",
+                        pathNames[pathIndex],
+                        meshBenchmark.chunkMicroseconds[pathIndex],
+                        meshBenchmark.faceCounts[pathIndex]);
+                }
+            }
+        }
         ImGui::Text("Mouse offset: [%.3f %.3f]", mouseXOffset, mouseYOffset);
 
         bool cullEnabledCurrentValue = cullEnabled;
         ImGui::Checkbox("Enable geometry culling", &cullEnabledCurrentValue);
         if (cullEnabledCurrentValue != cullEnabled) {
             cullEnabled = cullEnabledCurrentValue;
-            if (cullEnabled) {
-                GL_CALL(glEnable(GL_CULL_FACE));
+            GLSetCapability(GL_CULL_FACE, cullEnabled);
+        }
+
+        if (ImGui::CollapsingHeader("World build")) {
+            u32 buildWorkerCount = worldBuilder->jobs->workerCount;
+
+            if (world.isBuilding) {
+                ImGui::Text("Building on %u workers...", buildWorkerCount);
             } else {
-                GL_CALL(glDisable(GL_CULL_FACE));
+                ImGui::Text(
+                    "Last build: %.3f ms on %u workers",
+                    worldBuilder->milliseconds, buildWorkerCount);
+            }
+
+            if (!world.isBuilding && !renderPathStats.isBenchmarkRunning &&
+                ImGui::Button("Run benchmark##WorldBuild")) {
+                WorldBuildBenchmark(
+                    worldBuilder, &runtimeScratch, &world, &atlas);
+            }
+
+            if (worldBuilder->hasBenchmarkResults) {
+                ImGui::Text(
+                    "Single thread: %.3f ms",
+                    worldBuilder->singleThreadMilliseconds);
+                ImGui::Text(
+                    "%2u workers:    %.3f ms (%.2fx)", buildWorkerCount,
+                    worldBuilder->multiThreadMilliseconds,
+                    worldBuilder->singleThreadMilliseconds /
+                        worldBuilder->multiThreadMilliseconds);
+            }
+        }
+
+        if (ImGui::CollapsingHeader("Texture streaming")) {
+            const GLTextureStreamerStats *streamerStats =
+                &textureStreamer->stats;
+            ImGui::Text(
+                "Frame budget: %.3f KiB, last frame %.3f KiB",
+                static_cast<f32>(textureStreamer->frameBudgetBytes) /
+                    KILOBYTES(1),
+                static_cast<f32>(streamerStats->frameBytes) / KILOBYTES(1));
+            ImGui::Text(
+                "Uploads: %u pending, %u done (%.3f MiB)",
+                streamerStats->pendingCount, streamerStats->uploadedCount,
+                static_cast<f32>(streamerStats->uploadedBytes) / MEGABYTES(1));
+            ImGui::Text("Last streaming time: %.3f ms", streamMilliseconds);
+
+            if (streamedPendingCount == 0 &&
+                ImGui::Button("Stream test textures")) {
+                streamBeginCounter = SDL_GetPerformanceCounter();
+                for (u32 pathIndex = 0;
+                     pathIndex < STATIC_ARRAY_LENGTH(streamedTexturePaths);
+                     ++pathIndex) {
+                    streamedUploads[pathIndex] = GLTextureStreamerRequest(
+                        textureStreamer, streamedTexturePaths[pathIndex],
+                        COLOR_LAYOUT_BGR);
+                }
+            }
+        }
+
+        if (ImGui::CollapsingHeader("GPU profiler")) {
+            if (!gpuProfiler.isSupported) {
+                ImGui::Text("Timer queries aren't supported");
+            }
+
+            for (u32 resultIndex = 0; resultIndex < gpuProfiler.resultCount;
+                 ++resultIndex) {
+                const GLGpuScopeResult *result =
+                    gpuProfiler.results + resultIndex;
+                ImGui::Text(
+                    "%-14s %.3f ms", result->name, result->milliseconds);
+            }
+            ImGui::Text(
+                "Frames without results: %u", gpuProfiler.droppedFrameCount);
+
+            if (captureFramesLeft > 0) {
+                ImGui::Text("Capturing, %u frames left", captureFramesLeft);
+            } else if (ImGui::Button("Capture frames")) {
+                ProfilerBeginCapture(&profiler);
+                captureFramesLeft = PROFILER_CAPTURE_FRAME_COUNT;
+            }
+
+            if (isCaptureWritten) {
+                ImGui::Text(
+                    "Last capture: %s (%u events, %u dropped)",
+                    PROFILER_CAPTURE_PATH, profiler.eventCount,
+                    profiler.droppedCount);
+            }
+        }
+
+        if (ImGui::CollapsingHeader("Dynamic resolution")) {
+            DynamicResolutionSettings *resolutionSettings =
+                &dynamicResolution.settings;
+
+            ImGui::Checkbox(
+                "Enable##DynamicResolution", &isDynamicResolutionEnabled);
+            ImGui::SliderFloat(
+                "Budget (ms)", &resolutionSettings->budgetMilliseconds, 4.0f,
+                33.0f);
+            ImGui::SliderFloat(
+                "Min scale", &resolutionSettings->minScale, 0.25f,
+                resolutionSettings->maxScale);
+            ImGui::SliderFloat(
+                "Raise threshold", &resolutionSettings->raiseThreshold, 0.5f,
+                resolutionSettings->lowerThreshold);
+
+            ImGui::Text(
+                "Scale: %.2f (%ux%u of %dx%d)", dynamicResolution.scale,
+                sceneWidth, sceneHeight, windowWidth, windowHeight);
+            ImGui::Text(
+                "Average frame: %.3f ms (%u over, %u under budget)",
+                dynamicResolution.averageMilliseconds,
+                dynamicResolution.overBudgetFrameCount,
+                dynamicResolution.underBudgetFrameCount);
+            ImGui::Text("Scale changes: %u", dynamicResolution.changeCount);
+        }
+
+        if (ImGui::CollapsingHeader("Frame capture")) {
+            if (ImGui::Button("Take screenshot")) {
+                isScreenshotRequested = true;
+            }
+            ImGui::Text(
+                "Screenshots: %u written, %u failed (%s_*.bmp)",
+                screenshotCapture->stats.writtenCount,
+                screenshotCapture->stats.failedCount, SCREENSHOT_PATH_PREFIX);
+
+            if (ImGui::Checkbox("Record video", &isVideoRecording) &&
+                isVideoRecording && videoCapture == NULL) {
+                videoCapture = GLFrameCaptureMake(
+                    &runtimeScratch, GL_FRAME_CAPTURE_FORMAT_RAW,
+                    VIDEO_PATH_PREFIX);
+                isVideoRecording = videoCapture != NULL;
+            }
+
+            if (videoCapture != NULL) {
+                const GLFrameCaptureStats *videoStats = &videoCapture->stats;
+                ImGui::Text(
+                    "Video: %u frames (%.3f MiB), %u dropped, %u failed "
+                    "(%s.bgra, %dx%d)",
+                    videoStats->writtenCount,
+                    static_cast<f32>(videoStats->writtenBytes) / MEGABYTES(1),
+                    videoStats->droppedCount, videoStats->failedCount,
+                    VIDEO_PATH_PREFIX, windowWidth, windowHeight);
+            }
+        }
+
+        if (ImGui::CollapsingHeader("GPU resources")) {
+            static const cstring8 categoryNames[GL_RENDER_OBJECT_COUNT] = {
+                "Buffers",       "Textures",      "Vertex arrays",
+                "Programs",      "Shaders",       "Renderbuffers",
+                "Framebuffers",
+            };
+
+            GLResourceStats resourceStats = GLResourceRegistryGetStats();
+            for (u32 type = 0; type < GL_RENDER_OBJECT_COUNT; ++type) {
+                ImGui::Text(
+                    "%s: %u (%.3f MiB)", categoryNames[type],
+                    resourceStats.counts[type],
+                    static_cast<f32>(resourceStats.bytes[type]) /
+                        MEGABYTES(1));
+            }
+            ImGui::Text(
+                "Total: %.3f MiB, %.3f MiB evictable",
+                static_cast<f32>(resourceStats.totalBytes) / MEGABYTES(1),
+                static_cast<f32>(resourceStats.evictableBytes) /
+                    MEGABYTES(1));
+            ImGui::Text(
+                "Deletions: %u pending, %u done, %u evicted, %u untracked",
+                resourceStats.pendingDeletionCount, resourceStats.deletedCount,
+                resourceStats.evictedCount, resourceStats.untrackedCount);
+
+            // NOTE(gr3yknigh1): Zero turns budget off. [2025/11/23]
+            i32 budgetMegabytes =
+                static_cast<i32>(resourceStats.budgetBytes / MEGABYTES(1));
+            if (ImGui::SliderInt(
+                    "Budget (MiB)", &budgetMegabytes, 0,
+                    GPU_RESOURCE_MAX_BUDGET / MEGABYTES(1))) {
+                GLResourceRegistrySetBudget(
+                    static_cast<usize>(budgetMegabytes) * MEGABYTES(1));
             }
         }
 
+        if (ImGui::CollapsingHeader("Cube stress test")) {
+            ImGui::Checkbox("Enable", &cubeStress.enabled);
+
+            i32 mode = static_cast<i32>(cubeStress.mode);
+            ImGui::RadioButton(
+                "Draw call per cube", &mode,
+                static_cast<i32>(CubeStressMode::Individual));
+            ImGui::SameLine();
+            ImGui::RadioButton(
+                "Instanced", &mode, static_cast<i32>(CubeStressMode::Instanced));
+            cubeStress.mode = static_cast<CubeStressMode>(mode);
+
+            ImGui::SliderInt(
+                "Cube count", &cubeStress.count, 1, CUBE_STRESS_MAX_COUNT);
+        }
+
         if (ImGui::CollapsingHeader("Camera menu")) {
             ImGui::InputFloat("Speed", &camera.speed, 0.01f, 500.0f, "%.3f");
             ImGui::InputFloat(
@@ -566,11 +1523,55 @@ main(int argc, char *args[])
         ImGui::End();
         ImGui::Render();
 
+        u32 imguiGpuScope = GLGpuProfilerBeginScope(&gpuProfiler, "ImGui");
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        GLGpuProfilerEndScope(&gpuProfiler, imguiGpuScope);
+
+        // NOTE(gr3yknigh1): ImGui backend changes GL state behind our back.
+        // [2025/11/16]
+        GLStateCacheInvalidate();
+
+        GLGpuProfilerEndScope(&gpuProfiler, frameGpuScope);
+        GLGpuProfilerEndFrame(&gpuProfiler);
+
         SDL_GL_SwapWindow(window);
+        ProfilerEndScope(&profiler, frameScope);
+
+        // NOTE(gr3yknigh1): GPU scopes of last captured frames are resolved
+        // after capture ends, so they are missing from it. [2025/11/23]
+        if (captureFramesLeft > 0 && --captureFramesLeft == 0) {
+            isCaptureWritten = ProfilerEndCapture(
+                &profiler, &runtimeScratch, PROFILER_CAPTURE_PATH);
+            SDL_LogInfo(
+                SDL_LOG_CATEGORY_APPLICATION, "Profiler capture %s: %s\n",
+                isCaptureWritten ? "written" : "failed",
+                PROFILER_CAPTURE_PATH);
+        }
+    }
+
+    GLGpuProfilerDestroy(&gpuProfiler);
+
+    GLTextureStreamerDestroy(textureStreamer);
+    GLFrameCaptureDestroy(screenshotCapture);
+    GLRenderTargetDestroy(&sceneTarget);
+    if (videoCapture != NULL) {
+        GLFrameCaptureDestroy(videoCapture);
+    }
+    GLProgramCacheDestroy(&programCache);
+
+    WorldBuilderDestroy(worldBuilder, &world);
+    JobSystemDestroy(recordJobs);
+    for (u32 workerIndex = 0; workerIndex < recordStats.maxWorkerCount;
+         ++workerIndex) {
+        ScratchDestroy(recordArenas + workerIndex);
+    }
+
+    for (u32 chunkIndex = 0; chunkIndex < world.chunks.count; ++chunkIndex) {
+        ChunkDestroyBuffers(world.chunks.data + chunkIndex);
     }
 
     ImGui_ImplOpenGL3_Shutdown();
+    GLResourceRegistryFlush();
     ImGui_ImplSDL2_Shutdown();
     ImGui::DestroyContext();
 
@@ -581,46 +1582,310 @@ main(int argc, char *args[])
 }
 
 static void
-WorldReset(Scratch *scratch, World *world, Atlas *atlas)
+WorldReset(Scratch *scratch, World *world)
 {
-    world->chunks.capacity = WORLD_CHUNK_COUNT;
-    world->chunks.count = 0;
-    world->chunks.data = static_cast<Chunk *>(
-        ScratchAllocZero(scratch, sizeof(Chunk) * world->chunks.capacity));
-
-    for (u32 chunkIndex = 0; chunkIndex < WORLD_CHUNK_COUNT; ++chunkIndex) {
-        Chunk *chunk = world->chunks.data + chunkIndex;
-
-        Vector3U32 chunkCoords = GetCoordsFrom3DGridArrayOffsetRM(
-            WORLD_CHUNK_X_COUNT, WORLD_CHUNK_Y_COUNT, WORLD_CHUNK_Z_COUNT,
-            chunkIndex);
-        *chunk =
-            ChunkMake(scratch, chunkCoords.x, chunkCoords.y, chunkCoords.z);
-        ChunkGenerateBlocks(world, chunk);
-        ++world->chunks.count;
+    ASSERT_ISFALSE(world->isBuilding);
+
+    // NOTE(gr3yknigh1): Chunks and their GL buffers are made once and reused
+    // by every reset, only content is dropped. [2025/11/23]
+    if (world->chunks.data == NULL) {
+        world->chunks.capacity = WORLD_CHUNK_COUNT;
+        world->chunks.count = 0;
+        world->chunks.data = static_cast<Chunk *>(
+            ScratchAllocZero(scratch, sizeof(Chunk) * world->chunks.capacity));
+        ASSERT_NONNULL(world->chunks.data);
+
+        for (u32 chunkIndex = 0; chunkIndex < WORLD_CHUNK_COUNT;
+             ++chunkIndex) {
+            Chunk *chunk = world->chunks.data + chunkIndex;
+
+            Vector3U32 chunkCoords = GetCoordsFrom3DGridArrayOffsetRM(
+                WORLD_CHUNK_X_COUNT, WORLD_CHUNK_Y_COUNT, WORLD_CHUNK_Z_COUNT,
+                chunkIndex);
+            *chunk = ChunkMake(
+                scratch, chunkCoords.x, chunkCoords.y, chunkCoords.z);
+            ++world->chunks.count;
+        }
     }
 
-    // NOTE(gr3yknigh1): Should do second pass, because on edges of chunks
-    // geometry generates with unculled faces, cause terrain generation does not
-    // have completed yet.
     for (u32 chunkIndex = 0; chunkIndex < world->chunks.count; ++chunkIndex) {
         Chunk *chunk = world->chunks.data + chunkIndex;
-        ChunkGenerateGeometry(world, chunk, atlas);
+        chunk->faces.count = 0;
+        chunk->faceRecords.count = 0;
+        chunk->state = ChunkState::NotTouched;
+        chunk->isGeometryUploaded = false;
     }
 }
 
-static bool
-IsPointInWorld(f32 x, f32 y, f32 z)
+static void
+CubeStressUpdateInstances(CubeStress *stress)
+{
+    i32 sideCount = static_cast<i32>(glm::ceil(glm::sqrt(
+        static_cast<f32>(stress->count))));
+
+    for (i32 cubeIndex = 0; cubeIndex < stress->count; ++cubeIndex) {
+        Vector3F32 *offset = stress->offsets + cubeIndex;
+        offset->x = static_cast<f32>(cubeIndex % sideCount) * CUBE_STRESS_SPACING;
+        offset->y = CUBE_STRESS_Y_POSITION;
+        offset->z = static_cast<f32>(cubeIndex / sideCount) * CUBE_STRESS_SPACING;
+    }
+
+    GLInstanceBufferSendData(
+        &stress->instanceBuffer, stress->offsets,
+        sizeof(Vector3F32) * stress->count, stress->count);
+    stress->uploadedCount = stress->count;
+}
+
+/*
+ * @breaf Same as `GetOffsetFromCoords3DGridArrayRM` with chunk sides, but
+ * with shifts.
+ */
+static inline u32
+ChunkGetBlockIndex(u32 x, u32 y, u32 z)
+{
+    return (x << (CHUNK_SIDE_SHIFT * 2)) | (y << CHUNK_SIDE_SHIFT) | z;
+}
+
+static inline Vector3U32
+ChunkGetBlockCoords(u32 blockIndex)
+{
+    Vector3U32 coords;
+    coords.x = blockIndex >> (CHUNK_SIDE_SHIFT * 2);
+    coords.y = (blockIndex >> CHUNK_SIDE_SHIFT) & CHUNK_SIDE_MASK;
+    coords.z = blockIndex & CHUNK_SIDE_MASK;
+    return coords;
+}
+
+/*
+ * @breaf World coordinates of chunk's first block.
+ */
+static inline Vector3I32
+ChunkGetOrigin(const Chunk *chunk)
+{
+    Vector3I32 origin;
+    origin.x = static_cast<i32>(chunk->coords.x) << CHUNK_SIDE_SHIFT;
+    origin.y = static_cast<i32>(chunk->coords.y) << CHUNK_SIDE_SHIFT;
+    origin.z = static_cast<i32>(chunk->coords.z) << CHUNK_SIDE_SHIFT;
+    return origin;
+}
+
+/*
+ * @breaf Returns chunk at chunk coordinates or `NULL` outside of the world.
+ */
+static Chunk *
+WorldFindChunk(const World *world, i32 x, i32 y, i32 z)
+{
+    if (x < 0 || y < 0 || z < 0 || x >= WORLD_CHUNK_X_COUNT ||
+        y >= WORLD_CHUNK_Y_COUNT || z >= WORLD_CHUNK_Z_COUNT) {
+        return NULL;
+    }
+
+    i32 chunkIndex = (x * WORLD_CHUNK_Y_COUNT + y) * WORLD_CHUNK_Z_COUNT + z;
+    return world->chunks.data + chunkIndex;
+}
+
+static WorldCursor
+WorldCursorMake(World *world)
+{
+    WorldCursor cursor = INIT_EMPTY_STRUCT(WorldCursor);
+    cursor.world = world;
+    return cursor;
+}
+
+/*
+ * @breaf Returns chunk, which contains block at world coordinates, or `NULL`
+ * outside of the world.
+ */
+static inline Chunk *
+WorldCursorGetChunk(WorldCursor *cursor, i32 x, i32 y, i32 z)
+{
+    // NOTE(gr3yknigh1): Shift rounds negative coordinates down, so they land
+    // in chunks outside of the world. [2025/11/23]
+    i32 chunkX = x >> CHUNK_SIDE_SHIFT;
+    i32 chunkY = y >> CHUNK_SIDE_SHIFT;
+    i32 chunkZ = z >> CHUNK_SIDE_SHIFT;
+
+    if (cursor->chunk != NULL && cursor->chunkCoords.x == chunkX &&
+        cursor->chunkCoords.y == chunkY && cursor->chunkCoords.z == chunkZ) {
+        return cursor->chunk;
+    }
+
+    Chunk *chunk = WorldFindChunk(cursor->world, chunkX, chunkY, chunkZ);
+    if (chunk != NULL) {
+        cursor->chunk = chunk;
+        cursor->chunkCoords.x = chunkX;
+        cursor->chunkCoords.y = chunkY;
+        cursor->chunkCoords.z = chunkZ;
+    }
+    return chunk;
+}
+
+/*
+ * @breaf Returns `Nothing` outside of the world.
+ */
+static BlockType
+WorldGetBlock(WorldCursor *cursor, i32 x, i32 y, i32 z)
+{
+    const Chunk *chunk = WorldCursorGetChunk(cursor, x, y, z);
+    if (chunk == NULL) {
+        return BlockType::Nothing;
+    }
+
+    u32 blockIndex = ChunkGetBlockIndex(
+        x & CHUNK_SIDE_MASK, y & CHUNK_SIDE_MASK, z & CHUNK_SIDE_MASK);
+    return chunk->blocks[blockIndex].type;
+}
+
+/*
+ * @breaf Marks meshed chunks, which overlap box [min, max) grown by one
+ * block, as dirty. Faces of neighbour blocks across chunk border depend on
+ * the box too.
+ */
+static void
+WorldMarkDirty(World *world, Vector3I32 min, Vector3I32 max)
+{
+    for (i32 x = (min.x - 1) >> CHUNK_SIDE_SHIFT;
+         x <= max.x >> CHUNK_SIDE_SHIFT; ++x) {
+        for (i32 y = (min.y - 1) >> CHUNK_SIDE_SHIFT;
+             y <= max.y >> CHUNK_SIDE_SHIFT; ++y) {
+            for (i32 z = (min.z - 1) >> CHUNK_SIDE_SHIFT;
+                 z <= max.z >> CHUNK_SIDE_SHIFT; ++z) {
+                Chunk *chunk = WorldFindChunk(world, x, y, z);
+                if (chunk != NULL &&
+                    chunk->state == ChunkState::GeometryGenerated) {
+                    chunk->state = ChunkState::Dirty;
+                }
+            }
+        }
+    }
+}
+
+/*
+ * @breaf Changes block and marks affected chunks as dirty.
+ *
+ * @return `false` if block is outside of the world.
+ */
+static bool
+WorldSetBlock(WorldCursor *cursor, i32 x, i32 y, i32 z, BlockType type)
 {
-    if (x < BLOCK_MIN_X || y < BLOCK_MIN_Y || z < BLOCK_MIN_Z ||
-        x >= BLOCK_MAX_X || y >= BLOCK_MAX_Y || z >= BLOCK_MAX_Z) {
+    Chunk *chunk = WorldCursorGetChunk(cursor, x, y, z);
+    if (chunk == NULL) {
         return false;
     }
+
+    Block *block = chunk->blocks + ChunkGetBlockIndex(
+                                       x & CHUNK_SIDE_MASK,
+                                       y & CHUNK_SIDE_MASK,
+                                       z & CHUNK_SIDE_MASK);
+    if (block->type != type) {
+        block->type = type;
+
+        Vector3I32 min = {x, y, z};
+        Vector3I32 max = {x + 1, y + 1, z + 1};
+        WorldMarkDirty(cursor->world, min, max);
+    }
     return true;
 }
 
+// NOTE(gr3yknigh1): Region arrays are laid out same as blocks of chunk, x is
+// the slowest. Regions are walked in runs along z, which are contiguous in
+// chunk, so there is one chunk lookup per run. [2025/11/23]
+
+/*
+ * @breaf Copies blocks of box [min, min + size) into `types`. Blocks outside
+ * of the world are `Nothing`.
+ */
+static void
+WorldGetBlocks(World *world, Vector3I32 min, Vector3I32 size, BlockType *types)
+{
+    WorldCursor cursor = WorldCursorMake(world);
+    i32 maxZ = min.z + size.z;
+
+    for (i32 x = 0; x < size.x; ++x) {
+        for (i32 y = 0; y < size.y; ++y) {
+            BlockType *row = types + (x * size.y + y) * size.z;
+
+            for (i32 z = min.z; z < maxZ;) {
+                i32 runEnd = (z | CHUNK_SIDE_MASK) + 1;
+                if (runEnd > maxZ) {
+                    runEnd = maxZ;
+                }
+
+                const Chunk *chunk =
+                    WorldCursorGetChunk(&cursor, min.x + x, min.y + y, z);
+
+                if (chunk == NULL) {
+                    for (; z < runEnd; ++z) {
+                        row[z - min.z] = BlockType::Nothing;
+                    }
+                    continue;
+                }
+
+                const Block *blocks =
+                    chunk->blocks +
+                    ChunkGetBlockIndex(
+                        (min.x + x) & CHUNK_SIDE_MASK,
+                        (min.y + y) & CHUNK_SIDE_MASK, 0);
+                for (; z < runEnd; ++z) {
+                    row[z - min.z] = blocks[z & CHUNK_SIDE_MASK].type;
+                }
+            }
+        }
+    }
+}
+
+/*
+ * @breaf Writes `types` into box [min, min + size). Blocks outside of the
+ * world are skipped.
+ *
+ * @param doMarkDirty Marks affected chunks as dirty. Reads state of chunks
+ * around the box, so it must be off while they are generated by other jobs.
+ */
+static void
+WorldSetBlocks(
+    World *world, Vector3I32 min, Vector3I32 size, const BlockType *types,
+    bool doMarkDirty)
+{
+    WorldCursor cursor = WorldCursorMake(world);
+    i32 maxZ = min.z + size.z;
+
+    for (i32 x = 0; x < size.x; ++x) {
+        for (i32 y = 0; y < size.y; ++y) {
+            const BlockType *row = types + (x * size.y + y) * size.z;
+
+            for (i32 z = min.z; z < maxZ;) {
+                i32 runEnd = (z | CHUNK_SIDE_MASK) + 1;
+                if (runEnd > maxZ) {
+                    runEnd = maxZ;
+                }
+
+                Chunk *chunk =
+                    WorldCursorGetChunk(&cursor, min.x + x, min.y + y, z);
+
+                if (chunk == NULL) {
+                    z = runEnd;
+                    continue;
+                }
+
+                Block *blocks = chunk->blocks +
+                                ChunkGetBlockIndex(
+                                    (min.x + x) & CHUNK_SIDE_MASK,
+                                    (min.y + y) & CHUNK_SIDE_MASK, 0);
+                for (; z < runEnd; ++z) {
+                    blocks[z & CHUNK_SIDE_MASK].type = row[z - min.z];
+                }
+            }
+        }
+    }
+
+    if (doMarkDirty) {
+        Vector3I32 max = {min.x + size.x, min.y + size.y, min.z + size.z};
+        WorldMarkDirty(world, min, max);
+    }
+}
+
 static inline void
-MovePositionArray(f32 *position, f32 x, f32 y, f32 z)
+MovePositionArray(u8 *position, u8 x, u8 y, u8 z)
 {
     position[0] += x;
     position[1] += y;
@@ -628,7 +1893,7 @@ MovePositionArray(f32 *position, f32 x, f32 y, f32 z)
 }
 
 static void
-MoveFaces(Face *faces, u32 faceCount, f32 x, f32 y, f32 z)
+MoveFaces(Face *faces, u32 faceCount, u8 x, u8 y, u8 z)
 {
     for (u32 faceIndex = 0; faceIndex < faceCount; ++faceIndex) {
         Face *face = faces + faceIndex;
@@ -683,32 +1948,35 @@ ConvertBlockTypeToTileCoords(Atlas *atlas, BlockType blockType)
     return coords;
 }
 
-static void
-AssignTextures(Face *faces, u32 faceCount, Atlas *atlas, BlockType blockType)
+/*
+ * @breaf Row-major index of block's atlas tile. It's also layer of block
+ * texture array, which chunk shaders sample.
+ */
+static inline u16
+ConvertBlockTypeToTile(Atlas *atlas, BlockType blockType)
 {
     Vector2U32 tileCoords = ConvertBlockTypeToTileCoords(atlas, blockType);
     // ^^^^^^^^^^^^^^^^^^
     // TODO(gr3yknigh1): Implement. There might be different textures for
     // different faces. Leaving this for now. [2024/10/09]
 
-    f32 tileUVWidth = AtlasGetTileUVWidth(atlas);
-    f32 tileUVHeight = AtlasGetTileUVHeight(atlas);
-    TexCoords texCoords = AtlasTileCoordsToUV(atlas, tileCoords);
+    u32 tile = tileCoords.y * AtlasGetXTileCount(atlas) + tileCoords.x;
+    ASSERT_ISTRUE(tile < FACE_RECORD_MAX_TILE_COUNT);
+    return static_cast<u16>(tile);
+}
+
+static void
+AssignTextures(Face *faces, u32 faceCount, Atlas *atlas, BlockType blockType)
+{
+    u16 tile = ConvertBlockTypeToTile(atlas, blockType);
 
     for (u32 faceIndex = 0; faceIndex < faceCount; ++faceIndex) {
         Face *face = faces + faceIndex;
 
-        face->vertexes[0].uv[0] = texCoords.t + tileUVHeight;
-        face->vertexes[0].uv[1] = texCoords.s + tileUVWidth;
-
-        face->vertexes[1].uv[0] = texCoords.t + tileUVHeight;
-        face->vertexes[1].uv[1] = texCoords.s + 0;
-
-        face->vertexes[2].uv[0] = texCoords.t + 0;
-        face->vertexes[2].uv[1] = texCoords.s + 0;
-
-        face->vertexes[3].uv[0] = texCoords.t + 0;
-        face->vertexes[3].uv[1] = texCoords.s + tileUVWidth;
+        for (u32 vertexIndex = 0; vertexIndex < VERTEXES_PER_FACE;
+             ++vertexIndex) {
+            face->vertexes[vertexIndex].tile = tile;
+        }
     }
 }
 
@@ -717,18 +1985,17 @@ ChunkMake(Scratch *scratch, f32 x, f32 y, f32 z)
 {
     Chunk chunk = INIT_EMPTY_STRUCT(Chunk);
 
-    chunk.faces.capacity = CHUNK_MAX_BLOCK_COUNT * FACE_PER_BLOCK;
+    chunk.faces.capacity = CHUNK_MAX_FACE_COUNT;
     chunk.faces.data = static_cast<Face *>(
         ScratchAllocZero(scratch, chunk.faces.capacity * sizeof(Face)));
     ASSERT_NONNULL(chunk.faces.data);
     chunk.faces.count = 0;
 
-    chunk.indexes.capacity =
-        CHUNK_MAX_BLOCK_COUNT * FACE_PER_BLOCK * INDEXES_PER_FACE;
-    chunk.indexes.data = static_cast<u32 *>(
-        ScratchAllocZero(scratch, chunk.indexes.capacity * sizeof(u32)));
-    ASSERT_NONNULL(chunk.indexes.data);
-    chunk.indexes.count = 0;
+    chunk.faceRecords.capacity = CHUNK_MAX_FACE_COUNT;
+    chunk.faceRecords.data = static_cast<FaceRecord *>(ScratchAllocZero(
+        scratch, chunk.faceRecords.capacity * sizeof(FaceRecord)));
+    ASSERT_NONNULL(chunk.faceRecords.data);
+    chunk.faceRecords.count = 0;
 
     chunk.coords.x = x;
     chunk.coords.y = y;
@@ -739,268 +2006,1099 @@ ChunkMake(Scratch *scratch, f32 x, f32 y, f32 z)
     return chunk;
 }
 
+/*
+ * @breaf Fills blocks of chunk. Touches only the chunk, so chunks can be
+ * generated in parallel.
+ */
 static void
 ChunkGenerateBlocks(World *world, Chunk *chunk)
 {
-    for (u16 blockIndex = 0; blockIndex < CHUNK_MAX_BLOCK_COUNT; ++blockIndex) {
-        Vector3U32 blockRelativePosition = GetCoordsFrom3DGridArrayOffsetRM(
-            CHUNK_SIDE_SIZE, CHUNK_SIDE_SIZE, CHUNK_SIDE_SIZE, blockIndex);
-
-        Block *block = chunk->blocks + blockIndex;
-
-        Vector3F32 blockWorldPosition = INIT_EMPTY_STRUCT(Vector3F32);
-        blockWorldPosition.x =
-            chunk->coords.x * CHUNK_SIDE_SIZE + blockRelativePosition.x;
-        blockWorldPosition.y =
-            chunk->coords.y * CHUNK_SIDE_SIZE + blockRelativePosition.y;
-        blockWorldPosition.z =
-            chunk->coords.z * CHUNK_SIDE_SIZE + blockRelativePosition.z;
-        block->type = GenerateNextBlock(
-            blockWorldPosition.x, blockWorldPosition.y, blockWorldPosition.z);
+    Vector3I32 origin = ChunkGetOrigin(chunk);
+    BlockType types[CHUNK_MAX_BLOCK_COUNT];
+
+    for (u32 blockIndex = 0; blockIndex < CHUNK_MAX_BLOCK_COUNT;
+         ++blockIndex) {
+        Vector3U32 blockRelativePosition = ChunkGetBlockCoords(blockIndex);
+        types[blockIndex] = GenerateNextBlock(
+            static_cast<f32>(origin.x + blockRelativePosition.x),
+            static_cast<f32>(origin.y + blockRelativePosition.y),
+            static_cast<f32>(origin.z + blockRelativePosition.z));
     }
+
+    // NOTE(gr3yknigh1): Neighbours are generated by other jobs at the same
+    // time, so their state isn't touched. Meshing waits for them anyway.
+    // [2025/11/23]
+    Vector3I32 size = {CHUNK_SIDE_SIZE, CHUNK_SIDE_SIZE, CHUNK_SIDE_SIZE};
+    WorldSetBlocks(world, origin, size, types, false);
     chunk->state = ChunkState::TerrainGenerated;
 }
 
-static inline bool
-IsNothing(const World *world, f32 rx, f32 ry, f32 rz, f32 wx, f32 wy, f32 wz)
+#define FACE_NORMAL_BIT(NAME) (1u << static_cast<u32>(FaceNormal::NAME))
+
+/*
+ * @breaf Returns mask of block faces, which are not covered by neighbours.
+ * Bit index is `FaceNormal`.
+ * @param x, y, z Block's world position
+ */
+static u32
+BlockGetVisibleFaces(WorldCursor *cursor, i32 x, i32 y, i32 z)
 {
-    // TODO: Use `IsPointInWorld`
-    if (wx < BLOCK_MIN_X || wy < BLOCK_MIN_Y || wz < BLOCK_MIN_Z ||
-        wx >= BLOCK_MAX_X || wy >= BLOCK_MAX_Y || wz >= BLOCK_MAX_Z) {
-        return true;
+    u32 visibleFaces = 0;
+
+    if (WorldGetBlock(cursor, x, y, z + 1) == BlockType::Nothing) {
+        visibleFaces |= FACE_NORMAL_BIT(Front);
     }
 
-    Vector3F32 chunkCoords;
-    chunkCoords.x = wx / CHUNK_SIDE_SIZE;
-    chunkCoords.y = wy / CHUNK_SIDE_SIZE;
-    chunkCoords.z = wz / CHUNK_SIDE_SIZE;
+    if (WorldGetBlock(cursor, x, y, z - 1) == BlockType::Nothing) {
+        visibleFaces |= FACE_NORMAL_BIT(Back);
+    }
 
-    i32 chunkIndex = GetOffsetFromCoords3DGridArrayRM(
-        WORLD_CHUNK_X_COUNT, WORLD_CHUNK_Y_COUNT, WORLD_CHUNK_Z_COUNT,
-        chunkCoords.x, chunkCoords.y, chunkCoords.z);
-    Chunk *chunk = world->chunks.data + chunkIndex;
+    if (WorldGetBlock(cursor, x, y + 1, z) == BlockType::Nothing) {
+        visibleFaces |= FACE_NORMAL_BIT(Top);
+    }
 
-    if (rx < 0) {
-        rx = CHUNK_SIDE_SIZE + rx;
+    if (WorldGetBlock(cursor, x, y - 1, z) == BlockType::Nothing) {
+        visibleFaces |= FACE_NORMAL_BIT(Bottom);
     }
 
-    if (rx >= CHUNK_SIDE_SIZE) {
-        rx = rx - CHUNK_SIDE_SIZE;
+    if (WorldGetBlock(cursor, x - 1, y, z) == BlockType::Nothing) {
+        visibleFaces |= FACE_NORMAL_BIT(Left);
     }
 
-    if (ry < 0) {
-        ry = CHUNK_SIDE_SIZE + ry;
+    if (WorldGetBlock(cursor, x + 1, y, z) == BlockType::Nothing) {
+        visibleFaces |= FACE_NORMAL_BIT(Right);
     }
 
-    if (ry >= CHUNK_SIDE_SIZE) {
-        ry = ry - CHUNK_SIDE_SIZE;
+    return visibleFaces;
+}
+
+/*
+ * @breaf Emits faces into chunk's geometry buffer.
+ */
+static u32
+EmitGeometryToChunk(Chunk *chunk, u32 visibleFaces)
+{
+    u32 cursor = 0;
+
+    Face *facesCursor = chunk->faces.data + chunk->faces.count;
+
+    for (u32 normal = 0; normal < FACE_PER_BLOCK; ++normal) {
+        if (visibleFaces & (1u << normal)) {
+            facesCursor[cursor] = *FACES[normal];
+            ++cursor;
+        }
     }
 
-    if (rz < 0) {
-        rz = CHUNK_SIDE_SIZE + rz;
+    return cursor;
+}
+
+/*
+ * @breaf Emits one `FaceRecord` per visible face, vertex pulling path.
+ */
+static u32
+EmitFaceRecordsToChunk(
+    Chunk *chunk, u32 visibleFaces, const Vector3U32 *rp, u16 tile)
+{
+    u32 cursor = 0;
+
+    FaceRecord *recordsCursor =
+        chunk->faceRecords.data + chunk->faceRecords.count;
+
+    for (u32 normal = 0; normal < FACE_PER_BLOCK; ++normal) {
+        if (visibleFaces & (1u << normal)) {
+            recordsCursor[cursor] = FaceRecordPack(
+                rp->x, rp->y, rp->z, static_cast<FaceNormal>(normal), tile);
+            ++cursor;
+        }
     }
 
-    if (rz >= CHUNK_SIDE_SIZE) {
-        rz = rz - CHUNK_SIDE_SIZE;
+    return cursor;
+}
+
+static void
+ChunkGenerateGeometry(World *world, Chunk *chunk, Atlas *atlas)
+{
+    chunk->faces.count = 0;
+    chunk->faceRecords.count = 0;
+
+    switch (world->renderPath) {
+    case ChunkRenderPath::Greedy:
+        ChunkGenerateGreedyGeometry(world, chunk, atlas);
+        break;
+    case ChunkRenderPath::Binary:
+        ChunkGenerateBinaryGeometry(world, chunk, atlas);
+        break;
+    default:
+        ChunkGenerateBlockGeometry(world, chunk, atlas);
+        break;
     }
 
-    i32 blockIndex = GetOffsetFromCoords3DGridArrayRM(
-        CHUNK_SIDE_SIZE, CHUNK_SIDE_SIZE, CHUNK_SIDE_SIZE, rx, ry, rz);
+    chunk->state = ChunkState::GeometryGenerated;
+    chunk->isGeometryUploaded = false;
+}
+
+/*
+ * @breaf Emits faces block by block, culling each against its neighbours.
+ * Vertexes and vertex pulling paths.
+ */
+static void
+ChunkGenerateBlockGeometry(World *world, Chunk *chunk, Atlas *atlas)
+{
+    Block *blocks = chunk->blocks;
+    u64 blocksCount = CHUNK_MAX_BLOCK_COUNT;
+
+    WorldCursor cursor = WorldCursorMake(world);
+    Vector3I32 origin = ChunkGetOrigin(chunk);
+
+    for (u16 blockIndex = 0; blockIndex < blocksCount; ++blockIndex) {
+        Block *block = blocks + blockIndex;
+
+        if (block->type != BlockType::Nothing) {
+            Vector3U32 blockRelativePositionInd =
+                ChunkGetBlockCoords(blockIndex);
+
+            u32 visibleFaces = BlockGetVisibleFaces(
+                &cursor, origin.x + blockRelativePositionInd.x,
+                origin.y + blockRelativePositionInd.y,
+                origin.z + blockRelativePositionInd.z);
+
+            if (world->renderPath == ChunkRenderPath::VertexPulling) {
+                ASSERT_ISTRUE(
+                    chunk->faceRecords.count + FACE_PER_BLOCK <=
+                    chunk->faceRecords.capacity);
 
-    Block *block = chunk->blocks + blockIndex;
-    return block->type == BlockType::Nothing;
+                chunk->faceRecords.count += EmitFaceRecordsToChunk(
+                    chunk, visibleFaces, &blockRelativePositionInd,
+                    ConvertBlockTypeToTile(atlas, block->type));
+                continue;
+            }
+
+            ASSERT_ISTRUE(
+                chunk->faces.count + FACE_PER_BLOCK <= chunk->faces.capacity);
+
+            u32 facesEmmited = EmitGeometryToChunk(chunk, visibleFaces);
+
+            MoveFaces(
+                chunk->faces.data + chunk->faces.count, facesEmmited,
+                static_cast<u8>(blockRelativePositionInd.x),
+                static_cast<u8>(blockRelativePositionInd.y),
+                static_cast<u8>(blockRelativePositionInd.z));
+            AssignTextures(
+                chunk->faces.data + chunk->faces.count, facesEmmited, atlas,
+                block->type);
+            chunk->faces.count += facesEmmited;
+        }
+    }
 }
 
+// NOTE(gr3yknigh1): Indexed by `FaceNormal`, axis is 0 for x, 1 for y and 2
+// for z. [2025/11/23]
+static const u32 FACE_NORMAL_AXES[FACE_PER_BLOCK] = {2, 2, 1, 1, 0, 0};
+
 /*
- * @breaf Emits faces and indices into chunk's geometry buffer.
- * @param rp Block's relative position
- * @param wp Block's world position
+ * @breaf Emits face, which covers `size` blocks starting from `origin`.
+ * Size along normal axis must be 1.
  */
-static u32
-EmitGeometryToChunk(
-    World *world, Chunk *chunk, const Vector3F32 *rp, const Vector3F32 *wp)
+static void
+EmitGreedyFaceToChunk(
+    Chunk *chunk, FaceNormal normal, const u32 *origin, const u32 *size,
+    u16 tile)
 {
-    u32 cursor = 0;
+    ASSERT_ISTRUE(chunk->faces.count < chunk->faces.capacity);
 
-    Face *facesCursor = chunk->faces.data + chunk->faces.count;
-    u32 *indexesCursor = chunk->indexes.data + chunk->indexes.count;
+    const Face *pattern = FACES[static_cast<u32>(normal)];
+    Face *face = chunk->faces.data + chunk->faces.count;
+
+    u32 topEdgeAxis = 0;
+    u32 leftEdgeAxis = 0;
+
+    for (u32 axis = 0; axis < 3; ++axis) {
+        if (pattern->vertexes[0].position[axis] !=
+            pattern->vertexes[1].position[axis]) {
+            topEdgeAxis = axis;
+        }
+        if (pattern->vertexes[0].position[axis] !=
+            pattern->vertexes[3].position[axis]) {
+            leftEdgeAxis = axis;
+        }
+    }
 
-    u32 indexes[INDEXES_PER_FACE] = {0};
+    u8 extent = static_cast<u8>(
+        (size[topEdgeAxis] - 1) | ((size[leftEdgeAxis] - 1) << 4));
 
-    // Front
-    if (IsNothing(
-            world, rp->x + 0, rp->y + 0, rp->z + 1, wp->x + 0, wp->y + 0,
-            wp->z + 1)) {
-        facesCursor[cursor] = FRONT_FACE;
+    for (u32 vertexIndex = 0; vertexIndex < VERTEXES_PER_FACE;
+         ++vertexIndex) {
+        const ChunkVertex *source = pattern->vertexes + vertexIndex;
+        ChunkVertex *vertex = face->vertexes + vertexIndex;
 
-        MemoryCopy(indexes, FRONT_FACE_INDEXES, INDEXES_PER_FACE * sizeof(u32));
-        for (u16 indexIndex = 0; indexIndex < INDEXES_PER_FACE; ++indexIndex) {
-            indexes[indexIndex] += cursor * VERTEXES_PER_FACE;
+        *vertex = *source;
+        for (u32 axis = 0; axis < 3; ++axis) {
+            vertex->position[axis] = static_cast<u8>(
+                origin[axis] + source->position[axis] * size[axis]);
         }
+        vertex->tile = tile;
+        vertex->extent = extent;
+    }
 
-        MemoryCopy(
-            indexesCursor + cursor * INDEXES_PER_FACE, indexes,
-            INDEXES_PER_FACE * sizeof(u32));
-        ++cursor;
+    ++chunk->faces.count;
+}
+
+/*
+ * @breaf Merges coplanar visible faces with same tile into rectangles. Each
+ * slice of chunk along face normal is turned into mask, which is swept row by
+ * row: face grows along row first, then takes following rows, while they
+ * match whole width.
+ */
+static void
+ChunkGenerateGreedyGeometry(World *world, Chunk *chunk, Atlas *atlas)
+{
+    // NOTE(gr3yknigh1): Visibility is resolved once per block, masks of all
+    // six normals are built from it. [2025/11/23]
+    u8 visibleFaces[CHUNK_MAX_BLOCK_COUNT];
+    u16 tiles[CHUNK_MAX_BLOCK_COUNT];
+
+    WorldCursor cursor = WorldCursorMake(world);
+    Vector3I32 origin = ChunkGetOrigin(chunk);
+
+    for (u32 blockIndex = 0; blockIndex < CHUNK_MAX_BLOCK_COUNT;
+         ++blockIndex) {
+        const Block *block = chunk->blocks + blockIndex;
+
+        visibleFaces[blockIndex] = 0;
+        if (block->type == BlockType::Nothing) {
+            continue;
+        }
+
+        Vector3U32 blockRelativePositionInd = ChunkGetBlockCoords(blockIndex);
+
+        visibleFaces[blockIndex] = static_cast<u8>(BlockGetVisibleFaces(
+            &cursor, origin.x + blockRelativePositionInd.x,
+            origin.y + blockRelativePositionInd.y,
+            origin.z + blockRelativePositionInd.z));
+        tiles[blockIndex] = ConvertBlockTypeToTile(atlas, block->type);
+    }
+
+    // NOTE(gr3yknigh1): Tile + 1 of visible face, zero if there is no face.
+    // Indexed by v * CHUNK_SIDE_SIZE + u. [2025/11/23]
+    u16 mask[CHUNK_SIDE_SIZE * CHUNK_SIDE_SIZE];
+
+    for (u32 normal = 0; normal < FACE_PER_BLOCK; ++normal) {
+        u32 normalAxis = FACE_NORMAL_AXES[normal];
+        u32 uAxis = (normalAxis + 1) % 3;
+        u32 vAxis = (normalAxis + 2) % 3;
+
+        for (u32 slice = 0; slice < CHUNK_SIDE_SIZE; ++slice) {
+            u32 coords[3];
+            coords[normalAxis] = slice;
+
+            for (u32 v = 0; v < CHUNK_SIDE_SIZE; ++v) {
+                coords[vAxis] = v;
+                for (u32 u = 0; u < CHUNK_SIDE_SIZE; ++u) {
+                    coords[uAxis] = u;
+
+                    u32 blockIndex =
+                        ChunkGetBlockIndex(coords[0], coords[1], coords[2]);
+                    mask[v * CHUNK_SIDE_SIZE + u] =
+                        (visibleFaces[blockIndex] & (1u << normal))
+                            ? static_cast<u16>(tiles[blockIndex] + 1)
+                            : 0;
+                }
+            }
+
+            for (u32 v = 0; v < CHUNK_SIDE_SIZE; ++v) {
+                for (u32 u = 0; u < CHUNK_SIDE_SIZE;) {
+                    u16 key = mask[v * CHUNK_SIDE_SIZE + u];
+                    if (key == 0) {
+                        ++u;
+                        continue;
+                    }
+
+                    u32 width = 1;
+                    while (u + width < CHUNK_SIDE_SIZE &&
+                           mask[v * CHUNK_SIDE_SIZE + u + width] == key) {
+                        ++width;
+                    }
+
+                    u32 height = 1;
+                    for (; v + height < CHUNK_SIDE_SIZE; ++height) {
+                        const u16 *nextRow =
+                            mask + (v + height) * CHUNK_SIDE_SIZE + u;
+
+                        u32 column = 0;
+                        while (column < width && nextRow[column] == key) {
+                            ++column;
+                        }
+                        if (column < width) {
+                            break;
+                        }
+                    }
+
+                    for (u32 row = 0; row < height; ++row) {
+                        MemoryZero(
+                            mask + (v + row) * CHUNK_SIDE_SIZE + u,
+                            width * sizeof(mask[0]));
+                    }
+
+                    u32 origin[3];
+                    origin[normalAxis] = slice;
+                    origin[uAxis] = u;
+                    origin[vAxis] = v;
+
+                    u32 size[3];
+                    size[normalAxis] = 1;
+                    size[uAxis] = width;
+                    size[vAxis] = height;
+
+                    EmitGreedyFaceToChunk(
+                        chunk, static_cast<FaceNormal>(normal), origin, size,
+                        static_cast<u16>(key - 1));
+
+                    u += width;
+                }
+            }
+        }
     }
+}
+
+// NOTE(gr3yknigh1): Chunk is padded by one block from each side, so faces
+// on chunk border are culled against neighbours same way as inner ones.
+// [2025/11/23]
+#define CHUNK_PADDED_SIDE_SIZE EXPAND(CHUNK_SIDE_SIZE + 2)
+#define CHUNK_COLUMN_MASK EXPAND((1u << CHUNK_SIDE_SIZE) - 1)
 
-    // Back
-    if (IsNothing(
-            world, rp->x + 0, rp->y + 0, rp->z - 1, wp->x + 0, wp->y + 0,
-            wp->z - 1)) {
-        facesCursor[cursor] = BACK_FACE;
+STATIC_ASSERT(CHUNK_PADDED_SIDE_SIZE <= 32);
 
-        MemoryCopy(indexes, BACK_FACE_INDEXES, INDEXES_PER_FACE * sizeof(u32));
+/*
+ * @breaf Occupancy of padded chunk. Each column holds solid bits along
+ * `axis`, bit index is padded coordinate. Column of `axis` is indexed by
+ * padded coordinates along `(axis + 2) % 3` and `(axis + 1) % 3`, same
+ * order as slices of greedy meshing.
+ */
+typedef struct {
+    u32 columns[3][CHUNK_PADDED_SIDE_SIZE][CHUNK_PADDED_SIDE_SIZE];
+} ChunkOccupancy;
+
+static inline u32
+CountTrailingZerosU32(u32 value)
+{
+    ASSERT_NONZERO(value);
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return static_cast<u32>(index);
+#else
+    return static_cast<u32>(__builtin_ctz(value));
+#endif
+}
 
-        for (u16 indexIndex = 0; indexIndex < INDEXES_PER_FACE; ++indexIndex) {
-            indexes[indexIndex] += cursor * VERTEXES_PER_FACE;
+static inline void
+ChunkOccupancySet(ChunkOccupancy *occupancy, i32 x, i32 y, i32 z)
+{
+    // NOTE(gr3yknigh1): Padding block is set only in columns along axis,
+    // which crosses chunk border, since only those are culled against it.
+    // [2025/11/23]
+    i32 coords[3] = {x + 1, y + 1, z + 1};
+
+    for (u32 axis = 0; axis < 3; ++axis) {
+        u32 u = static_cast<u32>(coords[(axis + 1) % 3]);
+        u32 v = static_cast<u32>(coords[(axis + 2) % 3]);
+
+        if (u == 0 || v == 0 || u == CHUNK_PADDED_SIDE_SIZE - 1 ||
+            v == CHUNK_PADDED_SIDE_SIZE - 1) {
+            continue;
         }
 
-        MemoryCopy(
-            indexesCursor + cursor * INDEXES_PER_FACE, indexes,
-            INDEXES_PER_FACE * sizeof(u32));
-        ++cursor;
+        occupancy->columns[axis][v][u] |= 1u << coords[axis];
     }
+}
+
+static void
+ChunkBuildOccupancy(World *world, const Chunk *chunk, ChunkOccupancy *occupancy)
+{
+    MemoryZero(occupancy, sizeof(*occupancy));
 
-    // Top
-    if (IsNothing(
-            world, rp->x + 0, rp->y + 1, rp->z + 0, wp->x + 0, wp->y + 1,
-            wp->z + 0)) {
-        facesCursor[cursor] = TOP_FACE;
+    for (u32 blockIndex = 0; blockIndex < CHUNK_MAX_BLOCK_COUNT;
+         ++blockIndex) {
+        if (chunk->blocks[blockIndex].type == BlockType::Nothing) {
+            continue;
+        }
+
+        Vector3U32 position = ChunkGetBlockCoords(blockIndex);
+        ChunkOccupancySet(occupancy, position.x, position.y, position.z);
+    }
+
+    Vector3I32 origin = ChunkGetOrigin(chunk);
+
+    // NOTE(gr3yknigh1): Border layer of each neighbour. Outside of the world
+    // there is nothing, so border faces there stay visible. [2025/11/23]
+    BlockType layerTypes[CHUNK_SIDE_SIZE * CHUNK_SIDE_SIZE];
+
+    for (u32 axis = 0; axis < 3; ++axis) {
+        for (i32 side = -1; side <= 1; side += 2) {
+            i32 layer = side < 0 ? -1 : CHUNK_SIDE_SIZE;
+
+            i32 layerMin[3] = {origin.x, origin.y, origin.z};
+            i32 layerSize[3] = {
+                CHUNK_SIDE_SIZE, CHUNK_SIDE_SIZE, CHUNK_SIDE_SIZE};
+            layerMin[axis] += layer;
+            layerSize[axis] = 1;
+
+            Vector3I32 min = {layerMin[0], layerMin[1], layerMin[2]};
+            Vector3I32 size = {layerSize[0], layerSize[1], layerSize[2]};
+            WorldGetBlocks(world, min, size, layerTypes);
+
+            for (i32 v = 0; v < CHUNK_SIDE_SIZE; ++v) {
+                for (i32 u = 0; u < CHUNK_SIDE_SIZE; ++u) {
+                    i32 coords[3];
+                    coords[axis] = 0;
+                    coords[(axis + 1) % 3] = u;
+                    coords[(axis + 2) % 3] = v;
+
+                    i32 typeIndex =
+                        (coords[0] * layerSize[1] + coords[1]) * layerSize[2] +
+                        coords[2];
+                    if (layerTypes[typeIndex] == BlockType::Nothing) {
+                        continue;
+                    }
+
+                    coords[axis] = layer;
+                    ChunkOccupancySet(
+                        occupancy, coords[0], coords[1], coords[2]);
+                }
+            }
+        }
+    }
+}
 
-        MemoryCopy(indexes, TOP_FACE_INDEXES, INDEXES_PER_FACE * sizeof(u32));
+// NOTE(gr3yknigh1): Indexed by `FaceNormal`. Faces with positive normal
+// look towards higher bits of column. [2025/11/23]
+static const bool FACE_NORMAL_IS_POSITIVE[FACE_PER_BLOCK] = {
+    true, false, true, false, false, true};
 
-        for (u16 indexIndex = 0; indexIndex < INDEXES_PER_FACE; ++indexIndex) {
-            indexes[indexIndex] += cursor * VERTEXES_PER_FACE;
+/*
+ * @breaf Emits face of every solid block, which has no solid neighbour
+ * towards normal. Whole column is culled by one shift and AND-NOT, visible
+ * faces are walked by trailing zeros.
+ */
+static void
+ChunkGenerateBinaryGeometry(World *world, Chunk *chunk, Atlas *atlas)
+{
+    ChunkOccupancy occupancy;
+    ChunkBuildOccupancy(world, chunk, &occupancy);
+
+    for (u32 normal = 0; normal < FACE_PER_BLOCK; ++normal) {
+        u32 normalAxis = FACE_NORMAL_AXES[normal];
+        u32 uAxis = (normalAxis + 1) % 3;
+        u32 vAxis = (normalAxis + 2) % 3;
+
+        for (u32 v = 0; v < CHUNK_SIDE_SIZE; ++v) {
+            for (u32 u = 0; u < CHUNK_SIDE_SIZE; ++u) {
+                u32 column = occupancy.columns[normalAxis][v + 1][u + 1];
+                u32 visible = FACE_NORMAL_IS_POSITIVE[normal]
+                                  ? column & ~(column >> 1)
+                                  : column & ~(column << 1);
+                visible = (visible >> 1) & CHUNK_COLUMN_MASK;
+
+                while (visible != 0) {
+                    u32 coords[3];
+                    coords[normalAxis] = CountTrailingZerosU32(visible);
+                    coords[uAxis] = u;
+                    coords[vAxis] = v;
+                    visible &= visible - 1;
+
+                    u32 blockIndex =
+                        ChunkGetBlockIndex(coords[0], coords[1], coords[2]);
+
+                    ASSERT_ISTRUE(chunk->faces.count < chunk->faces.capacity);
+                    Face *face = chunk->faces.data + chunk->faces.count;
+                    *face = *FACES[normal];
+                    MoveFaces(
+                        face, 1, static_cast<u8>(coords[0]),
+                        static_cast<u8>(coords[1]),
+                        static_cast<u8>(coords[2]));
+                    AssignTextures(
+                        face, 1, atlas, chunk->blocks[blockIndex].type);
+                    ++chunk->faces.count;
+                }
+            }
         }
+    }
+}
 
-        MemoryCopy(
-            indexesCursor + cursor * INDEXES_PER_FACE, indexes,
-            INDEXES_PER_FACE * sizeof(u32));
-        ++cursor;
+static void
+ChunkMakeBuffers(Chunk *chunk, const GLVertexBufferLayout *layout)
+{
+    chunk->vertexArray = GLVertexArrayMake();
+    chunk->vertexBuffer = GLVertexBufferMake(NULL, 0);
+    GLVertexArrayAddBuffer(chunk->vertexArray, &chunk->vertexBuffer, layout);
+    chunk->faceRecordTexture = GLBufferTextureMake(GL_R32UI);
+}
+
+static void
+ChunkDestroyBuffers(Chunk *chunk)
+{
+    if (chunk->vertexArray == 0) {
+        return;
     }
 
-    // Bottom
-    if (IsNothing(
-            world, rp->x + 0, rp->y - 1, rp->z + 0, wp->x + 0, wp->y - 1,
-            wp->z + 0)) {
-        facesCursor[cursor] = BOTTOM_FACE;
+    GLVertexArrayDestroy(chunk->vertexArray);
+    GLVertexBufferDestroy(&chunk->vertexBuffer);
+    GLBufferTextureDestroy(&chunk->faceRecordTexture);
+    chunk->vertexArray = 0;
+}
 
-        MemoryCopy(
-            indexes, BOTTOM_FACE_INDEXES, INDEXES_PER_FACE * sizeof(u32));
+/*
+ * @breaf Records upload of chunk's geometry. Geometry arrays must not change
+ * until queue is submitted.
+ */
+static void
+ChunkRecordUpload(
+    RenderCommandBuffer *buffer, Chunk *chunk, ChunkRenderPath renderPath)
+{
+    if (renderPath == ChunkRenderPath::VertexPulling) {
+        RenderCommandBufferPushUpload(
+            buffer, GL_TEXTURE_BUFFER, chunk->faceRecordTexture.buffer,
+            chunk->faceRecords.data,
+            chunk->faceRecords.count * sizeof(FaceRecord));
+    } else {
+        RenderCommandBufferPushUpload(
+            buffer, GL_ARRAY_BUFFER, chunk->vertexBuffer.id, chunk->faces.data,
+            chunk->faces.count * sizeof(Face));
+    }
+
+    chunk->isGeometryUploaded = true;
+}
+
+static void
+FrameRecordProc(
+    RenderCommandBuffer *buffer, u32 workerIndex, u32 workerCount,
+    void *parameter)
+{
+    FrameRecordContext *context = static_cast<FrameRecordContext *>(parameter);
+
+    const Camera *camera = context->camera;
+    const Atlas *atlas = context->atlas;
+    u32 opaquePass = static_cast<u32>(RenderPass::Opaque);
+
+    u32 chunkFirst = workerIndex * WORLD_CHUNK_COUNT / workerCount;
+    u32 chunkLast = (workerIndex + 1) * WORLD_CHUNK_COUNT / workerCount;
+    if (context->world->isBuilding) {
+        chunkLast = chunkFirst;
+    }
+
+    ChunkRenderPath renderPath = context->world->renderPath;
+    bool isVertexPulling = renderPath == ChunkRenderPath::VertexPulling;
+
+    u32 faceCount = 0;
+    usize geometryBytes = 0;
+    u64 meshTicks = 0;
+
+    for (u32 chunkIndex = chunkFirst; chunkIndex < chunkLast; ++chunkIndex) {
+        Chunk *chunk = context->world->chunks.data + chunkIndex;
+
+        if (chunk->state == ChunkState::Dirty) {
+            u64 meshBeginCounter = SDL_GetPerformanceCounter();
+            ChunkGenerateGeometry(context->world, chunk, context->atlas);
+            meshTicks += SDL_GetPerformanceCounter() - meshBeginCounter;
+        }
+
+        if (!chunk->isGeometryUploaded) {
+            ChunkRecordUpload(buffer, chunk, renderPath);
+        }
 
-        for (u16 indexIndex = 0; indexIndex < INDEXES_PER_FACE; ++indexIndex) {
-            indexes[indexIndex] += cursor * VERTEXES_PER_FACE;
+        u32 chunkFaceCount = isVertexPulling ? chunk->faceRecords.count
+                                             : chunk->faces.count;
+        if (chunkFaceCount == 0) {
+            continue;
         }
 
+        GLShaderProgramID chunkShader = isVertexPulling
+                                            ? context->chunkPullingShader
+                                            : context->chunkShader;
+
+        glm::vec3 chunkOrigin =
+            glm::vec3(chunk->coords.x, chunk->coords.y, chunk->coords.z) *
+            static_cast<f32>(CHUNK_SIDE_SIZE);
+        glm::vec3 chunkCenter =
+            chunkOrigin + static_cast<f32>(CHUNK_SIDE_SIZE) * 0.5f;
+        u32 depth = RenderSortKeyDepth(
+            glm::distance(camera->position, chunkCenter), camera->far);
+
+        glm::mat4 chunkModel =
+            glm::translate(glm::identity<glm::mat4>(), chunkOrigin);
+
+        RenderCommand *command = RenderCommandBufferPush(
+            buffer,
+            RenderSortKeyMake(
+                opaquePass, chunkShader, context->blockTextures, depth));
+        command->shader = chunkShader;
+        command->textureTarget = GL_TEXTURE_2D_ARRAY;
+        command->texture = context->blockTextures;
+        command->elementBuffer = context->chunkElementBuffer->id;
+        command->elementType = context->chunkElementBuffer->indexType;
+        command->elementCount = chunkFaceCount * INDEXES_PER_FACE;
+        command->hasDrawBlock = true;
         MemoryCopy(
-            indexesCursor + cursor * INDEXES_PER_FACE, indexes,
-            INDEXES_PER_FACE * sizeof(u32));
-        ++cursor;
+            command->drawBlock.model, glm::value_ptr(chunkModel),
+            sizeof(command->drawBlock.model));
+
+        // NOTE(gr3yknigh1): Shared quad index buffer is still used for vertex
+        // pulling, so `gl_VertexID` is face index * 4 + corner. [2025/11/23]
+        if (isVertexPulling) {
+            command->vertexArray = context->emptyVertexArray;
+            command->dataTextureTarget = GL_TEXTURE_BUFFER;
+            command->dataTexture = chunk->faceRecordTexture.texture;
+            geometryBytes += chunkFaceCount * sizeof(FaceRecord);
+        } else {
+            command->vertexArray = chunk->vertexArray;
+            geometryBytes += chunkFaceCount * sizeof(Face);
+        }
+
+        faceCount += chunkFaceCount;
     }
 
-    // Left
-    if (IsNothing(
-            world, rp->x - 1, rp->y + 0, rp->z + 0, wp->x - 1, wp->y + 0,
-            wp->z + 0)) {
-        facesCursor[cursor] = LEFT_FACE;
+    context->faceCounts[workerIndex] = faceCount;
+    context->geometryBytes[workerIndex] = geometryBytes;
+    context->meshMilliseconds[workerIndex] =
+        static_cast<f32>(meshTicks) * 1000.0f /
+        static_cast<f32>(context->performanceFrequency);
 
-        u32 indexes[INDEXES_PER_FACE] = {0};
-        MemoryCopy(indexes, LEFT_FACE_INDEXES, INDEXES_PER_FACE * sizeof(u32));
+    const CubeStress *cubeStress = context->cubeStress;
+
+    if (!cubeStress->enabled) {
+        return;
+    }
 
-        for (u16 indexIndex = 0; indexIndex < INDEXES_PER_FACE; ++indexIndex) {
-            indexes[indexIndex] += cursor * VERTEXES_PER_FACE;
+    if (cubeStress->mode == CubeStressMode::Individual) {
+        u32 cubeCount = static_cast<u32>(cubeStress->count);
+        u32 cubeFirst = workerIndex * cubeCount / workerCount;
+        u32 cubeLast = (workerIndex + 1) * cubeCount / workerCount;
+
+        for (u32 cubeIndex = cubeFirst; cubeIndex < cubeLast; ++cubeIndex) {
+            const Vector3F32 *offset = cubeStress->offsets + cubeIndex;
+            glm::vec3 cubePosition(offset->x, offset->y, offset->z);
+            glm::mat4 cubeModel =
+                glm::translate(glm::identity<glm::mat4>(), cubePosition);
+            u32 depth = RenderSortKeyDepth(
+                glm::distance(camera->position, cubePosition), camera->far);
+
+            RenderCommand *command = RenderCommandBufferPush(
+                buffer,
+                RenderSortKeyMake(
+                    opaquePass, context->shader, atlas->texture, depth));
+            command->shader = context->shader;
+            command->textureTarget = GL_TEXTURE_2D;
+            command->texture = atlas->texture;
+            command->vertexArray = cubeStress->mesh->vertexArray;
+            command->elementBuffer = cubeStress->mesh->elementBuffer.id;
+            command->elementCount = cubeStress->mesh->elementBuffer.count;
+            command->hasDrawBlock = true;
+            MemoryCopy(
+                command->drawBlock.model, glm::value_ptr(cubeModel),
+                sizeof(command->drawBlock.model));
         }
+    } else if (
+        cubeStress->mode == CubeStressMode::Instanced && workerIndex == 0) {
+        RenderCommand *command = RenderCommandBufferPush(
+            buffer, RenderSortKeyMake(
+                        opaquePass, context->cubeInstancedShader,
+                        atlas->texture, 0));
+        command->shader = context->cubeInstancedShader;
+        command->textureTarget = GL_TEXTURE_2D;
+        command->texture = atlas->texture;
+        command->vertexArray = cubeStress->mesh->vertexArray;
+        command->elementBuffer = cubeStress->mesh->elementBuffer.id;
+        command->elementCount = cubeStress->mesh->elementBuffer.count;
+        command->instanceCount = cubeStress->instanceBuffer.count;
+        command->hasDrawBlock = true;
+        command->drawBlock = context->identityDrawBlock;
+    }
+}
 
-        MemoryCopy(
-            indexesCursor + cursor * INDEXES_PER_FACE, indexes,
-            INDEXES_PER_FACE * sizeof(u32));
-        ++cursor;
+static void
+RecordStatsStartBenchmark(RecordStats *stats)
+{
+    stats->isBenchmarkRunning = true;
+    stats->workerCountBeforeBenchmark = stats->workerCount;
+    stats->workerCount = 1;
+    stats->benchmarkResultsCount = 0;
+    stats->accumulatedMilliseconds = 0;
+    stats->accumulatedFrames = 0;
+}
+
+static void
+RecordStatsUpdate(RecordStats *stats, f32 milliseconds)
+{
+    stats->accumulatedMilliseconds += milliseconds;
+    ++stats->accumulatedFrames;
+
+    u32 framesPerSample = stats->isBenchmarkRunning
+                              ? RECORD_BENCHMARK_FRAMES
+                              : RECORD_STATS_AVERAGE_FRAMES;
+
+    if (stats->accumulatedFrames < framesPerSample) {
+        return;
     }
 
-    // Right
-    if (IsNothing(
-            world, rp->x + 1, rp->y + 0, rp->z + 0, wp->x + 1, wp->y + 0,
-            wp->z + 0)) {
-        facesCursor[cursor] = RIGHT_FACE;
+    stats->recordMilliseconds =
+        stats->accumulatedMilliseconds /
+        static_cast<f32>(stats->accumulatedFrames);
+    stats->accumulatedMilliseconds = 0;
+    stats->accumulatedFrames = 0;
+
+    if (!stats->isBenchmarkRunning) {
+        return;
+    }
+
+    stats->benchmarkResults[stats->benchmarkResultsCount++] =
+        stats->recordMilliseconds;
+
+    if (static_cast<u32>(stats->workerCount) < stats->maxWorkerCount) {
+        ++stats->workerCount;
+    } else {
+        stats->isBenchmarkRunning = false;
+        stats->workerCount = stats->workerCountBeforeBenchmark;
+    }
+}
 
-        u32 indexes[INDEXES_PER_FACE] = {0};
-        MemoryCopy(indexes, RIGHT_FACE_INDEXES, INDEXES_PER_FACE * sizeof(u32));
+static void
+WorldSetRenderPath(World *world, ChunkRenderPath renderPath)
+{
+    world->renderPath = renderPath;
 
-        for (u16 indexIndex = 0; indexIndex < INDEXES_PER_FACE; ++indexIndex) {
-            indexes[indexIndex] += cursor * VERTEXES_PER_FACE;
+    for (u32 chunkIndex = 0; chunkIndex < world->chunks.count; ++chunkIndex) {
+        world->chunks.data[chunkIndex].state = ChunkState::Dirty;
+    }
+}
+
+static void
+ChunkMeshBenchmarkRun(ChunkMeshBenchmark *benchmark, World *world, Atlas *atlas)
+{
+    ChunkRenderPath pathBeforeBenchmark = world->renderPath;
+    f32 frequency = static_cast<f32>(SDL_GetPerformanceFrequency());
+
+    for (i32 pathIndex = 0;
+         pathIndex < static_cast<i32>(ChunkRenderPath::Count); ++pathIndex) {
+        world->renderPath = static_cast<ChunkRenderPath>(pathIndex);
+
+        u64 beginCounter = SDL_GetPerformanceCounter();
+        for (u32 iteration = 0; iteration < MESH_BENCHMARK_ITERATIONS;
+             ++iteration) {
+            for (u32 chunkIndex = 0; chunkIndex < world->chunks.count;
+                 ++chunkIndex) {
+                ChunkGenerateGeometry(
+                    world, world->chunks.data + chunkIndex, atlas);
+            }
         }
+        u64 endCounter = SDL_GetPerformanceCounter();
 
-        MemoryCopy(
-            indexesCursor + cursor * INDEXES_PER_FACE, indexes,
-            INDEXES_PER_FACE * sizeof(u32));
-        ++cursor;
+        u32 faceCount = 0;
+        for (u32 chunkIndex = 0; chunkIndex < world->chunks.count;
+             ++chunkIndex) {
+            const Chunk *chunk = world->chunks.data + chunkIndex;
+            faceCount += world->renderPath == ChunkRenderPath::VertexPulling
+                             ? chunk->faceRecords.count
+                             : chunk->faces.count;
+        }
+
+        benchmark->chunkMicroseconds[pathIndex] =
+            static_cast<f32>(endCounter - beginCounter) * 1000000.0f /
+            frequency /
+            static_cast<f32>(MESH_BENCHMARK_ITERATIONS * world->chunks.count);
+        benchmark->faceCounts[pathIndex] = faceCount;
     }
 
-    return cursor;
+    benchmark->hasResults = true;
+
+    // NOTE(gr3yknigh1): Geometry of chunks was overwritten, so world is
+    // remeshed with previous path on next frame. [2025/11/23]
+    WorldSetRenderPath(world, pathBeforeBenchmark);
 }
 
-static inline Vector3F32
-Vector3U32ConvertToVector3F32(const Vector3U32 *v)
+static void
+ChunkGenerateBlocksJobProc(void *parameter)
 {
-    Vector3F32 ret;
-    ret.x = static_cast<f32>(v->x);
-    ret.y = static_cast<f32>(v->y);
-    ret.z = static_cast<f32>(v->z);
-    return ret;
+    ChunkJob *job = static_cast<ChunkJob *>(parameter);
+    ChunkGenerateBlocks(job->world, job->chunk);
 }
 
 static void
-ChunkGenerateGeometry(World *world, Chunk *chunk, Atlas *atlas)
+ChunkGenerateGeometryJobProc(void *parameter)
 {
-    chunk->faces.count = 0;
-    chunk->indexes.count = 0;
+    ChunkJob *job = static_cast<ChunkJob *>(parameter);
+    ChunkGenerateGeometry(job->world, job->chunk, job->atlas);
+}
 
-    Block *blocks = chunk->blocks;
-    u64 blocksCount = CHUNK_MAX_BLOCK_COUNT;
+static WorldBuilder *
+WorldBuilderMake(Scratch *scratch)
+{
+    WorldBuilder *builder = static_cast<WorldBuilder *>(
+        ScratchAllocZero(scratch, sizeof(WorldBuilder)));
+    if (builder == NULL) {
+        return NULL;
+    }
 
-    for (u16 blockIndex = 0; blockIndex < blocksCount; ++blockIndex) {
-        Block *block = blocks + blockIndex;
+    // NOTE(gr3yknigh1): Main thread keeps drawing frames while world is
+    // built, so it's core is left out. [2025/11/23]
+    u32 workerCount = GetProcessorCount();
+    workerCount = workerCount > 1 ? workerCount - 1 : 1;
+    if (workerCount > JOB_SYSTEM_MAX_WORKERS) {
+        workerCount = JOB_SYSTEM_MAX_WORKERS;
+    }
 
-        if (block->type != BlockType::Nothing) {
-            Vector3U32 blockRelativePositionInd =
-                GetCoordsFrom3DGridArrayOffsetRM(
-                    CHUNK_SIDE_SIZE, CHUNK_SIDE_SIZE, CHUNK_SIDE_SIZE,
-                    blockIndex);
-            Vector3F32 blockRelativePosition =
-                Vector3U32ConvertToVector3F32(&blockRelativePositionInd);
-
-            Vector3F32 blockWorldPosition = INIT_EMPTY_STRUCT(Vector3F32);
-            blockWorldPosition.x =
-                chunk->coords.x * CHUNK_SIDE_SIZE + blockRelativePositionInd.x;
-            blockWorldPosition.y =
-                chunk->coords.y * CHUNK_SIDE_SIZE + blockRelativePositionInd.y;
-            blockWorldPosition.z =
-                chunk->coords.z * CHUNK_SIDE_SIZE + blockRelativePositionInd.z;
-
-            u32 facesEmmited = EmitGeometryToChunk(
-                world, chunk, &blockRelativePosition, &blockWorldPosition);
-
-            // Normalize geometry
-            for (u32 indexIndex = 0;
-                 indexIndex < INDEXES_PER_FACE * facesEmmited; ++indexIndex) {
-                (chunk->indexes.data + chunk->indexes.count)[indexIndex] +=
-                    chunk->faces.count * VERTEXES_PER_FACE;
+    builder->jobs = JobSystemMake(
+        scratch, workerCount, WORLD_CHUNK_COUNT * 2,
+        WORLD_CHUNK_COUNT * (FACE_PER_BLOCK + 1));
+    builder->inlineJobs = JobSystemMake(
+        scratch, 0, WORLD_CHUNK_COUNT * 2,
+        WORLD_CHUNK_COUNT * (FACE_PER_BLOCK + 1));
+    if (builder->jobs == NULL || builder->inlineJobs == NULL) {
+        return NULL;
+    }
+
+    return builder;
+}
+
+static void
+WorldBuilderDestroy(WorldBuilder *builder, World *world)
+{
+    if (world->isBuilding) {
+        JobSystemWait(builder->jobs);
+        world->isBuilding = false;
+    }
+
+    JobSystemDestroy(builder->jobs);
+    JobSystemDestroy(builder->inlineJobs);
+}
+
+static void
+WorldBuildAddJobs(
+    WorldBuilder *builder, JobSystem *jobs, World *world, Atlas *atlas)
+{
+    JobID generateJobs[WORLD_CHUNK_COUNT];
+
+    for (u32 chunkIndex = 0; chunkIndex < world->chunks.count; ++chunkIndex) {
+        ChunkJob *chunkJob = builder->chunkJobs + chunkIndex;
+        chunkJob->world = world;
+        chunkJob->chunk = world->chunks.data + chunkIndex;
+        chunkJob->atlas = atlas;
+
+        generateJobs[chunkIndex] =
+            JobSystemAdd(jobs, ChunkGenerateBlocksJobProc, chunkJob);
+    }
+
+    for (u32 chunkIndex = 0; chunkIndex < world->chunks.count; ++chunkIndex) {
+        ChunkJob *chunkJob = builder->chunkJobs + chunkIndex;
+        JobID meshJob =
+            JobSystemAdd(jobs, ChunkGenerateGeometryJobProc, chunkJob);
+        JobSystemAddDependency(jobs, meshJob, generateJobs[chunkIndex]);
+
+        const Chunk *chunk = chunkJob->chunk;
+
+        for (u32 normal = 0; normal < FACE_PER_BLOCK; ++normal) {
+            i32 neighbourCoords[3] = {
+                static_cast<i32>(chunk->coords.x),
+                static_cast<i32>(chunk->coords.y),
+                static_cast<i32>(chunk->coords.z)};
+            neighbourCoords[FACE_NORMAL_AXES[normal]] +=
+                FACE_NORMAL_IS_POSITIVE[normal] ? 1 : -1;
+
+            const Chunk *neighbour = WorldFindChunk(
+                world, neighbourCoords[0], neighbourCoords[1],
+                neighbourCoords[2]);
+            if (neighbour != NULL) {
+                JobSystemAddDependency(
+                    jobs, meshJob,
+                    generateJobs[neighbour - world->chunks.data]);
             }
+        }
+    }
+}
 
-            MoveFaces(
-                chunk->faces.data + chunk->faces.count, facesEmmited,
-                blockWorldPosition.x, blockWorldPosition.y,
-                blockWorldPosition.z);
-            AssignTextures(
-                chunk->faces.data + chunk->faces.count, facesEmmited, atlas,
-                block->type);
-            chunk->faces.count += facesEmmited;
-            chunk->indexes.count += facesEmmited * INDEXES_PER_FACE;
+/*
+ * @breaf Starts building of reset world. Returns right away, main thread
+ * picks up results in `WorldBuildUpdate`.
+ */
+static void
+WorldBuildStart(WorldBuilder *builder, World *world, Atlas *atlas)
+{
+    ASSERT_ISFALSE(world->isBuilding);
+
+    WorldBuildAddJobs(builder, builder->jobs, world, atlas);
+
+    world->isBuilding = true;
+    builder->beginCounter = SDL_GetPerformanceCounter();
+    JobSystemStart(builder->jobs);
+}
+
+/*
+ * @breaf Hands chunks back to main thread, once build is finished. Their
+ * geometry is uploaded with next recorded frame.
+ *
+ * @return `true` if build was finished by this call.
+ */
+static bool
+WorldBuildUpdate(WorldBuilder *builder, World *world)
+{
+    if (!world->isBuilding) {
+        return false;
+    }
+
+    // NOTE(gr3yknigh1): Without workers jobs are run only by
+    // `JobSystemWait`, so build is finished right here. [2025/11/23]
+    if (builder->jobs->workerCount > 0 && !JobSystemIsDone(builder->jobs)) {
+        return false;
+    }
+
+    JobSystemWait(builder->jobs);
+    world->isBuilding = false;
+
+    builder->milliseconds =
+        static_cast<f32>(SDL_GetPerformanceCounter() - builder->beginCounter) *
+        1000.0f / static_cast<f32>(SDL_GetPerformanceFrequency());
+    return true;
+}
+
+/*
+ * @breaf Blocking builds of world on calling thread only and on all
+ * workers. World is left built.
+ */
+static void
+WorldBuildBenchmark(
+    WorldBuilder *builder, Scratch *scratch, World *world, Atlas *atlas)
+{
+    ASSERT_ISFALSE(world->isBuilding);
+
+    JobSystem *systems[] = {builder->inlineJobs, builder->jobs};
+    f32 milliseconds[STATIC_ARRAY_LENGTH(systems)] = {};
+    f32 frequency = static_cast<f32>(SDL_GetPerformanceFrequency());
+
+    for (u32 systemIndex = 0; systemIndex < STATIC_ARRAY_LENGTH(systems);
+         ++systemIndex) {
+        for (u32 run = 0; run < WORLD_BUILD_BENCHMARK_RUNS; ++run) {
+            WorldReset(scratch, world);
+
+            u64 beginCounter = SDL_GetPerformanceCounter();
+            WorldBuildAddJobs(builder, systems[systemIndex], world, atlas);
+            JobSystemStart(systems[systemIndex]);
+            JobSystemWait(systems[systemIndex]);
+            u64 endCounter = SDL_GetPerformanceCounter();
+
+            milliseconds[systemIndex] +=
+                static_cast<f32>(endCounter - beginCounter) * 1000.0f /
+                frequency;
         }
     }
 
-    chunk->state = ChunkState::GeometryGenerated;
+    builder->singleThreadMilliseconds =
+        milliseconds[0] / WORLD_BUILD_BENCHMARK_RUNS;
+    builder->multiThreadMilliseconds =
+        milliseconds[1] / WORLD_BUILD_BENCHMARK_RUNS;
+    builder->hasBenchmarkResults = true;
+}
+
+/*
+ * @breaf `WorldBuildBenchmark` without window and OpenGL context.
+ *
+ * @return Exit code of the program.
+ */
+static int
+WorldBuildBenchmarkHeadless(Scratch *scratch)
+{
+    // NOTE(gr3yknigh1): Meshing needs only size of atlas picture, so it's
+    // loaded without making texture. [2025/11/23]
+    Atlas atlas = INIT_EMPTY_STRUCT(Atlas);
+    atlas.picture = static_cast<BMPicture *>(
+        ScratchAllocZero(scratch, sizeof(BMPicture)));
+    atlas.tileWidth = 16;
+    atlas.tileHeight = 16;
+
+    if (atlas.picture == NULL ||
+        BMPictureLoadFromFile(atlas.picture, scratch, "assets/atlas.bmp") !=
+            BMP_LOAD_FROM_FILE_OK) {
+        SDL_LogError(
+            SDL_LOG_CATEGORY_APPLICATION, "Failed to load atlas picture\n");
+        return 1;
+    }
+
+    WorldBuilder *builder = WorldBuilderMake(scratch);
+    if (builder == NULL) {
+        SDL_LogError(
+            SDL_LOG_CATEGORY_APPLICATION, "Failed to make world builder\n");
+        return 1;
+    }
+
+    World world = INIT_EMPTY_STRUCT(World);
+    WorldBuildBenchmark(builder, scratch, &world, &atlas);
+
+    SDL_LogInfo(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "World build of %u chunks, average of %u runs: %.3f ms single "
+        "thread, %.3f ms on %u workers (%.2fx)\n",
+        WORLD_CHUNK_COUNT, WORLD_BUILD_BENCHMARK_RUNS,
+        builder->singleThreadMilliseconds, builder->multiThreadMilliseconds,
+        builder->jobs->workerCount,
+        builder->singleThreadMilliseconds / builder->multiThreadMilliseconds);
+
+    WorldBuilderDestroy(builder, &world);
+    return 0;
+}
+
+static void
+ChunkRenderPathStatsStartBenchmark(ChunkRenderPathStats *stats, World *world)
+{
+    stats->isBenchmarkRunning = true;
+    stats->pathBeforeBenchmark = world->renderPath;
+    stats->benchmarkFrames = 0;
+    stats->accumulatedMilliseconds = 0;
+    stats->hasBenchmarkResults = false;
+
+    WorldSetRenderPath(world, static_cast<ChunkRenderPath>(0));
+}
+
+static void
+ChunkRenderPathStatsUpdate(
+    ChunkRenderPathStats *stats, World *world, f32 meshMilliseconds,
+    u32 faceCount, usize geometryBytes, f32 frameMilliseconds)
+{
+    if (meshMilliseconds > 0) {
+        stats->meshMilliseconds = meshMilliseconds;
+    }
+
+    if (!stats->isBenchmarkRunning) {
+        return;
+    }
+
+    i32 pathIndex = static_cast<i32>(world->renderPath);
+    ChunkRenderPathResult *result = stats->benchmarkResults + pathIndex;
+
+    // NOTE(gr3yknigh1): First frame on the path remeshes and uploads whole
+    // world, so it's excluded from frame time. [2025/11/23]
+    if (stats->benchmarkFrames++ == 0) {
+        result->meshMilliseconds = meshMilliseconds;
+        result->faceCount = faceCount;
+        result->geometryBytes = geometryBytes;
+        return;
+    }
+
+    stats->accumulatedMilliseconds += frameMilliseconds;
+
+    if (stats->benchmarkFrames <= RECORD_BENCHMARK_FRAMES) {
+        return;
+    }
+
+    result->frameMilliseconds =
+        stats->accumulatedMilliseconds / RECORD_BENCHMARK_FRAMES;
+    stats->benchmarkFrames = 0;
+    stats->accumulatedMilliseconds = 0;
+
+    if (pathIndex + 1 < static_cast<i32>(ChunkRenderPath::Count)) {
+        WorldSetRenderPath(world, static_cast<ChunkRenderPath>(pathIndex + 1));
+    } else {
+        stats->isBenchmarkRunning = false;
+        stats->hasBenchmarkResults = true;
+        WorldSetRenderPath(world, stats->pathBeforeBenchmark);
+    }
 }
 
 static BlockType
@@ -1016,3 +3114,18 @@ GenerateNextBlock(f32 x, f32 y, f32 z)
 
     return BlockType::Nothing;
 }
+
+/*
+ * @breaf Drops slot of evicted streamed texture, so it's streamed again on
+ * next request.
+ */
+static void
+StreamedTextureEvict(GLRenderObjectType type, u32 handle, void *parameter)
+{
+    UNUSED(type);
+    UNUSED(handle);
+
+    GLTexture *texture = static_cast<GLTexture *>(parameter);
+    ASSERT_EQ(*texture, handle);
+    *texture = 0;
+}
@@ -28,10 +28,24 @@
 #include <gfs/bmp.h>
 #include <gfs/string.h>
 #include <gfs/random.h>
+#include <gfs/frame_pipeline.h>
 
 #include "render.h"
 #include "sound.h"
 
+#define STRESS_RECTANGLE_COUNT EXPAND(100000)
+#define STRESS_RECTANGLE_MAX_SIZE EXPAND(20)
+
+#define FONT_PIXEL_HEIGHT EXPAND(48)
+
+#define STRESS_TEXT_FONT_SIZE EXPAND(14)
+#define STRESS_TEXT_LINE_COUNT EXPAND(42)
+#define STRESS_TEXT_LINE_LENGTH EXPAND(110)
+
+#define GRID_MAX_TILE_COUNT EXPAND(64)
+
+#define FRAME_PIPELINE_DEFAULT_DEPTH EXPAND(2)
+
 static void GenerateTileGrid(
     Vector2F32 *tilePositions, f32 gridXPosition, f32 gridYPosition,
     u32 gridWidth, u32 gridHeight, u32 tileWidth, u32 tileHeight,
@@ -76,6 +90,45 @@ static bool IsOverlapped(
     f32 aXPosition, f32 aYPosition, f32 aWidth, f32 aHeight, f32 bXPosition,
     f32 bYPosition, f32 bWidth, f32 bHeight);
 
+/*
+ * @breaf Everything render needs from simulation for one frame. Copied by
+ * value, so simulation can go on with next frame while this one is drawn.
+ */
+typedef struct {
+    f32 deltaTime;
+
+    RectangleInstance tileInstances[GRID_MAX_TILE_COUNT];
+    u32 tileInstanceCount;
+
+    bool doRenderGridBackground;
+    RectangleF32 gridRect;
+    RectangleF32 playerRect;
+    RectangleF32 ballRect;
+} FrameSnapshot;
+
+/*
+ * @breaf State, which is touched only by thread owning OpenGL context.
+ */
+typedef struct {
+    Window *window;
+    DrawContext *drawContext;
+    FramePipeline *pipeline; // NULL if frames are rendered on main thread.
+
+    Font *font;
+    Font *overlayFont;
+    const char8 *overlayText; // NULL if text stress is disabled.
+    f32 overlayScale;
+    const RectangleF32 *stressRectangles; // NULL if disabled.
+
+    LARGE_INTEGER performanceCounterFrequency;
+    LARGE_INTEGER lastCounter;
+    u64 lastCycleCount;
+} FrameRenderer;
+
+static void FrameRender(const void *snapshot, u64 frameIndex, void *parameter);
+static void FrameRenderThreadBegin(void *parameter);
+static void FrameRenderThreadEnd(void *parameter);
+
 static f32
 GetSign(f32 x)
 {
@@ -86,8 +139,44 @@ GetSign(f32 x)
 void
 Entry(int argc, char *argv[])
 {
-    UNUSED(argc);
-    UNUSED(argv);
+    //
+    // NOTE(gr3yknigh1): Benchmark options:
+    //     --stress-rects  Draw STRESS_RECTANGLE_COUNT rectangles every frame.
+    //     --no-batching   Flush every rectangle right away.
+    //     --stress-text   Draw full-screen text overlay (~4.5k glyphs).
+    //     --no-sdf        Bake separate bitmap font for every text size.
+    // [2025/11/14]
+    //     --pipeline          Render on dedicated thread, simulation of next
+    //                         frame runs in parallel.
+    //     --pipeline-depth N  Frames in flight, 1..FRAME_PIPELINE_MAX_DEPTH.
+    //                         Every frame adds latency. Implies --pipeline.
+    // [2025/11/23]
+    //
+    bool doStressRectangles = false;
+    bool doStressText = false;
+    bool doSDFText = true;
+    bool doBatching = true;
+    bool doPipeline = false;
+    u32 pipelineDepth = FRAME_PIPELINE_DEFAULT_DEPTH;
+
+    for (int argIndex = 1; argIndex < argc; ++argIndex) {
+        if (CString8IsEqual(argv[argIndex], "--stress-rects")) {
+            doStressRectangles = true;
+        } else if (CString8IsEqual(argv[argIndex], "--stress-text")) {
+            doStressText = true;
+        } else if (CString8IsEqual(argv[argIndex], "--no-sdf")) {
+            doSDFText = false;
+        } else if (CString8IsEqual(argv[argIndex], "--no-batching")) {
+            doBatching = false;
+        } else if (CString8IsEqual(argv[argIndex], "--pipeline")) {
+            doPipeline = true;
+        } else if (
+            CString8IsEqual(argv[argIndex], "--pipeline-depth") &&
+            argIndex + 1 < argc) {
+            doPipeline = true;
+            pipelineDepth = (u32)atoi(argv[++argIndex]);
+        }
+    }
 
     Scratch runtimeScratch = ScratchMake(MEGABYTES(500));
 
@@ -101,13 +190,6 @@ Entry(int argc, char *argv[])
     Clock runtimeClock = EMPTY_STRUCT(Clock);
     Clock_Initialize(&runtimeClock);
 
-    LARGE_INTEGER performanceCounterFrequency = {0};
-    ASSERT_NONZERO(QueryPerformanceFrequency(&performanceCounterFrequency));
-
-    LARGE_INTEGER lastCounter = {0};
-    ASSERT_NONZERO(QueryPerformanceCounter(&lastCounter));
-
-    // TODO(gr3yknigh1): Destroy shaders after they are linked [2024/09/15]
     GLShaderProgramID shader = 0;
     {
         GLShaderProgramLinkData shaderLinkData = {0};
@@ -119,6 +201,27 @@ Entry(int argc, char *argv[])
             GL_SHADER_TYPE_VERT);
         shader = GLLinkShaderProgram(&runtimeScratch, &shaderLinkData);
         ASSERT_NONZERO(shader);
+
+        GLShaderDestroy(shaderLinkData.vertexShader);
+        GLShaderDestroy(shaderLinkData.fragmentShader);
+    }
+
+    GLShaderProgramID rectInstancedShader = 0;
+    {
+        GLShaderProgramLinkData shaderLinkData = {0};
+        shaderLinkData.vertexShader = GLCompileShaderFromFile(
+            &runtimeScratch,
+            "P:\\gfs\\assets\\breakout\\rect_instanced.vert.glsl",
+            GL_SHADER_TYPE_VERT);
+        shaderLinkData.fragmentShader = GLCompileShaderFromFile(
+            &runtimeScratch, "P:\\gfs\\assets\\breakout\\basic.frag.glsl",
+            GL_SHADER_TYPE_FRAG);
+        rectInstancedShader =
+            GLLinkShaderProgram(&runtimeScratch, &shaderLinkData);
+        ASSERT_NONZERO(rectInstancedShader);
+
+        GLShaderDestroy(shaderLinkData.vertexShader);
+        GLShaderDestroy(shaderLinkData.fragmentShader);
     }
 
     GLShaderProgramID textShader = 0;
@@ -132,14 +235,50 @@ Entry(int argc, char *argv[])
             GL_SHADER_TYPE_VERT);
         textShader = GLLinkShaderProgram(&runtimeScratch, &shaderLinkData);
         ASSERT_NONZERO(textShader);
+
+        GLShaderDestroy(shaderLinkData.vertexShader);
+        GLShaderDestroy(shaderLinkData.fragmentShader);
+    }
+
+    GLShaderProgramID textSDFShader = 0;
+    {
+        GLShaderProgramLinkData shaderLinkData = {0};
+        shaderLinkData.vertexShader = GLCompileShaderFromFile(
+            &runtimeScratch, "P:\\gfs\\assets\\breakout\\text.vert.glsl",
+            GL_SHADER_TYPE_VERT);
+        shaderLinkData.fragmentShader = GLCompileShaderFromFile(
+            &runtimeScratch,
+            "P:\\gfs\\assets\\breakout\\text_sdf.frag.glsl",
+            GL_SHADER_TYPE_FRAG);
+        textSDFShader = GLLinkShaderProgram(&runtimeScratch, &shaderLinkData);
+        ASSERT_NONZERO(textSDFShader);
+
+        GLShaderDestroy(shaderLinkData.vertexShader);
+        GLShaderDestroy(shaderLinkData.fragmentShader);
     }
 
     Camera camera = Camera_Make(window, -1, 1, CAMERA_VIEW_MODE_ORTHOGONAL);
 
-    u64 lastCycleCount = __rdtsc();
+    DrawContext drawContext = DrawContext_MakeEx(
+        &runtimeScratch, &camera, shader, rectInstancedShader, textShader,
+        textSDFShader);
+    drawContext.isBatchingEnabled = doBatching;
+
+    RectangleF32 *stressRectangles = NULL;
 
-    DrawContext drawContext =
-        DrawContext_MakeEx(&runtimeScratch, &camera, shader, textShader);
+    if (doStressRectangles) {
+        stressRectangles =
+            malloc(sizeof(RectangleF32) * STRESS_RECTANGLE_COUNT);
+
+        for (u32 rectIndex = 0; rectIndex < STRESS_RECTANGLE_COUNT;
+             ++rectIndex) {
+            RectangleF32 *rect = stressRectangles + rectIndex;
+            rect->width = RandI32(1, STRESS_RECTANGLE_MAX_SIZE);
+            rect->height = RandI32(1, STRESS_RECTANGLE_MAX_SIZE);
+            rect->x = RandI32(0, windowRect.width);
+            rect->y = RandI32(0, windowRect.height);
+        }
+    }
 
     RectangleF32 ballRect = EMPTY_STRUCT(RectangleF32);
     ballRect.width = 10.0;
@@ -163,6 +302,7 @@ Entry(int argc, char *argv[])
         gridYTileCount * tileHeight + (gridYPadding * (gridYTileCount - 1));
     f32 gridXPosition = (f32)windowRect.width / 2 - gridWidth / 2;
     f32 gridYPosition = (f32)windowRect.height / 2;
+    ASSERT_ISTRUE(gridTileCount <= GRID_MAX_TILE_COUNT);
     Vector2F32 *tilePositions = malloc(sizeof(Vector2F32) * gridTileCount);
     bool *tileIsDisabled = malloc(sizeof(bool) * gridTileCount);
     MemoryZero(tileIsDisabled, sizeof(bool) * gridTileCount);
@@ -187,12 +327,119 @@ Entry(int argc, char *argv[])
     f32 startClockTime = Clock_GetSeconds(&runtimeClock);
     f32 deltaTime = 0;
 
-    Font *font = Font_Make(
-        "P:\\gfs\\assets\\breakout\\IBMPlexMono.ttf", 0, 48);
+    u64 fontBuildStartMilliseconds = Clock_GetMilliseconds(&runtimeClock);
+
+    Font *font = NULL;
+    Font *overlayFont = NULL;
+
+    if (doSDFText) {
+        // NOTE(gr3yknigh1): One SDF atlas serves every text size. [2025/11/16]
+        font = Font_MakeSDF(
+            "P:\\gfs\\assets\\breakout\\IBMPlexMono.ttf",
+            FONT_PIXEL_HEIGHT);
+        overlayFont = font;
+    } else {
+        font = Font_Make(
+            "P:\\gfs\\assets\\breakout\\IBMPlexMono.ttf", 0,
+            FONT_PIXEL_HEIGHT);
+
+        if (doStressText) {
+            overlayFont = Font_Make(
+                "P:\\gfs\\assets\\breakout\\IBMPlexMono.ttf", 0,
+                STRESS_TEXT_FONT_SIZE);
+        }
+    }
+
+    {
+        u64 fontBuildMilliseconds =
+            Clock_GetMilliseconds(&runtimeClock) - fontBuildStartMilliseconds;
+        usize fontAtlasBytes = font->atlasWidth * font->atlasHeight;
+
+        if (overlayFont != NULL && overlayFont != font) {
+            fontAtlasBytes +=
+                overlayFont->atlasWidth * overlayFont->atlasHeight;
+        }
+
+        char8 printBuffer[KILOBYTES(1)];
+        sprintf(
+            printBuffer, "Fonts: %llums | atlas memory: %llu bytes | sdf: %d\n",
+            fontBuildMilliseconds, (u64)fontAtlasBytes, doSDFText);
+        OutputDebugString(printBuffer);
+    }
+
     DrawContext_SelectFont(&drawContext, font);
 
+    char8 *overlayText = NULL;
+    f32 overlayScale = 1;
+
+    if (doStressText) {
+        overlayScale =
+            (f32)STRESS_TEXT_FONT_SIZE / (f32)overlayFont->pixelHeight;
+
+        usize overlayTextSize =
+            STRESS_TEXT_LINE_COUNT * (STRESS_TEXT_LINE_LENGTH + 1) + 1;
+        overlayText = malloc(overlayTextSize);
+        ASSERT_NONNULL(overlayText);
+
+        static const char8 pangram[] =
+            "The quick brown fox jumps over the lazy dog. 0123456789 "
+            "!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~ ";
+
+        char8 *overlayCursor = overlayText;
+        for (u32 lineIndex = 0; lineIndex < STRESS_TEXT_LINE_COUNT;
+             ++lineIndex) {
+            for (u32 charIndex = 0; charIndex < STRESS_TEXT_LINE_LENGTH;
+                 ++charIndex) {
+                *overlayCursor++ = pangram
+                    [(lineIndex + charIndex) % (sizeof(pangram) - 1)];
+            }
+            *overlayCursor++ = '\n';
+        }
+        *overlayCursor = 0;
+    }
+
+    FrameRenderer renderer = EMPTY_STRUCT(FrameRenderer);
+    renderer.window = window;
+    renderer.drawContext = &drawContext;
+    renderer.font = font;
+    renderer.overlayFont = overlayFont;
+    renderer.overlayText = overlayText;
+    renderer.overlayScale = overlayScale;
+    renderer.stressRectangles = stressRectangles;
+    ASSERT_NONZERO(
+        QueryPerformanceFrequency(&renderer.performanceCounterFrequency));
+    ASSERT_NONZERO(QueryPerformanceCounter(&renderer.lastCounter));
+    renderer.lastCycleCount = __rdtsc();
+
+    FrameSnapshot mainThreadSnapshot = EMPTY_STRUCT(FrameSnapshot);
+    u64 frameIndex = 0;
+
+    if (doPipeline) {
+        // NOTE(gr3yknigh1): All GL resources are created at this point, from
+        // now context belongs to render thread. [2025/11/23]
+        WindowSetContextCurrent(window, false);
+
+        FramePipelineSettings pipelineSettings =
+            EMPTY_STRUCT(FramePipelineSettings);
+        pipelineSettings.snapshotSize = sizeof(FrameSnapshot);
+        pipelineSettings.depth = pipelineDepth;
+        pipelineSettings.renderThreadBegin = FrameRenderThreadBegin;
+        pipelineSettings.render = FrameRender;
+        pipelineSettings.renderThreadEnd = FrameRenderThreadEnd;
+        pipelineSettings.parameter = &renderer;
+
+        renderer.pipeline =
+            FramePipelineMake(&runtimeScratch, &pipelineSettings);
+        ASSERT_NONNULL(renderer.pipeline);
+    }
+
     while (!GameStateShouldStop()) {
 
+        FrameSnapshot *snapshot = &mainThreadSnapshot;
+        if (renderer.pipeline != NULL) {
+            snapshot = FramePipelineBeginFrame(renderer.pipeline);
+        }
+
         deltaTime = Clock_GetSeconds(&runtimeClock) - startClockTime;
         startClockTime = Clock_GetSeconds(&runtimeClock);
 
@@ -301,12 +548,8 @@ Entry(int argc, char *argv[])
             }
         }
 
-        DrawBegin(&drawContext);
-        DrawClear(&drawContext, 0, 0, 0);
-
-        GLShaderProgramID shader = drawContext.rectDrawInfo.shader;
-        GL_CALL(glUseProgram(shader));
-        GL_CALL(glBindVertexArray(drawContext.rectDrawInfo.va));
+        snapshot->deltaTime = deltaTime;
+        snapshot->tileInstanceCount = 0;
 
         for (u32 xTileIndex = 0; xTileIndex < gridXTileCount; ++xTileIndex) {
             for (u32 yTileIndex = 0; yTileIndex < gridYTileCount;
@@ -319,60 +562,58 @@ Entry(int argc, char *argv[])
                 }
 
                 Vector2F32 *tilePosition = tilePositions + tileIndex;
-                DrawRectangle(
-                    &drawContext, tilePosition->x, tilePosition->y, tileWidth,
-                    tileHeight, 1, 0, COLOR4RGBA_GREEN);
+                RectangleInstance *instance =
+                    snapshot->tileInstances + snapshot->tileInstanceCount;
+
+                instance->position[0] = tilePosition->x;
+                instance->position[1] = tilePosition->y;
+                instance->size[0] = tileWidth;
+                instance->size[1] = tileHeight;
+                instance->color[0] = COLOR4RGBA_GREEN.r;
+                instance->color[1] = COLOR4RGBA_GREEN.g;
+                instance->color[2] = COLOR4RGBA_GREEN.b;
+
+                ++snapshot->tileInstanceCount;
             }
         }
 
-        if (doRenderGridBackground) {
-            DrawRectangle(
-                &drawContext, gridXPosition, gridYPosition, gridWidth,
-                gridHeight, 1, 0, COLOR4RGBA_BLUE);
-        }
+        snapshot->doRenderGridBackground = doRenderGridBackground;
+        snapshot->gridRect.x = gridXPosition;
+        snapshot->gridRect.y = gridYPosition;
+        snapshot->gridRect.width = gridWidth;
+        snapshot->gridRect.height = gridHeight;
 
-        DrawRectangle(
-            &drawContext, playerXPosition, playerYPosition, playerWidth,
-            playerHeight, 1, 0, COLOR4RGBA_RED);
+        snapshot->playerRect.x = playerXPosition;
+        snapshot->playerRect.y = playerYPosition;
+        snapshot->playerRect.width = playerWidth;
+        snapshot->playerRect.height = playerHeight;
 
-        DrawRectangle(
-            &drawContext, ballRect.x, ballRect.y, ballRect.width,
-            ballRect.height, 1, 0, COLOR4RGBA_WHITE);
+        snapshot->ballRect = ballRect;
 
-        DrawString(&drawContext, 10, 20, "Hello sailor", 1, COLOR4RGBA_BLUE);
+        if (renderer.pipeline != NULL) {
+            FramePipelineEndFrame(renderer.pipeline);
+        } else {
+            FrameRender(snapshot, frameIndex, &renderer);
+        }
 
-        DrawEnd(&drawContext);
+        ++frameIndex;
+    }
 
+    if (renderer.pipeline != NULL) {
+        FramePipelineDestroy(renderer.pipeline);
+        WindowSetContextCurrent(window, true);
+    }
 
-        WindowUpdate(window);
+    Font_Destroy(font);
 
-        ///< Perfomance
-        {
-            u64 endCycleCount = __rdtsc();
-
-            LARGE_INTEGER endCounter;
-            ASSERT_NONZERO(QueryPerformanceCounter(&endCounter));
-
-            // TODO(ilya.a): Display counter [2025/11/08]
-
-            u64 cyclesElapsed = endCycleCount - lastCycleCount;
-            LONGLONG counterElapsed =
-                endCounter.QuadPart - lastCounter.QuadPart;
-
-            u64 msPerFrame =
-                (1000 * counterElapsed) / performanceCounterFrequency.QuadPart;
-            u64 framesPerSeconds =
-                performanceCounterFrequency.QuadPart / counterElapsed;
-            u64 megaCyclesPerFrame = cyclesElapsed / (1000 * 1000);
-
-            char8 printBuffer[KILOBYTES(1)];
-            sprintf(
-                printBuffer, "%llums/f | %lluf/s | %llumc/f | dt: %f\n",
-                msPerFrame, framesPerSeconds, megaCyclesPerFrame, deltaTime);
-            OutputDebugString(printBuffer);
-            lastCounter = endCounter;
-            lastCycleCount = endCycleCount;
-        }
+    if (overlayFont != NULL && overlayFont != font) {
+        Font_Destroy(overlayFont);
+    }
+
+    GLResourceRegistryFlush();
+
+    if (overlayText != NULL) {
+        free(overlayText);
     }
 
     WindowClose(window);
@@ -380,6 +621,10 @@ Entry(int argc, char *argv[])
 
     free(tilePositions);
     free(tileIsDisabled);
+
+    if (stressRectangles != NULL) {
+        free(stressRectangles);
+    }
 }
 
 static bool
@@ -412,3 +657,157 @@ GenerateTileGrid(
         }
     }
 }
+
+static void
+FrameRenderThreadBegin(void *parameter)
+{
+    FrameRenderer *renderer = parameter;
+    WindowSetContextCurrent(renderer->window, true);
+}
+
+static void
+FrameRenderThreadEnd(void *parameter)
+{
+    FrameRenderer *renderer = parameter;
+    WindowSetContextCurrent(renderer->window, false);
+}
+
+static void
+FrameRender(const void *snapshotData, u64 frameIndex, void *parameter)
+{
+    UNUSED(frameIndex);
+
+    const FrameSnapshot *snapshot = snapshotData;
+    FrameRenderer *renderer = parameter;
+    DrawContext *drawContext = renderer->drawContext;
+
+    if (renderer->pipeline != NULL) {
+        // NOTE(gr3yknigh1): Resize handler runs on main thread, which has no
+        // context in pipelined mode. [2025/11/23]
+        RectangleI32 viewportRect = WindowGetRectangle(renderer->window);
+        GL_CALL(glViewport(0, 0, viewportRect.width, viewportRect.height));
+    }
+
+    DrawBegin(drawContext);
+    DrawClear(drawContext, 0, 0, 0);
+
+    DrawRectanglesInstanced(
+        drawContext, snapshot->tileInstances, snapshot->tileInstanceCount);
+
+    if (snapshot->doRenderGridBackground) {
+        DrawRectangle(
+            drawContext, snapshot->gridRect.x, snapshot->gridRect.y,
+            snapshot->gridRect.width, snapshot->gridRect.height, 1, 0,
+            COLOR4RGBA_BLUE);
+    }
+
+    DrawRectangle(
+        drawContext, snapshot->playerRect.x, snapshot->playerRect.y,
+        snapshot->playerRect.width, snapshot->playerRect.height, 1, 0,
+        COLOR4RGBA_RED);
+
+    DrawRectangle(
+        drawContext, snapshot->ballRect.x, snapshot->ballRect.y,
+        snapshot->ballRect.width, snapshot->ballRect.height, 1, 0,
+        COLOR4RGBA_WHITE);
+
+    if (renderer->stressRectangles != NULL) {
+        for (u32 rectIndex = 0; rectIndex < STRESS_RECTANGLE_COUNT;
+             ++rectIndex) {
+            const RectangleF32 *rect = renderer->stressRectangles + rectIndex;
+            DrawRectangle(
+                drawContext, rect->x, rect->y, rect->width, rect->height, 1, 0,
+                rectIndex % 2 ? COLOR4RGBA_RED : COLOR4RGBA_BLUE);
+        }
+    }
+
+    DrawString(drawContext, 10, 20, "Hello sailor", 1, COLOR4RGBA_BLUE);
+
+    if (renderer->overlayText != NULL) {
+        RectangleI32 overlayRect = WindowGetRectangle(renderer->window);
+        Font *overlayFont = renderer->overlayFont;
+
+        DrawContext_SelectFont(drawContext, overlayFont);
+        DrawString(
+            drawContext, 4,
+            (f32)overlayRect.height -
+                (f32)overlayFont->lineHeight * renderer->overlayScale,
+            renderer->overlayText, renderer->overlayScale, COLOR4RGBA_WHITE);
+        DrawContext_SelectFont(drawContext, renderer->font);
+    }
+
+    DrawEnd(drawContext);
+
+    WindowUpdate(renderer->window);
+
+    ///< Perfomance
+    {
+        u64 endCycleCount = __rdtsc();
+
+        LARGE_INTEGER endCounter;
+        ASSERT_NONZERO(QueryPerformanceCounter(&endCounter));
+
+        // TODO(ilya.a): Display counter [2025/11/08]
+
+        u64 cyclesElapsed = endCycleCount - renderer->lastCycleCount;
+        LONGLONG counterElapsed =
+            endCounter.QuadPart - renderer->lastCounter.QuadPart;
+        LONGLONG counterFrequency =
+            renderer->performanceCounterFrequency.QuadPart;
+
+        u64 msPerFrame = (1000 * counterElapsed) / counterFrequency;
+        u64 framesPerSeconds = counterFrequency / counterElapsed;
+        u64 megaCyclesPerFrame = cyclesElapsed / (1000 * 1000);
+
+        GLStateCacheCounters stateCounters = GLStateCacheGetCounters();
+        GLStateCacheResetCounters();
+
+        GLRenderStats renderStats = GLRenderStatsGet();
+        GLRenderStatsResetFrame();
+
+        GLResourceRegistryUpdate();
+        GLResourceStats resourceStats = GLResourceRegistryGetStats();
+
+        const RenderQueueStats *queueStats = &drawContext->queue.stats;
+
+        char8 printBuffer[KILOBYTES(1)];
+        i32 printLength = sprintf(
+            printBuffer,
+            "%llums/f | %lluf/s | %llumc/f | dt: %f | draws: %u | "
+            "gl: %u draws, %llu tris, %lluB uploaded, %u objects "
+            "(%lluKiB) | "
+            "state: %llu issued, %llu skipped | "
+            "queue: %llu cmds, %llu -> %llu changes",
+            msPerFrame, framesPerSeconds, megaCyclesPerFrame,
+            snapshot->deltaTime, drawContext->drawCallCount,
+            renderStats.drawCallCount, renderStats.triangleCount,
+            renderStats.bufferUploadBytes + renderStats.textureUploadBytes,
+            renderStats.objectCounts[GL_RENDER_OBJECT_BUFFER] +
+                renderStats.objectCounts[GL_RENDER_OBJECT_TEXTURE] +
+                renderStats.objectCounts[GL_RENDER_OBJECT_VERTEX_ARRAY] +
+                renderStats.objectCounts[GL_RENDER_OBJECT_PROGRAM],
+            resourceStats.totalBytes / KILOBYTES(1),
+            stateCounters.issuedCount, stateCounters.skippedCount,
+            queueStats->commandCount, queueStats->stateChangesUnsorted,
+            queueStats->stateChangesSorted);
+
+        if (renderer->pipeline != NULL) {
+            FramePipelineStats pipelineStats =
+                FramePipelineGetStats(renderer->pipeline);
+            printLength += sprintf(
+                printBuffer + printLength,
+                " | pipeline: depth %u, sim %.2fms (wait %.2fms), "
+                "render %.2fms, overlap %.2fms, latency %.2fms",
+                pipelineStats.depth, pipelineStats.simulationMilliseconds,
+                pipelineStats.simulationWaitMilliseconds,
+                pipelineStats.renderMilliseconds,
+                pipelineStats.overlapMilliseconds,
+                pipelineStats.latencyMilliseconds);
+        }
+
+        sprintf(printBuffer + printLength, "\n");
+        OutputDebugString(printBuffer);
+        renderer->lastCounter = endCounter;
+        renderer->lastCycleCount = endCycleCount;
+    }
+}
@@ -7,6 +7,7 @@
 
 #include <ft2build.h>
 #include FT_FREETYPE_H // WTF?
+#include FT_MODULE_H
 
 #include <glad/glad.h>
 
@@ -15,7 +16,12 @@
 #include <cglm/mat4.h>
 #include <cglm/affine.h>
 
+#include <stdlib.h> // malloc, calloc, free, qsort
+
+#include <gfs/atlas.h>
 #include <gfs/macros.h>
+#include <gfs/memory.h>
+#include <gfs/static_assert.h>
 #include <gfs/types.h>
 #include <gfs/assert.h>
 
@@ -140,95 +146,488 @@ Camera_GetProjectionMatix(Camera *camera, mat4 *projection)
     }
 }
 
-static FT_Library gFreeTypeLibrary;
-static bool gFreeTypeLibraryWasInitialized = false;
+/*
+ * @breaf Glyph bitmap, which waits to be packed into font atlas.
+ */
+typedef struct {
+    u32 glyphIndex;
+    u32 width;
+    u32 height;
+    byte *pixels;
+} FontGlyphBitmap;
 
-Font *
-Font_Make(cstring8 fontPath, u32 pixelWidth, u32 pixelHeight)
+#define FONT_ATLAS_PADDING EXPAND(1)
+#define FONT_ATLAS_INITIAL_SIZE EXPAND(256)
+#define FONT_ATLAS_MAX_SIZE EXPAND(8192)
+
+#define FONT_MAX_WORKERS EXPAND(8)
+#define FONT_MIN_GLYPHS_PER_WORKER EXPAND(16)
+
+static int
+FontGlyphBitmapCompareByHeight(const void *a, const void *b)
+{
+    const FontGlyphBitmap *bitmapA = a;
+    const FontGlyphBitmap *bitmapB = b;
+
+    // NOTE(gr3yknigh1): Tallest first. Skyline packs a lot tighter this way.
+    // [2025/11/15]
+    if (bitmapA->height != bitmapB->height) {
+        return bitmapA->height < bitmapB->height ? 1 : -1;
+    }
+    return (int)bitmapA->glyphIndex - (int)bitmapB->glyphIndex;
+}
+
+/*
+ * @breaf Tries to pack all bitmaps into atlas of given size.
+ *
+ * @return `false` if some of bitmaps doesn't fit.
+ */
+static bool
+FontPackGlyphBitmaps(
+    FontGlyphBitmap *bitmaps, u32 bitmapsCount, Vector2U32 *positions,
+    u32 atlasWidth, u32 atlasHeight)
+{
+    Scratch scratch = ScratchMake(sizeof(SkylineNode) * atlasWidth);
+    SkylinePacker packer = SkylinePackerMake(&scratch, atlasWidth, atlasHeight);
+
+    bool isPacked = true;
+
+    for (u32 bitmapIndex = 0; bitmapIndex < bitmapsCount; ++bitmapIndex) {
+        FontGlyphBitmap *bitmap = bitmaps + bitmapIndex;
+
+        if (bitmap->width == 0 || bitmap->height == 0) {
+            positions[bitmapIndex].x = 0;
+            positions[bitmapIndex].y = 0;
+            continue;
+        }
+
+        if (!SkylinePackerPack(
+                &packer, bitmap->width + FONT_ATLAS_PADDING,
+                bitmap->height + FONT_ATLAS_PADDING,
+                positions + bitmapIndex)) {
+            isPacked = false;
+            break;
+        }
+    }
+
+    ScratchDestroy(&scratch);
+    return isPacked;
+}
+
+/*
+ * @breaf Shared state of font glyph generation. Workers take codepoints one
+ * by one, so there is no need in splitting work ahead of time.
+ */
+typedef struct {
+    cstring8 fontPath;
+    u32 pixelWidth;
+    u32 pixelHeight;
+    FontRasterMode rasterMode;
+
+    const u32 *codepoints;
+    u32 codepointsCount;
+    volatile u32 nextCodepointIndex;
+
+    // NOTE(gr3yknigh1): All of these have one slot per codepoint, so workers
+    // never write to the same memory. [2025/11/15]
+    Glyph *glyphs;
+    FontGlyphBitmap *bitmaps;
+    bool *isGlyphPresent;
+} FontBuildContext;
+
+typedef struct {
+    FontBuildContext *context;
+    u32 lineHeight;
+} FontBuildWorker;
+
+/*
+ * @breaf Loads and rasterizes glyphs until codepoints run out.
+ *
+ * NOTE(gr3yknigh1): FreeType objects can't be shared between threads, so every
+ * worker opens library and face on it's own. [2025/11/15]
+ */
+static void
+FontBuildWorkerProc(void *parameter)
 {
-    if (!gFreeTypeLibraryWasInitialized) {
-        gFreeTypeLibrary = EMPTY_STRUCT(FT_Library);
-        ASSERT_ISOK(FT_Init_FreeType(&gFreeTypeLibrary));
+    FontBuildWorker *worker = parameter;
+    FontBuildContext *context = worker->context;
+
+    FT_Library library = EMPTY_STRUCT(FT_Library);
+    ASSERT_ISOK(FT_Init_FreeType(&library));
 
-        gFreeTypeLibraryWasInitialized = true;
+    if (context->rasterMode == FONT_RASTER_MODE_SDF) {
+        FT_Int spread = FONT_SDF_SPREAD;
+        ASSERT_ISOK(FT_Property_Set(library, "sdf", "spread", &spread));
     }
 
     FT_Face face = EMPTY_STRUCT(FT_Face);
-    ASSERT_ISOK(FT_New_Face(gFreeTypeLibrary, fontPath, 0, &face));
-    ASSERT_ISOK(FT_Set_Pixel_Sizes(face, pixelWidth, pixelHeight));
+    ASSERT_ISOK(FT_New_Face(library, context->fontPath, 0, &face));
+    ASSERT_ISOK(
+        FT_Set_Pixel_Sizes(face, context->pixelWidth, context->pixelHeight));
+
+    worker->lineHeight = face->size->metrics.height >> 6;
+
+    for (;;) {
+        u32 codepointIndex =
+            AtomicFetchAddU32(&context->nextCodepointIndex, 1);
+
+        if (codepointIndex >= context->codepointsCount) {
+            break;
+        }
+
+        u32 codepoint = context->codepoints[codepointIndex];
+
+        if (FT_Get_Char_Index(face, codepoint) == 0) {
+            continue; // Font doesn't have this glyph.
+        }
+
+        if (context->rasterMode == FONT_RASTER_MODE_SDF) {
+            ASSERT_ISOK(FT_Load_Char(face, codepoint, FT_LOAD_DEFAULT));
+
+            // NOTE(gr3yknigh1): Glyphs without contours (space) have nothing
+            // to render. [2025/11/15]
+            if (face->glyph->format == FT_GLYPH_FORMAT_OUTLINE &&
+                face->glyph->outline.n_contours > 0) {
+                ASSERT_ISOK(
+                    FT_Render_Glyph(face->glyph, FT_RENDER_MODE_SDF));
+            }
+        } else {
+            ASSERT_ISOK(FT_Load_Char(face, codepoint, FT_LOAD_RENDER));
+        }
+
+        const FT_Bitmap *ftBitmap = &face->glyph->bitmap;
+
+        Glyph *glyph = context->glyphs + codepointIndex;
+        glyph->codepoint = codepoint;
+        glyph->size.x = ftBitmap->width;
+        glyph->size.y = ftBitmap->rows;
+        glyph->bearing.x = face->glyph->bitmap_left;
+        glyph->bearing.y = face->glyph->bitmap_top;
+        glyph->xAdvance = face->glyph->advance.x;
+
+        FontGlyphBitmap *bitmap = context->bitmaps + codepointIndex;
+        bitmap->width = ftBitmap->width;
+        bitmap->height = ftBitmap->rows;
+
+        if (bitmap->width > 0 && bitmap->height > 0) {
+            bitmap->pixels = malloc(bitmap->width * bitmap->height);
+            ASSERT_NONNULL(bitmap->pixels);
+
+            // NOTE(gr3yknigh1): Pitch might be larger than width.
+            // [2025/11/15]
+            for (u32 row = 0; row < bitmap->height; ++row) {
+                MemoryCopy(
+                    bitmap->pixels + row * bitmap->width,
+                    ftBitmap->buffer + row * ftBitmap->pitch, bitmap->width);
+            }
+        }
 
-    static const char8 firstASCIIAlpha = 'A';
-    static const char8 lastASCIIAlpha = 'z';
+        context->isGlyphPresent[codepointIndex] = true;
+    }
+
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+}
+
+static const FontCodepointRange gFontDefaultRanges[] = {
+    {FONT_DEFAULT_CODEPOINT_FIRST, FONT_DEFAULT_CODEPOINT_LAST},
+};
+
+Font *
+Font_Make(cstring8 fontPath, u32 pixelWidth, u32 pixelHeight)
+{
+    return Font_MakeEx(
+        fontPath, pixelWidth, pixelHeight, gFontDefaultRanges,
+        STATIC_ARRAY_LENGTH(gFontDefaultRanges), FONT_RASTER_MODE_BITMAP);
+}
+
+Font *
+Font_MakeSDF(cstring8 fontPath, u32 pixelHeight)
+{
+    return Font_MakeEx(
+        fontPath, 0, pixelHeight, gFontDefaultRanges,
+        STATIC_ARRAY_LENGTH(gFontDefaultRanges), FONT_RASTER_MODE_SDF);
+}
+
+Font *
+Font_MakeEx(
+    cstring8 fontPath, u32 pixelWidth, u32 pixelHeight,
+    const FontCodepointRange *ranges, u32 rangesCount,
+    FontRasterMode rasterMode)
+{
+    ASSERT_NONNULL(ranges);
+    ASSERT_NONZERO(rangesCount);
+
+    u32 codepointsCount = 0;
+    for (u32 rangeIndex = 0; rangeIndex < rangesCount; ++rangeIndex) {
+        ASSERT_ISTRUE(ranges[rangeIndex].first <= ranges[rangeIndex].last);
+
+        if (rangeIndex > 0) {
+            ASSERT_ISTRUE(
+                ranges[rangeIndex - 1].last < ranges[rangeIndex].first);
+        }
+
+        codepointsCount +=
+            ranges[rangeIndex].last - ranges[rangeIndex].first + 1;
+    }
 
     Font *font = malloc(sizeof(Font));
-    font->glyphsCount = lastASCIIAlpha - firstASCIIAlpha; // XXX
-    font->glyphs = calloc(font->glyphsCount, sizeof(Glyph));
+    ASSERT_NONNULL(font);
 
+    font->glyphsCount = 0;
+    font->glyphs = calloc(codepointsCount, sizeof(Glyph));
+    ASSERT_NONNULL(font->glyphs);
+
+    font->rangesCount = rangesCount;
+    font->ranges = malloc(sizeof(FontCodepointRange) * rangesCount);
+    ASSERT_NONNULL(font->ranges);
+    MemoryCopy(
+        font->ranges, ranges, sizeof(FontCodepointRange) * rangesCount);
+
+    font->rasterMode = rasterMode;
+    font->sdfSpread = rasterMode == FONT_RASTER_MODE_SDF ? FONT_SDF_SPREAD : 0;
     font->pixelWidth = pixelWidth;
     font->pixelHeight = pixelHeight;
 
     // --- FreeType character loading ---
-    Glyph *glyphWriteCursor = font->glyphs;
 
-    glPixelStorei(
-        GL_UNPACK_ALIGNMENT, 1); // Disable byte-alignment restriction.
+    FontBuildContext buildContext = EMPTY_STRUCT(FontBuildContext);
+    buildContext.fontPath = fontPath;
+    buildContext.pixelWidth = pixelWidth;
+    buildContext.pixelHeight = pixelHeight;
+    buildContext.rasterMode = rasterMode;
+    buildContext.codepointsCount = codepointsCount;
+    buildContext.nextCodepointIndex = 0;
+
+    u32 *codepoints = malloc(sizeof(u32) * codepointsCount);
+    ASSERT_NONNULL(codepoints);
+    buildContext.codepoints = codepoints;
+
+    for (u32 rangeIndex = 0, codepointIndex = 0; rangeIndex < rangesCount;
+         ++rangeIndex) {
+        for (u32 codepoint = ranges[rangeIndex].first;
+             codepoint <= ranges[rangeIndex].last; ++codepoint) {
+            codepoints[codepointIndex++] = codepoint;
+        }
+    }
 
-    for (char8 c = firstASCIIAlpha; c < lastASCIIAlpha; ++c) {
-        ASSERT_ISOK(FT_Load_Char(face, c, FT_LOAD_RENDER));
+    buildContext.glyphs = font->glyphs;
+    buildContext.bitmaps = calloc(codepointsCount, sizeof(FontGlyphBitmap));
+    ASSERT_NONNULL(buildContext.bitmaps);
+    buildContext.isGlyphPresent = calloc(codepointsCount, sizeof(bool));
+    ASSERT_NONNULL(buildContext.isGlyphPresent);
 
-        GL_CALL(glGenTextures(1, &glyphWriteCursor->texture));
-        GL_CALL(glBindTexture(GL_TEXTURE_2D, glyphWriteCursor->texture));
+    u32 workersCount = GetProcessorCount();
+    if (workersCount > FONT_MAX_WORKERS) {
+        workersCount = FONT_MAX_WORKERS;
+    }
 
-        GL_CALL(glTexImage2D(
-            GL_TEXTURE_2D, 0, GL_RED, face->glyph->bitmap.width,
-            face->glyph->bitmap.rows, 0, GL_RED, GL_UNSIGNED_BYTE,
-            face->glyph->bitmap.buffer));
+    u32 workersNeeded = (codepointsCount + FONT_MIN_GLYPHS_PER_WORKER - 1) /
+                        FONT_MIN_GLYPHS_PER_WORKER;
+    if (workersCount > workersNeeded) {
+        workersCount = workersNeeded;
+    }
+    if (workersCount == 0) {
+        workersCount = 1;
+    }
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    FontBuildWorker workers[FONT_MAX_WORKERS];
+    Thread *threads[FONT_MAX_WORKERS];
 
-        glyphWriteCursor->size.x = face->glyph->bitmap.width;
-        glyphWriteCursor->size.y = face->glyph->bitmap.rows;
-        glyphWriteCursor->bearing.x = face->glyph->bitmap_left;
-        glyphWriteCursor->bearing.y = face->glyph->bitmap_top;
-        glyphWriteCursor->xAdvance = face->glyph->advance.x;
+    Scratch threadScratch = ScratchMake(KILOBYTES(4));
 
-        ++glyphWriteCursor;
+    // NOTE(gr3yknigh1): Calling thread is the worker #0. [2025/11/15]
+    for (u32 workerIndex = 0; workerIndex < workersCount; ++workerIndex) {
+        workers[workerIndex].context = &buildContext;
+        workers[workerIndex].lineHeight = 0;
+
+        if (workerIndex > 0) {
+            threads[workerIndex] = ThreadCreate(
+                &threadScratch, FontBuildWorkerProc, workers + workerIndex);
+            ASSERT_NONNULL(threads[workerIndex]);
+        }
     }
 
-    FT_Done_Face(face);
+    FontBuildWorkerProc(workers + 0);
+
+    for (u32 workerIndex = 1; workerIndex < workersCount; ++workerIndex) {
+        ThreadJoin(threads[workerIndex]);
+    }
+
+    ScratchDestroy(&threadScratch);
+
+    font->lineHeight = workers[0].lineHeight;
+
+    // NOTE(gr3yknigh1): Drop codepoints, which font doesn't have. Order is
+    // kept, so glyphs stay sorted by codepoint. [2025/11/15]
+    FontGlyphBitmap *bitmaps = buildContext.bitmaps;
+    usize pixelsTotal = 0;
+
+    for (u32 codepointIndex = 0; codepointIndex < codepointsCount;
+         ++codepointIndex) {
+        if (!buildContext.isGlyphPresent[codepointIndex]) {
+            continue;
+        }
+
+        usize glyphIndex = font->glyphsCount;
+
+        font->glyphs[glyphIndex] = font->glyphs[codepointIndex];
+        bitmaps[glyphIndex] = bitmaps[codepointIndex];
+        bitmaps[glyphIndex].glyphIndex = (u32)glyphIndex;
+
+        if (bitmaps[glyphIndex].pixels != NULL) {
+            pixelsTotal += (bitmaps[glyphIndex].width + FONT_ATLAS_PADDING) *
+                           (bitmaps[glyphIndex].height + FONT_ATLAS_PADDING);
+        }
+
+        ++font->glyphsCount;
+    }
+
+    free(buildContext.isGlyphPresent);
+    free(codepoints);
+
+    // --- Packing ---
+
+    qsort(
+        bitmaps, font->glyphsCount, sizeof(FontGlyphBitmap),
+        FontGlyphBitmapCompareByHeight);
+
+    Vector2U32 *positions = calloc(font->glyphsCount, sizeof(Vector2U32));
+    ASSERT_NONNULL(positions);
+
+    u32 atlasWidth = FONT_ATLAS_INITIAL_SIZE;
+    u32 atlasHeight = FONT_ATLAS_INITIAL_SIZE;
+
+    // NOTE(gr3yknigh1): No point in trying sizes, which can't hold all
+    // pixels. [2025/11/15]
+    while ((usize)atlasWidth * atlasHeight < pixelsTotal) {
+        if (atlasWidth <= atlasHeight) {
+            atlasWidth *= 2;
+        } else {
+            atlasHeight *= 2;
+        }
+    }
+
+    while (!FontPackGlyphBitmaps(
+        bitmaps, font->glyphsCount, positions, atlasWidth, atlasHeight)) {
+        if (atlasWidth <= atlasHeight) {
+            atlasWidth *= 2;
+        } else {
+            atlasHeight *= 2;
+        }
+
+        ASSERT_ISTRUE(
+            atlasWidth <= FONT_ATLAS_MAX_SIZE &&
+            atlasHeight <= FONT_ATLAS_MAX_SIZE);
+    }
+
+    font->atlasWidth = atlasWidth;
+    font->atlasHeight = atlasHeight;
+
+    byte *atlasPixels = calloc((usize)atlasWidth * atlasHeight, sizeof(byte));
+    ASSERT_NONNULL(atlasPixels);
+
+    for (u32 bitmapIndex = 0; bitmapIndex < font->glyphsCount;
+         ++bitmapIndex) {
+        FontGlyphBitmap *bitmap = bitmaps + bitmapIndex;
+        Vector2U32 position = positions[bitmapIndex];
+        Glyph *glyph = font->glyphs + bitmap->glyphIndex;
+
+        for (u32 row = 0; row < bitmap->height; ++row) {
+            MemoryCopy(
+                atlasPixels + (position.y + row) * atlasWidth + position.x,
+                bitmap->pixels + row * bitmap->width, bitmap->width);
+        }
+
+        glyph->uvMin[0] = (f32)position.x / (f32)atlasWidth;
+        glyph->uvMin[1] = (f32)position.y / (f32)atlasHeight;
+        glyph->uvMax[0] = (f32)(position.x + bitmap->width) / (f32)atlasWidth;
+        glyph->uvMax[1] =
+            (f32)(position.y + bitmap->height) / (f32)atlasHeight;
+
+        if (bitmap->pixels != NULL) {
+            free(bitmap->pixels);
+        }
+    }
+
+    // --- Upload ---
+
+    GL_CALL(glPixelStorei(
+        GL_UNPACK_ALIGNMENT, 1)); // Disable byte-alignment restriction.
+
+    GL_CALL(glGenTextures(1, &font->atlasTexture));
+    GLResourceRegister(
+        GL_RENDER_OBJECT_TEXTURE, font->atlasTexture,
+        (usize)atlasWidth * atlasHeight);
+    GLBindTexture(0, GL_TEXTURE_2D, font->atlasTexture);
+
+    GL_CALL(glTexImage2D(
+        GL_TEXTURE_2D, 0, GL_RED, atlasWidth, atlasHeight, 0, GL_RED,
+        GL_UNSIGNED_BYTE, atlasPixels));
+    GLRenderStatsRecordTextureUpload((usize)atlasWidth * atlasHeight);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    free(atlasPixels);
+    free(positions);
+    free(bitmaps);
 
     return font;
 }
 
+const Glyph *
+Font_FindGlyph(const Font *font, u32 codepoint)
+{
+    // NOTE(gr3yknigh1): Ranges are sorted and don't overlap (checked in
+    // `Font_MakeEx`), so glyphs are sorted by codepoint. [2025/11/15]
+    usize low = 0;
+    usize high = font->glyphsCount;
+
+    while (low < high) {
+        usize middle = low + (high - low) / 2;
+
+        if (font->glyphs[middle].codepoint < codepoint) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    if (low < font->glyphsCount && font->glyphs[low].codepoint == codepoint) {
+        return font->glyphs + low;
+    }
+
+    return NULL;
+}
+
 void
 Font_Destroy(Font *font)
 {
+    if (font->atlasTexture != 0) {
+        GLTextureDestroy(font->atlasTexture);
+        font->atlasTexture = 0;
+    }
+
     if (font->glyphs != NULL) {
         free(font->glyphs);
         font->glyphs = NULL;
     }
 
+    if (font->ranges != NULL) {
+        free(font->ranges);
+        font->ranges = NULL;
+    }
+
     free(font);
 }
 
-typedef struct {
-    f32 position[2];
-    f32 color[3];
-} Vertex;
-
-// static const Vertex RECTANGLE_VERTEXES[] = {
-//     { { 1, 1 }, { 1, 1, 1 } }, // top-right
-//     { { 1, 0 }, { 1, 1, 1 } }, // bottom-right
-//     { { 0, 0 }, { 1, 1, 1 } }, // bottom-left
-//     { { 0, 1 }, { 1, 1, 1 } }, // top-left
-// };
-
 static void
 GenerateRectangleVertexes(
-    Vertex *vertexes, f32 x, f32 y, f32 width, f32 height, Color3RGB color)
+    RectangleVertex *vertexes, f32 x, f32 y, f32 width, f32 height,
+    Color3RGB color)
 {
     // top-right
     vertexes[0].position[0] = x + width;
@@ -263,35 +662,155 @@ GenerateRectangleVertexes(
     vertexes[3].color[2] = color.b;
 }
 
-#if 0
-static const u32 RECTANGLE_INDICIES[] = {0, 1, 2, 0, 2, 3};
-#endif
+typedef enum {
+    DRAW_PASS_GEOMETRY = 0,
+    DRAW_PASS_TEXT = 1,
+} DrawPass;
+
+/*
+ * @breaf Uploads vertexes of all batches with one call per batch and executes
+ * recorded commands. Quads, which aren't recorded yet, are moved to the
+ * beginning of the storage.
+ */
+static void
+DrawSubmit(DrawContext *ctx)
+{
+    if (ctx->rectDrawInfo.quadCount > 0) {
+        GLVertexBufferSendData(
+            &ctx->rectDrawInfo.vb, ctx->rectDrawInfo.vertexes,
+            sizeof(RectangleVertex) * 4 * ctx->rectDrawInfo.quadCount);
+    }
+
+    if (ctx->textDrawInfo.quadCount > 0) {
+        GLVertexBufferSendData(
+            &ctx->textDrawInfo.vb, ctx->textDrawInfo.vertexes,
+            sizeof(TextVertex) * 4 * ctx->textDrawInfo.quadCount);
+    }
+
+    RenderQueueSubmit(&ctx->queue, NULL);
+    ctx->rectInstancedDrawInfo.isRecorded = false;
+
+    // NOTE(gr3yknigh1): `MemoryCopy` copies forward, so it's fine for
+    // overlapping ranges when destination is before source. [2025/11/16]
+    u32 rectPendingCount =
+        ctx->rectDrawInfo.quadCount - ctx->rectDrawInfo.quadFirst;
+    MemoryCopy(
+        ctx->rectDrawInfo.vertexes,
+        ctx->rectDrawInfo.vertexes + 4 * ctx->rectDrawInfo.quadFirst,
+        sizeof(RectangleVertex) * 4 * rectPendingCount);
+    ctx->rectDrawInfo.quadFirst = 0;
+    ctx->rectDrawInfo.quadCount = rectPendingCount;
+
+    u32 textPendingCount =
+        ctx->textDrawInfo.quadCount - ctx->textDrawInfo.quadFirst;
+    MemoryCopy(
+        ctx->textDrawInfo.vertexes,
+        ctx->textDrawInfo.vertexes + 4 * ctx->textDrawInfo.quadFirst,
+        sizeof(TextVertex) * 4 * textPendingCount);
+    ctx->textDrawInfo.quadFirst = 0;
+    ctx->textDrawInfo.quadCount = textPendingCount;
+}
+
+/*
+ * @breaf Records quads of rectangle batch as one command.
+ */
+static void
+DrawFlushRectangles(DrawContext *ctx)
+{
+    if (ctx->rectDrawInfo.quadCount == ctx->rectDrawInfo.quadFirst) {
+        return;
+    }
+
+    if (RenderQueueIsFull(&ctx->queue)) {
+        DrawSubmit(ctx);
+    }
+
+    GLShaderProgramID shader = ctx->rectDrawInfo.shader;
+
+    RenderCommand *command = RenderQueuePush(
+        &ctx->queue, RenderSortKeyMake(DRAW_PASS_GEOMETRY, shader, 0, 0));
+    command->shader = shader;
+    command->vertexArray = ctx->rectDrawInfo.va;
+    command->elementBuffer = ctx->rectDrawInfo.eb.id;
+    command->firstElement = 6 * ctx->rectDrawInfo.quadFirst;
+    command->elementCount =
+        6 * (ctx->rectDrawInfo.quadCount - ctx->rectDrawInfo.quadFirst);
+
+    ctx->rectDrawInfo.quadFirst = ctx->rectDrawInfo.quadCount;
+    ++ctx->drawCallCount;
+}
+
+/*
+ * @breaf Records quads of text batch as one command, which samples atlas of
+ * batch font.
+ */
+static void
+DrawFlushText(DrawContext *ctx)
+{
+    if (ctx->textDrawInfo.quadCount == ctx->textDrawInfo.quadFirst) {
+        return;
+    }
+
+    if (RenderQueueIsFull(&ctx->queue)) {
+        DrawSubmit(ctx);
+    }
+
+    GLShaderProgramID shader =
+        ctx->textDrawInfo.batchFont->rasterMode == FONT_RASTER_MODE_SDF
+            ? ctx->textDrawInfo.sdfShader
+            : ctx->textDrawInfo.shader;
+    GLTexture atlasTexture = ctx->textDrawInfo.batchFont->atlasTexture;
+
+    RenderCommand *command = RenderQueuePush(
+        &ctx->queue,
+        RenderSortKeyMake(DRAW_PASS_TEXT, shader, atlasTexture, 0));
+    command->shader = shader;
+    command->textureTarget = GL_TEXTURE_2D;
+    command->texture = atlasTexture;
+    command->vertexArray = ctx->textDrawInfo.va;
+    command->elementBuffer = ctx->textDrawInfo.eb.id;
+    command->firstElement = 6 * ctx->textDrawInfo.quadFirst;
+    command->elementCount =
+        6 * (ctx->textDrawInfo.quadCount - ctx->textDrawInfo.quadFirst);
+
+    ctx->textDrawInfo.quadFirst = ctx->textDrawInfo.quadCount;
+    ++ctx->drawCallCount;
+}
 
 DrawContext
 DrawContext_MakeEx(
     Scratch *scratch, Camera *camera, GLShaderProgramID rectangleShader,
-    GLShaderProgramID textShader)
+    GLShaderProgramID rectangleInstancedShader, GLShaderProgramID textShader,
+    GLShaderProgramID textSDFShader)
 {
     DrawContext context = EMPTY_STRUCT(DrawContext);
 
-    GL_CALL(glEnable(GL_BLEND));
-    GL_CALL(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
-    GL_CALL(glEnable(GL_DEPTH_TEST));
-    GL_CALL(glPolygonMode(GL_FRONT_AND_BACK, GL_FILL));
+    GLSetCapability(GL_BLEND, true);
+    GLBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    GLSetCapability(GL_DEPTH_TEST, true);
+    GLPolygonMode(GL_FILL);
 
     context.camera = camera;
+    context.isBatchingEnabled = true;
+    context.queue = RenderQueueMake(scratch, DRAW_QUEUE_CAPACITY);
 
     // ---- Rect rendering ---- //
 
+    context.cameraBuffer = GLUniformBufferMake(NULL, sizeof(GLCameraBlock));
+
     context.rectDrawInfo.shader = rectangleShader;
-    context.rectDrawInfo.uniformLocationModel =
-        GLShaderFindUniformLocation(rectangleShader, "u_Model");
-    context.rectDrawInfo.uniformLocationProjection =
-        GLShaderFindUniformLocation(rectangleShader, "u_Projection");
+
+    context.rectDrawInfo.quadCapacity = RECTANGLE_BATCH_CAPACITY;
+    context.rectDrawInfo.quadCount = 0;
+    context.rectDrawInfo.vertexes = ScratchAlloc(
+        scratch,
+        sizeof(RectangleVertex) * 4 * context.rectDrawInfo.quadCapacity);
+    ASSERT_NONNULL(context.rectDrawInfo.vertexes);
 
     context.rectDrawInfo.va = GLVertexArrayMake();
     context.rectDrawInfo.vb = GLVertexBufferMake(NULL, 0);
-    context.rectDrawInfo.eb = GLElementBufferMake(NULL, 0);
+    context.rectDrawInfo.eb =
+        GLElementBufferMakeQuads(scratch, context.rectDrawInfo.quadCapacity);
     context.rectDrawInfo.layout = GLVertexBufferLayoutMake(scratch);
     GLVertexBufferLayoutPushAttributeF32(&context.rectDrawInfo.layout, 2);
     GLVertexBufferLayoutPushAttributeF32(&context.rectDrawInfo.layout, 3);
@@ -299,41 +818,83 @@ DrawContext_MakeEx(
         context.rectDrawInfo.va, &context.rectDrawInfo.vb,
         &context.rectDrawInfo.layout);
 
-    // ---- Text rendering ----
+    // ---- Instanced rect rendering ---- //
 
-    // --- Setup OpenGL buffers for characters ---
+    static const f32 unitQuadVertexes[] = {
+        1, 1, // top-right
+        1, 0, // bottom-right
+        0, 0, // bottom-left
+        0, 1, // top-left
+    };
+    static const u32 unitQuadIndicies[] = {0, 1, 2, 0, 2, 3};
+
+    context.rectInstancedDrawInfo.shader = rectangleInstancedShader;
+
+    context.rectInstancedDrawInfo.va = GLVertexArrayMake();
+    context.rectInstancedDrawInfo.vb =
+        GLVertexBufferMake(unitQuadVertexes, sizeof(unitQuadVertexes));
+    context.rectInstancedDrawInfo.layout = GLVertexBufferLayoutMake(scratch);
+    GLVertexBufferLayoutPushAttributeF32(
+        &context.rectInstancedDrawInfo.layout, 2);
+    GLVertexArrayAddBuffer(
+        context.rectInstancedDrawInfo.va, &context.rectInstancedDrawInfo.vb,
+        &context.rectInstancedDrawInfo.layout);
+
+    context.rectInstancedDrawInfo.ib = GLInstanceBufferMake(NULL, 0, 0);
+    context.rectInstancedDrawInfo.instanceLayout =
+        GLVertexBufferLayoutMakeEx(scratch, 1);
+    GLVertexBufferLayoutPushAttributeF32(
+        &context.rectInstancedDrawInfo.instanceLayout, 2); // position
+    GLVertexBufferLayoutPushAttributeF32(
+        &context.rectInstancedDrawInfo.instanceLayout, 2); // size
+    GLVertexBufferLayoutPushAttributeF32(
+        &context.rectInstancedDrawInfo.instanceLayout, 3); // color
+    GLVertexArrayAddInstanceBuffer(
+        context.rectInstancedDrawInfo.va, &context.rectInstancedDrawInfo.ib,
+        &context.rectInstancedDrawInfo.instanceLayout,
+        context.rectInstancedDrawInfo.layout.attributesCount);
+
+    context.rectInstancedDrawInfo.eb = GLElementBufferMake(
+        unitQuadIndicies, STATIC_ARRAY_LENGTH(unitQuadIndicies));
+
+    // ---- Text rendering ----
 
     context.textDrawInfo.shader = textShader;
 
+    context.textDrawInfo.quadCapacity = TEXT_BATCH_CAPACITY;
+    context.textDrawInfo.quadCount = 0;
+    context.textDrawInfo.vertexes = ScratchAlloc(
+        scratch, sizeof(TextVertex) * 4 * context.textDrawInfo.quadCapacity);
+    ASSERT_NONNULL(context.textDrawInfo.vertexes);
+
+    // NOTE(gr3yknigh1): Quad indexes are the same for any vertex format, so
+    // text reuses element buffer of rectangles. [2025/11/15]
+    STATIC_ASSERT(TEXT_BATCH_CAPACITY <= RECTANGLE_BATCH_CAPACITY);
+
     context.textDrawInfo.va = GLVertexArrayMake();
-    context.textDrawInfo.vb = GLVertexBufferMake(NULL, sizeof(f32) * 6 * 4);
-    //                                                              /___/
-    // NOTE(gr3yknigh1): 6 - Count of vertexes, 4 - size of vertex /
-    // [2024/10/30]
+    context.textDrawInfo.vb = GLVertexBufferMake(NULL, 0);
+    context.textDrawInfo.eb = context.rectDrawInfo.eb;
 
     context.textDrawInfo.layout = GLVertexBufferLayoutMake(scratch);
-    GLVertexBufferLayoutPushAttributeF32(&context.textDrawInfo.layout, 2);
-    GLVertexBufferLayoutPushAttributeF32(&context.textDrawInfo.layout, 2);
+    GLVertexBufferLayoutPushAttributeF32(
+        &context.textDrawInfo.layout, 2); // position
+    GLVertexBufferLayoutPushAttributeF32(&context.textDrawInfo.layout, 2); // uv
+    GLVertexBufferLayoutPushAttributeF32(
+        &context.textDrawInfo.layout, 3); // color
 
     GLVertexArrayAddBuffer(
         context.textDrawInfo.va, &context.textDrawInfo.vb,
         &context.textDrawInfo.layout);
 
-    // TODO(gr3yknigh1): Destroy shaders after they are linked [2024/09/15]
+    context.textDrawInfo.sdfShader = textSDFShader;
 
-    GL_CALL(glUseProgram(context.textDrawInfo.shader));
+    GLUniformName textureName = GLUniformNameIntern("u_Texture");
 
-    context.textDrawInfo.uniformLocationColor =
-        GLShaderFindUniformLocation(textShader, "u_Color");
-    context.textDrawInfo.uniformLocationTexture =
-        GLShaderFindUniformLocation(textShader, "u_Texture");
-    context.textDrawInfo.uniformLocationProjection =
-        GLShaderFindUniformLocation(textShader, "u_Projection");
-
-    GLShaderSetUniformV3F32(
-        textShader, context.textDrawInfo.uniformLocationColor, 1, 1, 1);
     GLShaderSetUniformI32(
-        textShader, context.textDrawInfo.uniformLocationTexture, 0);
+        textShader, GLShaderGetUniformLocation(textShader, textureName), 0);
+    GLShaderSetUniformI32(
+        textSDFShader, GLShaderGetUniformLocation(textSDFShader, textureName),
+        0);
 
     return context;
 }
@@ -347,30 +908,36 @@ DrawContext_SelectFont(DrawContext *context, Font *font)
 void
 DrawBegin(DrawContext *ctx)
 {
-    glm_mat4_copy(GLM_MAT4_IDENTITY, ctx->model);
-    Camera_GetProjectionMatix(ctx->camera, &ctx->projection);
-
-    GLShaderProgramID rectShader = ctx->rectDrawInfo.shader;
-    GL_CALL(glUseProgram(rectShader));
+    ctx->drawCallCount = 0;
+    ctx->rectDrawInfo.quadFirst = 0;
+    ctx->rectDrawInfo.quadCount = 0;
+    ctx->textDrawInfo.quadFirst = 0;
+    ctx->textDrawInfo.quadCount = 0;
+    RenderQueueResetStats(&ctx->queue);
 
-    GLShaderSetUniformM4F32(
-        rectShader, ctx->rectDrawInfo.uniformLocationModel, (f32 *)ctx->model);
-    GLShaderSetUniformM4F32(
-        rectShader, ctx->rectDrawInfo.uniformLocationProjection,
-        (f32 *)ctx->projection);
-
-    GLShaderProgramID textShader = ctx->textDrawInfo.shader;
-    GL_CALL(glUseProgram(textShader));
+    Camera_GetProjectionMatix(ctx->camera, &ctx->projection);
 
-    GLShaderSetUniformM4F32(
-        textShader, ctx->textDrawInfo.uniformLocationProjection,
-        (f32 *)ctx->projection);
+    GLCameraBlock cameraBlock = EMPTY_STRUCT(GLCameraBlock);
+    MemoryCopy(cameraBlock.view, GLM_MAT4_IDENTITY, sizeof(cameraBlock.view));
+    MemoryCopy(
+        cameraBlock.projection, ctx->projection,
+        sizeof(cameraBlock.projection));
+    // NOTE(gr3yknigh1): Breakout has no view transform. [2025/11/16]
+    MemoryCopy(
+        cameraBlock.viewProjection, ctx->projection,
+        sizeof(cameraBlock.viewProjection));
+
+    GLUniformBufferSendData(
+        &ctx->cameraBuffer, &cameraBlock, sizeof(cameraBlock));
+    GLUniformBufferBind(&ctx->cameraBuffer, GL_UNIFORM_BLOCK_BINDING_CAMERA);
 }
 
 void
 DrawClear(DrawContext *context, f32 r, f32 g, f32 b)
 {
-    UNUSED(context);
+    DrawFlushRectangles(context);
+    DrawFlushText(context);
+    DrawSubmit(context);
 
     GLClearEx(r, g, b, 1, GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 }
@@ -383,91 +950,192 @@ DrawRectangle(
     UNUSED(scale);
     UNUSED(rotate);
 
-    // --- Generate vertexes ---
-    Vertex vertexes[4] = EMPTY_STACK_ARRAY;
+    if (ctx->rectDrawInfo.quadCount >= ctx->rectDrawInfo.quadCapacity) {
+        DrawFlushRectangles(ctx);
+        DrawSubmit(ctx);
+    }
+
+    RectangleVertex *vertexes =
+        ctx->rectDrawInfo.vertexes + 4 * ctx->rectDrawInfo.quadCount;
     Color3RGB rectangleColor = {color.r, color.g, color.b};
     GenerateRectangleVertexes(vertexes, x, y, width, height, rectangleColor);
-    static const u32 indicies[] = {0, 1, 2, 0, 2, 3};
+    ++ctx->rectDrawInfo.quadCount;
 
-    // --- Sending geometry ---
-    GLVertexBufferSendData(&ctx->rectDrawInfo.vb, vertexes, sizeof(Vertex) * 4);
-    GLElementBufferSendData(
-        &ctx->rectDrawInfo.eb, indicies, STATIC_ARRAY_LENGTH(indicies));
+    if (!ctx->isBatchingEnabled) {
+        DrawFlushRectangles(ctx);
+    }
+}
 
-    GLDrawElements(
-        &ctx->rectDrawInfo.eb, &ctx->rectDrawInfo.vb, ctx->rectDrawInfo.va);
+void
+DrawRectanglesInstanced(
+    DrawContext *ctx, const RectangleInstance *instances, u32 count)
+{
+    if (count == 0) {
+        return;
+    }
+
+    if (ctx->rectInstancedDrawInfo.isRecorded ||
+        RenderQueueIsFull(&ctx->queue)) {
+        DrawSubmit(ctx);
+    }
+
+    GLInstanceBufferSendData(
+        &ctx->rectInstancedDrawInfo.ib, instances,
+        sizeof(RectangleInstance) * count, count);
+
+    GLShaderProgramID shader = ctx->rectInstancedDrawInfo.shader;
+
+    RenderCommand *command = RenderQueuePush(
+        &ctx->queue, RenderSortKeyMake(DRAW_PASS_GEOMETRY, shader, 0, 0));
+    command->shader = shader;
+    command->vertexArray = ctx->rectInstancedDrawInfo.va;
+    command->elementBuffer = ctx->rectInstancedDrawInfo.eb.id;
+    command->firstElement = 0;
+    command->elementCount = ctx->rectInstancedDrawInfo.eb.count;
+    command->instanceCount = count;
+
+    ctx->rectInstancedDrawInfo.isRecorded = true;
+    ++ctx->drawCallCount;
+}
+
+/*
+ * @breaf Decodes one UTF-8 sequence and moves cursor past it. Invalid bytes are
+ * decoded as U+FFFD.
+ */
+static u32
+DecodeUTF8(const char8 **cursor)
+{
+    const byte *bytes = (const byte *)*cursor;
+
+    u32 codepoint = 0xFFFD;
+    u32 length = 1;
+
+    if (bytes[0] < 0x80) {
+        codepoint = bytes[0];
+    } else if ((bytes[0] & 0xE0) == 0xC0 && (bytes[1] & 0xC0) == 0x80) {
+        codepoint = ((bytes[0] & 0x1F) << 6) | (bytes[1] & 0x3F);
+        length = 2;
+    } else if (
+        (bytes[0] & 0xF0) == 0xE0 && (bytes[1] & 0xC0) == 0x80 &&
+        (bytes[2] & 0xC0) == 0x80) {
+        codepoint = ((bytes[0] & 0x0F) << 12) | ((bytes[1] & 0x3F) << 6) |
+                    (bytes[2] & 0x3F);
+        length = 3;
+    } else if (
+        (bytes[0] & 0xF8) == 0xF0 && (bytes[1] & 0xC0) == 0x80 &&
+        (bytes[2] & 0xC0) == 0x80 && (bytes[3] & 0xC0) == 0x80) {
+        codepoint = ((bytes[0] & 0x07) << 18) | ((bytes[1] & 0x3F) << 12) |
+                    ((bytes[2] & 0x3F) << 6) | (bytes[3] & 0x3F);
+        length = 4;
+    }
+
+    *cursor += length;
+    return codepoint;
+}
+
+static void
+GenerateGlyphVertexes(
+    TextVertex *vertexes, const Glyph *glyph, f32 x, f32 y, f32 width,
+    f32 height, Color3RGB color)
+{
+    // top-right
+    vertexes[0].position[0] = x + width;
+    vertexes[0].position[1] = y + height;
+    vertexes[0].uv[0] = glyph->uvMax[0];
+    vertexes[0].uv[1] = glyph->uvMin[1];
+
+    // bottom-right
+    vertexes[1].position[0] = x + width;
+    vertexes[1].position[1] = y;
+    vertexes[1].uv[0] = glyph->uvMax[0];
+    vertexes[1].uv[1] = glyph->uvMax[1];
+
+    // bottom-left
+    vertexes[2].position[0] = x;
+    vertexes[2].position[1] = y;
+    vertexes[2].uv[0] = glyph->uvMin[0];
+    vertexes[2].uv[1] = glyph->uvMax[1];
+
+    // top-left
+    vertexes[3].position[0] = x;
+    vertexes[3].position[1] = y + height;
+    vertexes[3].uv[0] = glyph->uvMin[0];
+    vertexes[3].uv[1] = glyph->uvMin[1];
+
+    for (u32 vertexIndex = 0; vertexIndex < 4; ++vertexIndex) {
+        vertexes[vertexIndex].color[0] = color.r;
+        vertexes[vertexIndex].color[1] = color.g;
+        vertexes[vertexIndex].color[2] = color.b;
+    }
 }
 
 void
 DrawString(
     DrawContext *ctx, f32 x, f32 y, cstring8 s, f32 scale, Color4RGBA color)
 {
-    GLShaderProgramID shader = ctx->textDrawInfo.shader;
+    Font *font = ctx->textDrawInfo.selectedFont;
+    ASSERT_NONNULL(font);
 
-    GL_CALL(glUseProgram(shader));
+    if (ctx->textDrawInfo.batchFont != font) {
+        DrawFlushText(ctx);
+        ctx->textDrawInfo.batchFont = font;
+    }
 
-    GL_CALL(glActiveTexture(GL_TEXTURE0));
-    GL_CALL(glBindVertexArray(ctx->textDrawInfo.va));
+    const Glyph *fallbackGlyph = Font_FindGlyph(font, '?');
+    Color3RGB textColor = {color.r, color.g, color.b};
 
-    GLShaderSetUniformV3F32(
-        shader, ctx->textDrawInfo.uniformLocationColor, color.r, color.g,
-        color.b);
+    f32 penX = x;
+    f32 penY = y;
 
     const char8 *sCursor = s;
 
-    Font *font = ctx->textDrawInfo.selectedFont;
-
     while (*sCursor) {
-        if (*sCursor == ' ') {
-            static const f32 SPACE_SIZE = 20;
-            x += SPACE_SIZE; // XXX
-            ++sCursor;
-            continue;
-        }
+        u32 codepoint = DecodeUTF8(&sCursor);
 
-        static const char8 firstASCIIAlpha = 'A';
-        static const char8 lastASCIIAlpha = 'z';
-
-        if (*sCursor < firstASCIIAlpha || *sCursor > lastASCIIAlpha) {
-            ++sCursor;
+        if (codepoint == '\n') {
+            penX = x;
+            penY -= font->lineHeight * scale;
             continue;
         }
 
-        Glyph *glyph = font->glyphs + (*sCursor - 'A');
+        const Glyph *glyph = Font_FindGlyph(font, codepoint);
 
-        f32 xpos = x + glyph->bearing.x * scale;
-        f32 ypos = y - (glyph->size.y - glyph->bearing.y) * scale;
+        if (glyph == NULL) {
+            glyph = fallbackGlyph;
 
-        f32 w = glyph->size.x * scale;
-        f32 h = glyph->size.y * scale;
-        // update VBO for each glyph
-        f32 vertices[6][4] = {
-            {xpos, ypos + h, 0.0f, 0.0f},    {xpos, ypos, 0.0f, 1.0f},
-            {xpos + w, ypos, 1.0f, 1.0f},
+            if (glyph == NULL) {
+                continue;
+            }
+        }
 
-            {xpos, ypos + h, 0.0f, 0.0f},    {xpos + w, ypos, 1.0f, 1.0f},
-            {xpos + w, ypos + h, 1.0f, 0.0f}};
-        // render glyph texture over quad
-        GL_CALL(glBindTexture(GL_TEXTURE_2D, glyph->texture));
-        // update content of VBO memory
+        if (glyph->size.x > 0 && glyph->size.y > 0) {
+            if (ctx->textDrawInfo.quadCount >=
+                ctx->textDrawInfo.quadCapacity) {
+                DrawFlushText(ctx);
+                DrawSubmit(ctx);
+            }
 
-        GLVertexBufferSendData(
-            &ctx->textDrawInfo.vb, vertices, sizeof(vertices));
-        GLDrawTriangles(
-            &ctx->textDrawInfo.vb, &ctx->textDrawInfo.layout,
-            ctx->textDrawInfo.va);
+            f32 xpos = penX + glyph->bearing.x * scale;
+            f32 ypos = penY - (glyph->size.y - glyph->bearing.y) * scale;
+
+            f32 w = glyph->size.x * scale;
+            f32 h = glyph->size.y * scale;
 
-        // now advance cursors for next glyph (note that advance is
-        // number of 1/64 pixels)
-        x += (glyph->xAdvance >> 6) * scale;
-        // bitshift by 6 to get value in pixels (2^6 = 64)
+            TextVertex *vertexes =
+                ctx->textDrawInfo.vertexes + 4 * ctx->textDrawInfo.quadCount;
+            GenerateGlyphVertexes(vertexes, glyph, xpos, ypos, w, h, textColor);
+            ++ctx->textDrawInfo.quadCount;
+        }
 
-        ++sCursor;
+        // NOTE(gr3yknigh1): Advance is number of 1/64 pixels. [2025/11/15]
+        penX += (glyph->xAdvance >> 6) * scale;
     }
 }
 
 void
 DrawEnd(DrawContext *context)
 {
-    UNUSED(context);
+    DrawFlushRectangles(context);
+    DrawFlushText(context);
+    DrawSubmit(context);
 }
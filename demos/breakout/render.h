@@ -45,63 +45,220 @@ void Camera_HandleInput(Camera *camera);
 
 void Camera_GetProjectionMatix(Camera *camera, mat4 *projection);
 
+/*
+ * @breaf Inclusive range of unicode codepoints, which should be baked into
+ * font atlas.
+ */
+typedef struct FontCodepointRange {
+    u32 first;
+    u32 last;
+} FontCodepointRange;
+
 typedef struct Glyph {
-    GLTexture texture;
+    u32 codepoint;
+
     Vector2F32 size;
     Vector2F32 bearing;
     u32 xAdvance;
+
+    // NOTE(gr3yknigh1): Region of glyph in `Font::atlasTexture`. V axis is
+    // pointing down, same as rows of FreeType bitmaps. [2025/11/15]
+    f32 uvMin[2];
+    f32 uvMax[2];
 } Glyph;
 
+typedef enum {
+    FONT_RASTER_MODE_BITMAP, // Coverage, good only for it's own pixel size.
+    FONT_RASTER_MODE_SDF,    // Signed distance field, scales to any size.
+} FontRasterMode;
+
+/*
+ * @breaf Distance in pixels, which SDF covers on each side of glyph outline.
+ */
+#define FONT_SDF_SPREAD EXPAND(8)
+
+/*
+ * @breaf Font, which all glyphs are baked into one texture.
+ */
 typedef struct Font {
     Glyph *glyphs;
     usize glyphsCount;
 
+    FontCodepointRange *ranges;
+    u32 rangesCount;
+
+    GLTexture atlasTexture;
+    u32 atlasWidth;
+    u32 atlasHeight;
+
+    FontRasterMode rasterMode;
+    u32 sdfSpread;
+
     u32 pixelWidth;
     u32 pixelHeight;
+    u32 lineHeight;
 } Font;
 
+/*
+ * @breaf Printable ASCII: digits, letters and punctuation.
+ */
+#define FONT_DEFAULT_CODEPOINT_FIRST EXPAND(0x20)
+#define FONT_DEFAULT_CODEPOINT_LAST EXPAND(0x7E)
+
+/*
+ * @breaf Makes font with default codepoint range.
+ */
 Font *Font_Make(cstring8 fontPath, u32 pixelWidth, u32 pixelHeight);
+
+/*
+ * @breaf Makes SDF font with default codepoint range. One such font can be
+ * drawn with any scale, so `pixelHeight` only defines quality of atlas.
+ */
+Font *Font_MakeSDF(cstring8 fontPath, u32 pixelHeight);
+
+/*
+ * @breaf Makes font with glyphs from all specified codepoint ranges. Ranges
+ * must be sorted and must not overlap.
+ *
+ * Glyphs are rasterized in parallel, on up to `GetProcessorCount` threads.
+ */
+Font *Font_MakeEx(
+    cstring8 fontPath, u32 pixelWidth, u32 pixelHeight,
+    const FontCodepointRange *ranges, u32 rangesCount,
+    FontRasterMode rasterMode);
+
+/*
+ * @breaf Returns glyph of the codepoint or NULL if font doesn't have it.
+ */
+const Glyph *Font_FindGlyph(const Font *font, u32 codepoint);
+
 void Font_Destroy(Font *font);
 
+/*
+ * @breaf Vertex of rectangle batch.
+ */
+typedef struct RectangleVertex {
+    f32 position[2];
+    f32 color[3];
+} RectangleVertex;
+
+/*
+ * @breaf Count of rectangles, which fits in one batch. When batch is full it
+ * flushed before next rectangle is appended.
+ */
+#define RECTANGLE_BATCH_CAPACITY EXPAND(65536)
+
+/*
+ * @breaf Vertex of text batch.
+ */
+typedef struct TextVertex {
+    f32 position[2];
+    f32 uv[2];
+    f32 color[3];
+} TextVertex;
+
+/*
+ * @breaf Count of glyphs, which fits in one text batch.
+ */
+#define TEXT_BATCH_CAPACITY EXPAND(16384)
+
+/*
+ * @breaf Count of draw commands, which are recorded before queue is
+ * submitted.
+ */
+#define DRAW_QUEUE_CAPACITY EXPAND(4096)
+
+/*
+ * @breaf Per-instance data of `DrawRectanglesInstanced`.
+ */
+typedef struct RectangleInstance {
+    f32 position[2];
+    f32 size[2];
+    f32 color[3];
+} RectangleInstance;
+
 /*
  * @breaf 2D Draw context.
+ *
+ * Rectangles are batched: `DrawRectangle` only appends vertexes on CPU side,
+ * batch is recorded into render queue as one command when shader has to be
+ * changed (`DrawRectanglesInstanced`) or on `DrawEnd`.
+ *
+ * Text is batched separately: `DrawString` appends glyph quads, which are
+ * recorded as one command per font. Batch is flushed when other font is
+ * selected and on `DrawEnd`. Text is recorded in later pass than rectangles,
+ * so it stays on top.
+ *
+ * Commands are sorted by shader and texture and executed on `DrawEnd`,
+ * `DrawClear` or when queue or vertex storage is full. Order of commands in
+ * one pass is not preserved.
  */
 typedef struct DrawContext {
     Camera *camera;
     GLShaderProgramID defaultShader;
 
-    mat4 model;
     mat4 projection;
 
+    // NOTE(gr3yknigh1): `Camera` uniform block, shared by all programs.
+    // Updated once in `DrawBegin`. [2025/11/16]
+    GLUniformBuffer cameraBuffer;
+
+    // NOTE(gr3yknigh1): Turn off to flush every rectangle right away. Exists
+    // only to measure gains of batching. [2025/11/14]
+    bool isBatchingEnabled;
+
+    u32 drawCallCount; // Per frame. Reset in `DrawBegin`.
+
+    RenderQueue queue;
+
     struct {
         GLVertexArray va;
         GLVertexBuffer vb;
-        GLElementBuffer eb;
+        GLElementBuffer eb; // Static, shared between all quads.
         GLShaderProgramID shader;
         GLVertexBufferLayout layout;
 
-        GLUniformLocation uniformLocationModel;
-        GLUniformLocation uniformLocationColor;
-        GLUniformLocation uniformLocationProjection;
+        RectangleVertex *vertexes;
+        u32 quadFirst; // First quad, which isn't recorded into queue yet.
+        u32 quadCount;
+        u32 quadCapacity;
     } rectDrawInfo;
 
     struct {
         GLVertexArray va;
         GLVertexBuffer vb;
+        GLElementBuffer eb;
+        GLInstanceBuffer ib;
+        GLShaderProgramID shader;
+        GLVertexBufferLayout layout;
+        GLVertexBufferLayout instanceLayout;
+        // NOTE(gr3yknigh1): Instance buffer is used by recorded command, so it
+        // can't be overwritten until queue is submitted. [2025/11/16]
+        bool isRecorded;
+    } rectInstancedDrawInfo;
+
+    struct {
+        GLVertexArray va;
+        GLVertexBuffer vb;
+        GLElementBuffer eb; // Same buffer as `rectDrawInfo.eb`.
         GLShaderProgramID shader;
+        GLShaderProgramID sdfShader; // For `FONT_RASTER_MODE_SDF` fonts.
         GLVertexBufferLayout layout;
 
         Font *selectedFont;
+        Font *batchFont; // Font of glyphs, which are currently in the batch.
 
-        GLUniformLocation uniformLocationTexture;
-        GLUniformLocation uniformLocationColor;
-        GLUniformLocation uniformLocationProjection;
+        TextVertex *vertexes;
+        u32 quadFirst;
+        u32 quadCount;
+        u32 quadCapacity;
     } textDrawInfo;
 } DrawContext;
 
 DrawContext DrawContext_MakeEx(
     Scratch *scratch, Camera *camera, GLShaderProgramID rectangleShader,
-    GLShaderProgramID textShader);
+    GLShaderProgramID rectangleInstancedShader, GLShaderProgramID textShader,
+    GLShaderProgramID textSDFShader);
 
 void DrawContext_SelectFont(DrawContext *context, Font *font);
 
@@ -113,6 +270,16 @@ void DrawRectangle(
     DrawContext *context, f32 x, f32 y, f32 width, f32 height, f32 scale,
     f32 rotate, Color4RGBA color);
 
+/*
+ * @breaf Draws all rectangles with one instanced draw call.
+ */
+void DrawRectanglesInstanced(
+    DrawContext *context, const RectangleInstance *instances, u32 count);
+
+/*
+ * @breaf Draws UTF-8 string with selected font. `\n` moves pen to the next
+ * line.
+ */
 void DrawString(
     DrawContext *context, f32 x, f32 y, cstring8 s, f32 scale,
     Color4RGBA color);
@@ -97,7 +97,6 @@ Entry(int argc, char *argv[])
     LARGE_INTEGER lastCounter = {0};
     ASSERT_NONZERO(QueryPerformanceCounter(&lastCounter));
 
-    // TODO(gr3yknigh1): Destroy shaders after they are linked [2024/09/15]
     GLShaderProgramLinkData shaderLinkData = {0};
     shaderLinkData.vertexShader = GLCompileShaderFromFile(
         &runtimeScratch, "P:\\gfs\\assets\\basic.frag.glsl",
@@ -109,6 +108,9 @@ Entry(int argc, char *argv[])
         GLLinkShaderProgram(&runtimeScratch, &shaderLinkData);
     ASSERT_NONZERO(shader);
 
+    GLShaderDestroy(shaderLinkData.vertexShader);
+    GLShaderDestroy(shaderLinkData.fragmentShader);
+
 #if 0
     static const f32 vertices[] = {
         // positions        // colors         // texture coords
@@ -324,11 +326,14 @@ Entry(int argc, char *argv[])
             lastCycleCount = endCycleCount;
         }
 
+        GLResourceRegistryUpdate();
+
         if (isFirstMainloopIteration) {
             isFirstMainloopIteration = false;
         }
     }
 
+    GLResourceRegistryFlush();
     WindowClose(window);
     SoundDeviceClose(soundDevice);
     ScratchDestroy(&runtimeScratch);